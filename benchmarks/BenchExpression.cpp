@@ -0,0 +1,84 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * Benchmarks of the symbolic expressions.
+ */
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "delpi/symbolic/Expression.h"
+#include "delpi/symbolic/Variable.h"
+
+using delpi::Expression;
+using delpi::Variable;
+
+namespace {
+
+/**
+ * Create `n` fresh variables.
+ * @param n number of variables
+ * @return the variables
+ */
+std::vector<Variable> MakeVariables(const std::int64_t n) {
+  std::vector<Variable> vars;
+  vars.reserve(n);
+  for (std::int64_t i = 0; i < n; ++i) vars.emplace_back("x" + std::to_string(i));
+  return vars;
+}
+
+/**
+ * Create the linear expression @f$ \sum_{i=0}^{n-1} (i + 1) x_i @f$.
+ * @param vars variables @f$ x_i @f$
+ * @return the expression
+ */
+Expression MakeExpression(const std::vector<Variable>& vars) {
+  Expression e;
+  for (std::size_t i = 0; i < vars.size(); ++i) e += Expression::Addend{vars[i], i + 1};
+  return e;
+}
+
+void BM_ExpressionBuild(benchmark::State& state) {
+  const std::vector<Variable> vars{MakeVariables(state.range(0))};
+  for (auto _ : state) {
+    Expression e{MakeExpression(vars)};
+    benchmark::DoNotOptimize(e);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_ExpressionAdd(benchmark::State& state) {
+  const std::vector<Variable> vars{MakeVariables(state.range(0))};
+  const Expression lhs{MakeExpression(vars)};
+  const Expression rhs{mpq_class{1, 2} * MakeExpression(vars)};
+  for (auto _ : state) {
+    Expression e{lhs + rhs};
+    benchmark::DoNotOptimize(e);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_ExpressionEvaluate(benchmark::State& state) {
+  const std::vector<Variable> vars{MakeVariables(state.range(0))};
+  const Expression e{MakeExpression(vars)};
+  std::unordered_map<Variable, mpq_class> env;
+  for (std::size_t i = 0; i < vars.size(); ++i) env.emplace(vars[i], mpq_class{1, static_cast<long>(i + 1)});
+  for (auto _ : state) {
+    mpq_class value{e.Evaluate(env)};
+    benchmark::DoNotOptimize(value);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetComplexityN(state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_ExpressionBuild)->RangeMultiplier(8)->Range(8, 4096)->Complexity();
+BENCHMARK(BM_ExpressionAdd)->RangeMultiplier(8)->Range(8, 4096)->Complexity();
+BENCHMARK(BM_ExpressionEvaluate)->RangeMultiplier(8)->Range(8, 4096)->Complexity();
@@ -0,0 +1,43 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * Benchmarks of the conversion from string to rational numbers, used by the parsers.
+ */
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+#include "delpi/libs/gmp.h"
+
+namespace {
+
+void BM_StringToMpq(benchmark::State& state, const std::string& str) {
+  for (auto _ : state) {
+    mpq_class value{delpi::gmp::StringToMpq(str)};
+    benchmark::DoNotOptimize(value);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(str.size()));
+}
+
+void BM_MpqFromDouble(benchmark::State& state, const double value) {
+  for (auto _ : state) {
+    mpq_class q{value};
+    benchmark::DoNotOptimize(q);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_StringToMpq, zero, std::string{"0"});
+BENCHMARK_CAPTURE(BM_StringToMpq, integer, std::string{"1234567"});
+BENCHMARK_CAPTURE(BM_StringToMpq, long_integer, std::string{"-123456789012345678901234567890"});
+BENCHMARK_CAPTURE(BM_StringToMpq, decimal, std::string{"1234.5678"});
+BENCHMARK_CAPTURE(BM_StringToMpq, long_decimal, std::string{"-0.000000123456789012345678901234567890"});
+BENCHMARK_CAPTURE(BM_StringToMpq, scientific, std::string{"1.2345E-12"});
+BENCHMARK_CAPTURE(BM_StringToMpq, fraction, std::string{"12345/67890"});
+BENCHMARK_CAPTURE(BM_StringToMpq, infinity, std::string{"-inf"});
+BENCHMARK_CAPTURE(BM_MpqFromDouble, decimal, 1234.5678);
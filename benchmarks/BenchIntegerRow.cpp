@@ -0,0 +1,122 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * Benchmarks of the exact evaluation of the rows at a point, as done by Verify.
+ */
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "delpi/libs/gmp.h"
+#include "delpi/solver/IntegerRow.h"
+#include "delpi/solver/Row.h"
+#include "delpi/symbolic/Variable.h"
+
+using delpi::IntegerRow;
+using delpi::Row;
+using delpi::Variable;
+
+namespace {
+
+constexpr int nnz_per_row = 8;
+
+/** Square problem with decimal coefficients, together with a point to evaluate its rows at. */
+struct Workload {
+  std::vector<Variable> variables;               ///< Variable of each column
+  std::unordered_map<Variable, int> var_to_col;  ///< Map from the variables to the index of their column
+  std::vector<Row> rows;                         ///< Rows of the problem
+  std::vector<mpq_class> point;                  ///< Value of each column
+};
+
+/**
+ * Generate a random square problem of order `size`, whose coefficients have `digits` decimal digits,
+ * and a point whose values share a denominator, as the vertices of an LP problem do.
+ * @param size number of rows and columns
+ * @param digits number of decimal digits of the coefficients
+ * @return problem and point
+ */
+Workload GenerateWorkload(const int size, const int digits) {
+  std::mt19937 rng{42};
+  std::uniform_int_distribution<int> col_dist{0, size - 1}, value_dist{-99999, 99999};
+  mpz_class scale;
+  mpz_ui_pow_ui(scale.get_mpz_t(), 10, static_cast<unsigned long>(digits));  // NOLINT(runtime/int): GMP API
+  const mpz_class point_denominator{7919};
+
+  Workload workload;
+  workload.variables.reserve(size);
+  for (int j = 0; j < size; ++j) {
+    workload.var_to_col.emplace(workload.variables.emplace_back("x" + std::to_string(j)), j);
+    mpq_class& value = workload.point.emplace_back(mpz_class{value_dist(rng)}, point_denominator);
+    value.canonicalize();
+  }
+  workload.rows.reserve(size);
+  for (int i = 0; i < size; ++i) {
+    Row& row = workload.rows.emplace_back();
+    for (int k = 0; k < nnz_per_row; ++k) {
+      mpq_class coeff{mpz_class{value_dist(rng)}, scale};
+      coeff.canonicalize();
+      row.addends.emplace_back(workload.variables[col_dist(rng)], coeff);
+    }
+  }
+  return workload;
+}
+
+void BM_RationalActivity(benchmark::State& state) {
+  const Workload workload{GenerateWorkload(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)))};
+  for (auto _ : state) {
+    for (const Row& row : workload.rows) {
+      mpq_class activity{0};
+      for (const auto& [var, coeff] : row.addends) activity += coeff * workload.point[workload.var_to_col.at(var)];
+      benchmark::DoNotOptimize(activity);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(workload.rows.size()));
+}
+
+void BM_IntegerActivity(benchmark::State& state) {
+  const Workload workload{GenerateWorkload(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)))};
+  std::vector<IntegerRow> rows;
+  rows.reserve(workload.rows.size());
+  for (const Row& row : workload.rows) rows.emplace_back(row, workload.var_to_col);
+  for (auto _ : state) {
+    const IntegerRow point{workload.point};
+    for (const IntegerRow& row : rows) {
+      mpq_class activity{row.Dot(point)};
+      benchmark::DoNotOptimize(activity);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(workload.rows.size()));
+}
+
+void BM_IntegerActivityWithConversion(benchmark::State& state) {
+  // As in Verify, each row is converted to the fraction-free format right before it is evaluated
+  const Workload workload{GenerateWorkload(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)))};
+  for (auto _ : state) {
+    const IntegerRow point{workload.point};
+    for (const Row& row : workload.rows) {
+      mpq_class activity{IntegerRow{row, workload.var_to_col}.Dot(point)};
+      benchmark::DoNotOptimize(activity);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(workload.rows.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_RationalActivity)
+    ->ArgsProduct({{1000, 10000}, {2, 6}})
+    ->ArgNames({"size", "digits"})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_IntegerActivity)
+    ->ArgsProduct({{1000, 10000}, {2, 6}})
+    ->ArgNames({"size", "digits"})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_IntegerActivityWithConversion)
+    ->ArgsProduct({{1000, 10000}, {2, 6}})
+    ->ArgNames({"size", "digits"})
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,170 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * Benchmarks of the LP solver backends.
+ */
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmarks/BenchUtils.h"
+#include "delpi/solver/LpSolver.h"
+
+using delpi::Config;
+using delpi::Expression;
+using delpi::FormulaKind;
+using delpi::LpResult;
+using delpi::LpSolver;
+using delpi::Variable;
+using delpi::bench::EnabledSolvers;
+using delpi::bench::GenerateMps;
+using delpi::bench::PeakMemory;
+using delpi::bench::ResetPeakMemory;
+using delpi::bench::SolverConfig;
+using delpi::bench::SolverLabel;
+
+namespace {
+
+constexpr int nnz_per_column = 4;
+constexpr int nnz_per_row = 8;
+
+/**
+ * Create an LP solver and parse a synthetic square problem with `size` rows and columns.
+ * @param state state of the benchmark
+ * @return LP solver containing the problem
+ */
+std::unique_ptr<LpSolver> MakeSolver(benchmark::State& state) {
+  const int size = static_cast<int>(state.range(1));
+  std::unique_ptr<LpSolver> lp_solver{LpSolver::GetInstance(SolverConfig(state.range(0)))};
+  if (!lp_solver->ParseString(GenerateMps(size, size, nnz_per_column))) state.SkipWithError("Parsing failed");
+  return lp_solver;
+}
+
+void BM_AddRow(benchmark::State& state) {
+  const int size = static_cast<int>(state.range(1));
+  std::vector<Variable> vars;
+  vars.reserve(size);
+  for (int i = 0; i < size; ++i) vars.emplace_back("x" + std::to_string(i));
+  std::vector<Expression::Addends> rows(size);
+  for (int i = 0; i < size; ++i) {
+    for (int j = 0; j < nnz_per_row; ++j) rows[i].emplace(vars[(i + j * 7) % size], mpq_class{j + 1, 3});
+  }
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::unique_ptr<LpSolver> lp_solver{LpSolver::GetInstance(SolverConfig(state.range(0)))};
+    lp_solver->ReserveColumns(size);
+    lp_solver->ReserveRows(size);
+    for (const Variable& var : vars) lp_solver->AddColumn(var);
+    state.ResumeTiming();
+    for (const Expression::Addends& row : rows) lp_solver->AddRow(row, FormulaKind::Leq, 1);
+    state.PauseTiming();
+    lp_solver.reset();
+    state.ResumeTiming();
+  }
+  state.SetLabel(SolverLabel(state.range(0)));
+  state.SetItemsProcessed(state.iterations() * size);
+}
+
+void BM_Solve(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::unique_ptr<LpSolver> lp_solver{MakeSolver(state)};
+    mpq_class precision{0};
+    state.ResumeTiming();
+    const LpResult result = lp_solver->Solve(precision);
+    benchmark::DoNotOptimize(result);
+    state.PauseTiming();
+    lp_solver.reset();
+    state.ResumeTiming();
+  }
+  state.SetLabel(SolverLabel(state.range(0)));
+}
+
+/**
+ * Once the problem has been solved, solving it again reuses the optimal basis,
+ * so the time is dominated by the extraction of the solution.
+ * The second argument of the benchmark enables or disables the extraction, so the two runs can be compared.
+ */
+void BM_UpdateFeasible(benchmark::State& state) {
+  std::unique_ptr<LpSolver> lp_solver{MakeSolver(state)};
+  const bool store_solution = state.range(2) != 0;
+  mpq_class precision{0};
+  if (lp_solver->Solve(precision) != LpResult::OPTIMAL) state.SkipWithError("The problem is not optimal");
+  for (auto _ : state) {
+    precision = 0;
+    const LpResult result = lp_solver->Solve(precision, store_solution);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetLabel(SolverLabel(state.range(0)));
+  state.SetItemsProcessed(state.iterations() * (lp_solver->num_columns() + lp_solver->num_rows()));
+}
+
+void BM_Verify(benchmark::State& state) {
+  std::unique_ptr<LpSolver> lp_solver{MakeSolver(state)};
+  mpq_class precision{0};
+  if (lp_solver->Solve(precision) != LpResult::OPTIMAL) state.SkipWithError("The problem is not optimal");
+  for (auto _ : state) {
+    const bool verified = lp_solver->Verify();
+    benchmark::DoNotOptimize(verified);
+  }
+  state.SetLabel(SolverLabel(state.range(0)));
+  state.SetItemsProcessed(state.iterations() * lp_solver->num_rows());
+}
+
+/**
+ * Peak memory needed to load and solve a synthetic problem, with and without @ref Config::memory_lean,
+ * selected by the third argument of the benchmark.
+ * The `extra_rss` counter is the growth of the peak resident set size over the one before the LP solver is created.
+ */
+void BM_PeakMemory(benchmark::State& state) {
+  const int size = static_cast<int>(state.range(1));
+  const std::string mps{GenerateMps(size, size, nnz_per_column)};
+  Config config{SolverConfig(state.range(0))};
+  config.m_memory_lean() = state.range(2) != 0;
+  std::int64_t peak = 0, extra = 0;
+  for (auto _ : state) {
+    ResetPeakMemory();
+    const std::int64_t baseline = PeakMemory();
+    std::unique_ptr<LpSolver> lp_solver{LpSolver::GetInstance(config)};
+    if (!lp_solver->ParseString(mps)) state.SkipWithError("Parsing failed");
+    mpq_class precision{0};
+    const LpResult result = lp_solver->Solve(precision);
+    benchmark::DoNotOptimize(result);
+    peak = PeakMemory();
+    extra = peak - baseline;
+    state.PauseTiming();
+    lp_solver.reset();
+    state.ResumeTiming();
+  }
+  state.SetLabel(SolverLabel(state.range(0)));
+  state.counters["peak_rss"] =
+      benchmark::Counter(static_cast<double>(peak), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+  state.counters["extra_rss"] =
+      benchmark::Counter(static_cast<double>(extra), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+}
+
+}  // namespace
+
+BENCHMARK(BM_AddRow)->ArgsProduct({EnabledSolvers(), {100, 1000, 10000}})->ArgNames({"solver", "rows"});
+BENCHMARK(BM_Solve)
+    ->ArgsProduct({EnabledSolvers(), {100, 1000}})
+    ->ArgNames({"solver", "rows"})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_UpdateFeasible)
+    ->ArgsProduct({EnabledSolvers(), {100, 1000}, {0, 1}})
+    ->ArgNames({"solver", "rows", "store"})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Verify)
+    ->ArgsProduct({EnabledSolvers(), {100, 1000}})
+    ->ArgNames({"solver", "rows"})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_PeakMemory)
+    ->ArgsProduct({EnabledSolvers(), {1000, 10000}, {0, 1}})
+    ->ArgNames({"solver", "rows", "lean"})
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
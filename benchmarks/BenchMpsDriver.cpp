@@ -0,0 +1,100 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * Benchmarks of the MPS parser.
+ *
+ * Besides the synthetic problems, any MPS file passed on the command line is parsed as well.
+ * @code
+ * bazel run --config=bench //benchmarks:bench_mps_driver -- --benchmark_format=json path/to/problem.mps
+ * @endcode
+ */
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "benchmarks/BenchUtils.h"
+#include "delpi/parser/mps/Driver.h"
+#include "delpi/solver/LpSolver.h"
+
+using delpi::Config;
+using delpi::Generator;
+using delpi::LpSolver;
+using delpi::bench::EnabledSolvers;
+using delpi::bench::GenerateMps;
+using delpi::bench::SolverConfig;
+using delpi::bench::SolverLabel;
+using delpi::mps::MpsDriver;
+
+namespace {
+
+void BM_ParseSynthetic(benchmark::State& state) {
+  const Config config{SolverConfig(state.range(0))};
+  const auto kind = static_cast<Generator::Kind>(state.range(1));
+  const int num_rows = static_cast<int>(state.range(2));
+  const std::string mps{GenerateMps(num_rows, num_rows, 4, kind)};
+  for (auto _ : state) {
+    // The LP solver receives the parsed problem, but its construction is not part of the parsing
+    state.PauseTiming();
+    std::unique_ptr<LpSolver> lp_solver{LpSolver::GetInstance(config)};
+    state.ResumeTiming();
+    MpsDriver driver{*lp_solver};
+    if (!driver.ParseString(mps)) state.SkipWithError("Parsing failed");
+    state.PauseTiming();
+    lp_solver.reset();
+    state.ResumeTiming();
+  }
+  state.SetLabel(SolverLabel(state.range(0)));
+  state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(mps.size()));
+}
+
+void BM_ParseFile(benchmark::State& state, const std::string& filename) {
+  const Config config{SolverConfig(state.range(0))};
+  const auto size = static_cast<std::int64_t>(std::filesystem::file_size(filename));
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::unique_ptr<LpSolver> lp_solver{LpSolver::GetInstance(config)};
+    state.ResumeTiming();
+    MpsDriver driver{*lp_solver};
+    if (!driver.ParseFile(filename)) state.SkipWithError("Parsing failed");
+    state.PauseTiming();
+    lp_solver.reset();
+    state.ResumeTiming();
+  }
+  state.SetLabel(SolverLabel(state.range(0)));
+  state.SetBytesProcessed(state.iterations() * size);
+}
+
+}  // namespace
+
+BENCHMARK(BM_ParseSynthetic)
+    ->ArgsProduct({EnabledSolvers(),
+                   {static_cast<std::int64_t>(Generator::Kind::RANDOM),
+                    static_cast<std::int64_t>(Generator::Kind::TRANSPORTATION)},
+                   {100, 1000, 10000, 100000}})
+    ->ArgNames({"solver", "kind", "rows"})
+    ->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  // All the arguments not recognised by the benchmark library are MPS files to parse
+  for (int i = 1; i < argc; ++i) {
+    const std::string filename{argv[i]};
+    if (!std::filesystem::is_regular_file(filename)) {
+      std::cerr << "Not a file: " << filename << std::endl;
+      return 1;
+    }
+    const std::string name{"BM_ParseFile/" + std::filesystem::path{filename}.filename().string()};
+    benchmark::RegisterBenchmark(name.c_str(), BM_ParseFile, filename)
+        ->ArgsProduct({EnabledSolvers()})
+        ->ArgNames({"solver"})
+        ->Unit(benchmark::kMillisecond);
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
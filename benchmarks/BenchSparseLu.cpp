@@ -0,0 +1,176 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * Benchmarks of the exact sparse LU factorisation.
+ */
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmarks/BenchUtils.h"
+#include "delpi/solver/LpSolver.h"
+#include "delpi/solver/SparseLu.h"
+
+using delpi::Basis;
+using delpi::BasisStatus;
+using delpi::LpResult;
+using delpi::LpSolver;
+using delpi::Row;
+using delpi::SparseLu;
+using delpi::bench::EnabledSolvers;
+using delpi::bench::SolverConfig;
+
+namespace {
+
+constexpr int nnz_per_column = 4;
+constexpr int bandwidth = 8;
+
+/**
+ * Generate a random sparse non-singular matrix of order `size`, made of `num_blocks` independent blocks.
+ *
+ * The non-zeros of each column lie close to the diagonal, as it often happens in the bases of real problems,
+ * since a uniformly random sparsity pattern produces a fill-in no simplex basis exhibits.
+ * Each column is diagonally dominant, so the matrix is never singular.
+ * @param size order of the matrix
+ * @param num_blocks number of independent blocks
+ * @return columns of the matrix
+ */
+std::vector<SparseLu::SparseVector> GenerateMatrix(const int size, const int num_blocks) {
+  const int block_size = size / num_blocks;
+  std::mt19937 rng{42};
+  std::uniform_int_distribution<int> value_dist{-3, 3}, distance_dist{1, bandwidth};
+  std::vector<SparseLu::SparseVector> columns(size);
+  for (int j = 0; j < size; ++j) {
+    const int offset = std::min(j / block_size, num_blocks - 1) * block_size;
+    const int length = j / block_size < num_blocks - 1 ? block_size : size - offset;
+    mpq_class sum{0};
+    for (int k = 1; k < nnz_per_column; ++k) {
+      const int i = offset + (j - offset + distance_dist(rng)) % length;
+      const int value = value_dist(rng);
+      if (i == j || value == 0) continue;
+      columns[j].emplace_back(i, value);
+      sum += std::abs(value);
+    }
+    columns[j].emplace_back(j, sum + 1);
+  }
+  return columns;
+}
+
+/**
+ * Extract the basis matrix of the optimal basis of the problem in `filename`.
+ *
+ * As in the BasisCertifier, the matrix is made of the basic columns restricted to the non-basic rows.
+ * @param state state of the benchmark
+ * @param filename MPS file containing the problem
+ * @return columns of the basis matrix
+ */
+std::vector<SparseLu::SparseVector> ExtractBasisMatrix(benchmark::State& state, const std::string& filename) {
+  std::unique_ptr<LpSolver> lp_solver{LpSolver::GetInstance(SolverConfig(state.range(0)))};
+  mpq_class precision{0};
+  if (!lp_solver->ParseFile(filename) || lp_solver->Solve(precision) != LpResult::OPTIMAL ||
+      lp_solver->basis().columns.empty()) {
+    state.SkipWithError("The problem has no optimal basis");
+    return {};
+  }
+  const Basis& basis = lp_solver->basis();
+  std::vector<int> column_position(basis.columns.size(), -1), row_position(basis.rows.size(), -1);
+  int num_basic = 0, num_tight = 0;
+  for (std::size_t j = 0; j < basis.columns.size(); ++j) {
+    if (basis.columns[j] == BasisStatus::BASIC) column_position[j] = num_basic++;
+  }
+  for (std::size_t i = 0; i < basis.rows.size(); ++i) {
+    if (basis.rows[i] != BasisStatus::BASIC) row_position[i] = num_tight++;
+  }
+  std::vector<SparseLu::SparseVector> columns(num_basic);
+  for (int i = 0; i < lp_solver->num_rows(); ++i) {
+    if (row_position[i] == -1) continue;
+    const Row row{lp_solver->row(i)};
+    for (const auto& [var, coeff] : row.addends) {
+      const int position = column_position[lp_solver->var_to_col().at(var)];
+      if (position != -1) columns[position].emplace_back(row_position[i], coeff);
+    }
+  }
+  return columns;
+}
+
+void BM_Factorise(benchmark::State& state) {
+  const int size = static_cast<int>(state.range(0));
+  const std::vector<SparseLu::SparseVector> columns{GenerateMatrix(size, static_cast<int>(state.range(1)))};
+  const auto num_threads = static_cast<unsigned int>(state.range(2));
+  std::size_t nnz = 0;
+  for (auto _ : state) {
+    const SparseLu lu{columns, num_threads};
+    nnz = lu.num_nonzeros();
+    benchmark::DoNotOptimize(nnz);
+  }
+  state.counters["nnz"] = static_cast<double>(nnz);
+}
+
+void BM_Solve(benchmark::State& state) {
+  const int size = static_cast<int>(state.range(0));
+  const SparseLu lu{GenerateMatrix(size, 1)};
+  const std::vector<mpq_class> b(size, 1);
+  for (auto _ : state) {
+    std::vector<mpq_class> x{lu.Solve(b)};
+    std::vector<mpq_class> y{lu.SolveTranspose(b)};
+    benchmark::DoNotOptimize(x);
+    benchmark::DoNotOptimize(y);
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+
+void BM_FactoriseFile(benchmark::State& state, const std::string& filename) {
+  const std::vector<SparseLu::SparseVector> columns{ExtractBasisMatrix(state, filename)};
+  if (columns.empty()) return;
+  const auto num_threads = static_cast<unsigned int>(state.range(1));
+  std::size_t nnz = 0, num_blocks = 0;
+  for (auto _ : state) {
+    const SparseLu lu{columns, num_threads};
+    nnz = lu.num_nonzeros();
+    num_blocks = lu.num_blocks();
+    benchmark::DoNotOptimize(nnz);
+  }
+  state.counters["size"] = static_cast<double>(columns.size());
+  state.counters["nnz"] = static_cast<double>(nnz);
+  state.counters["blocks"] = static_cast<double>(num_blocks);
+}
+
+}  // namespace
+
+BENCHMARK(BM_Factorise)
+    ->ArgsProduct({{100, 1000, 10000}, {1, 8}, {1, 4}})
+    ->ArgNames({"size", "blocks", "threads"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_Solve)->ArgsProduct({{100, 1000}})->ArgNames({"size"})->Unit(benchmark::kMicrosecond);
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  // All the arguments not recognised by the benchmark library are MPS files, e.g. from Netlib,
+  // whose optimal basis is factorised
+  for (int i = 1; i < argc; ++i) {
+    const std::string filename{argv[i]};
+    if (!std::filesystem::is_regular_file(filename)) {
+      std::cerr << "Not a file: " << filename << std::endl;
+      return 1;
+    }
+    const std::string name{"BM_FactoriseFile/" + std::filesystem::path{filename}.filename().string()};
+    benchmark::RegisterBenchmark(name.c_str(), BM_FactoriseFile, filename)
+        ->ArgsProduct({EnabledSolvers(), {1, 4}})
+        ->ArgNames({"solver", "threads"})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
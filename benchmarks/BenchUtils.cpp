@@ -0,0 +1,85 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "benchmarks/BenchUtils.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#ifdef __APPLE__
+#include <sys/resource.h>
+#endif
+
+namespace delpi::bench {
+
+std::vector<std::int64_t> EnabledSolvers() {
+  return {
+#ifdef DELPI_ENABLED_SOPLEX
+      static_cast<std::int64_t>(Config::LpSolver::SOPLEX),
+#endif
+#ifdef DELPI_ENABLED_QSOPTEX
+      static_cast<std::int64_t>(Config::LpSolver::QSOPTEX),
+#endif
+  };
+}
+
+std::string SolverLabel(const std::int64_t arg) {
+  std::stringstream ss;
+  ss << static_cast<Config::LpSolver>(arg);
+  return ss.str();
+}
+
+Config SolverConfig(const std::int64_t arg) {
+  Config config{Config::Format::MPS};
+  config.m_lp_solver() = static_cast<Config::LpSolver>(arg);
+  return config;
+}
+
+std::string GenerateMps(const int num_rows, const int num_columns, const int nnz_per_column,
+                        const Generator::Kind kind) {
+  Config config;
+  config.m_random_seed() = 1;
+  Generator::Options options;
+  options.kind = kind;
+  options.num_rows = num_rows;
+  options.num_columns = num_columns;
+  options.nnz_per_column = nnz_per_column;
+  const Generator generator{config, options};
+  std::stringstream mps;
+  generator.WriteMps(mps);
+  return mps.str();
+}
+
+void ResetPeakMemory() {
+#ifdef __linux__
+  // Writing 5 to clear_refs resets the peak resident set size of the process
+  std::ofstream clear_refs{"/proc/self/clear_refs"};
+  clear_refs << "5";
+#endif
+}
+
+std::int64_t PeakMemory() {
+#if defined(__linux__)
+  std::ifstream status{"/proc/self/status"};
+  std::string line;
+  while (std::getline(status, line)) {
+    if (!line.starts_with("VmHWM:")) continue;
+    std::istringstream iss{line.substr(6)};
+    std::int64_t kilobytes = 0;
+    iss >> kilobytes;
+    return kilobytes * 1024;
+  }
+  return 0;
+#elif defined(__APPLE__)
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+  return static_cast<std::int64_t>(usage.ru_maxrss);
+#else
+  return 0;
+#endif
+}
+
+}  // namespace delpi::bench
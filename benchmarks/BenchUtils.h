@@ -0,0 +1,73 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * Utilities shared by the benchmarks.
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "delpi/generator/Generator.h"
+#include "delpi/util/Config.h"
+
+namespace delpi::bench {
+
+/**
+ * LP solvers delpi has been compiled with, to be used as an argument of the benchmarks.
+ * @code
+ * BENCHMARK(BM_Foo)->ArgsProduct({EnabledSolvers(), {10, 100}});
+ * @endcode
+ * @return list of enabled LP solvers
+ */
+std::vector<std::int64_t> EnabledSolvers();
+
+/**
+ * Name of the LP solver passed as an argument of the benchmark.
+ * @param arg argument of the benchmark
+ * @return name of the LP solver
+ */
+std::string SolverLabel(std::int64_t arg);
+/**
+ * Configuration using the LP solver passed as an argument of the benchmark.
+ * @param arg argument of the benchmark
+ * @return configuration to use
+ */
+Config SolverConfig(std::int64_t arg);
+
+/**
+ * Generate a random sparse LP in MPS format, whose outcome is optimal.
+ *
+ * The same arguments always produce the same problem.
+ * @param num_rows number of rows
+ * @param num_columns number of columns
+ * @param nnz_per_column number of non-zero coefficients in each column
+ * @param kind structure of the problem
+ * @return problem in MPS format
+ * @see Generator
+ */
+std::string GenerateMps(int num_rows, int num_columns, int nnz_per_column,
+                        Generator::Kind kind = Generator::Kind::RANDOM);
+
+/**
+ * Reset the peak resident set size of the process to the current one,
+ * so that @ref PeakMemory only accounts for what happens afterwards.
+ * Only supported on Linux. Elsewhere, the peak keeps covering the whole life of the process.
+ */
+void ResetPeakMemory();
+/**
+ * Peak resident set size of the process, in bytes.
+ * @code
+ * ResetPeakMemory();
+ * const std::int64_t baseline = PeakMemory();
+ * Foo();
+ * state.counters["extra_rss"] = benchmark::Counter(PeakMemory() - baseline, benchmark::Counter::kDefaults,
+ *                                                  benchmark::Counter::kIs1024);
+ * @endcode
+ * @return peak resident set size, or 0 if it cannot be measured on this platform
+ */
+std::int64_t PeakMemory();
+
+}  // namespace delpi::bench
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "delpi/parser/parser.h"
+#include "delpi/server/Server.h"
 #include "delpi/solver/solver.h"
 #include "delpi/symbolic/symbolic.h"
 #include "delpi/util/ArgParser.h"
@@ -0,0 +1,359 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/generator/Generator.h"
+
+#include <algorithm>
+#include <optional>
+#include <ostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "delpi/util/error.h"
+
+namespace delpi {
+
+namespace {
+/** Upper bound of the columns of the random problems. */
+constexpr int column_upper_bound = 10;
+}  // namespace
+
+Generator::Generator(const Config& config, Options options)
+    : options_{options},
+      seed_{config.random_seed() == 0 ? std::random_device{}() : config.random_seed()},
+      rng_{gmp_randinit_mt} {
+  if (options_.num_rows < 1) DELPI_INVALID_ARGUMENT("num_rows", "must be at least 1");
+  if (options_.num_columns < 1) DELPI_INVALID_ARGUMENT("num_columns", "must be at least 1");
+  if (options_.nnz_per_column < 1) DELPI_INVALID_ARGUMENT("nnz_per_column", "must be at least 1");
+  if (options_.coefficient_bits < 1) DELPI_INVALID_ARGUMENT("coefficient_bits", "must be at least 1");
+  if (options_.num_commodities < 1) DELPI_INVALID_ARGUMENT("num_commodities", "must be at least 1");
+  if (options_.kind == Kind::MULTICOMMODITY && options_.num_rows < 2)
+    DELPI_INVALID_ARGUMENT("num_rows", "a multicommodity flow problem needs at least 2 nodes");
+  if (options_.expected != LpResult::OPTIMAL && options_.expected != LpResult::INFEASIBLE &&
+      options_.expected != LpResult::UNBOUNDED)
+    DELPI_INVALID_ARGUMENT_EXPECTED("expected", options_.expected, "optimal, infeasible or unbounded");
+
+  rng_.seed(seed_);
+  DELPI_DEBUG_FMT("Generator::Generator({}, seed = {})", options_.kind, seed_);
+  switch (options_.kind) {
+    case Kind::RANDOM:
+      GenerateRandom(false);
+      break;
+    case Kind::DEGENERATE:
+      GenerateRandom(true);
+      break;
+    case Kind::TRANSPORTATION:
+      GenerateTransportation();
+      break;
+    case Kind::MULTICOMMODITY:
+      GenerateMulticommodity();
+      break;
+    default:
+      DELPI_UNREACHABLE();
+  }
+  if (options_.expected == LpResult::UNBOUNDED) MakeUnbounded();
+}
+
+Generator::Generator(const Config& config) : Generator{config, Options{}} {}
+
+std::size_t Generator::nnz() const {
+  std::size_t nnz = 0;
+  for (const Row& row : rows_) nnz += row.addends.size();
+  return nnz;
+}
+
+unsigned long Generator::Uniform(const unsigned long n) { return mpz_class{rng_.get_z_range(n)}.get_ui(); }
+mpz_class Generator::Magnitude() {
+  mpz_class value{rng_.get_z_bits(options_.coefficient_bits)};
+  return value == 0 ? mpz_class{1} : value;
+}
+mpz_class Generator::Coefficient() { return Uniform(2) == 0 ? Magnitude() : mpz_class{-Magnitude()}; }
+
+void Generator::AddColumns(const int n, const std::optional<mpq_class>& lb, const std::optional<mpq_class>& ub) {
+  columns_.reserve(columns_.size() + n);
+  for (int i = 0; i < n; ++i) {
+    columns_.push_back(Column{Variable{"x" + std::to_string(columns_.size())}, lb, ub, std::nullopt});
+  }
+}
+
+void Generator::GenerateRandom(const bool degenerate) {
+  const int num_rows = options_.num_rows;
+  const int num_columns = options_.num_columns;
+  const int nnz_per_column = std::min(options_.nnz_per_column, num_rows);
+  AddColumns(num_columns, 0, column_upper_bound);
+
+  // Known point within the bounds. In degenerate problems, most of its components are at their lower bound
+  std::vector<unsigned long> point(num_columns);
+  for (unsigned long& value : point) {
+    if (degenerate) {
+      value = Uniform(4) == 0 ? 1 + Uniform(column_upper_bound) : 0;
+    } else {
+      value = Uniform(column_upper_bound + 1);
+    }
+  }
+
+  // Each column appears in nnz_per_column distinct rows, chosen with Floyd's sampling algorithm
+  std::vector<std::vector<std::pair<int, mpz_class>>> entries(num_rows);
+  std::unordered_set<int> chosen;
+  for (int column = 0; column < num_columns; ++column) {
+    chosen.clear();
+    for (int i = num_rows - nnz_per_column; i < num_rows; ++i) {
+      const int row = static_cast<int>(Uniform(i + 1));
+      chosen.insert(chosen.contains(row) ? i : row);
+    }
+    std::vector<int> sorted_rows{chosen.begin(), chosen.end()};
+    std::ranges::sort(sorted_rows);
+    for (const int row : sorted_rows) entries[row].emplace_back(column, Coefficient());
+    columns_[column].obj = Coefficient();
+  }
+  // Rows must not be empty
+  for (int row = 0; row < num_rows; ++row) {
+    if (entries[row].empty()) entries[row].emplace_back(row % num_columns, Coefficient());
+  }
+
+  rows_.reserve(num_rows + 1);
+  for (int row = 0; row < num_rows; ++row) {
+    // In degenerate problems, some rows are multiples of the previous one
+    if (degenerate && row % 4 == 3) {
+      entries[row] = entries[row - 1];
+      for (auto& [column, coeff] : entries[row]) coeff *= 2;
+    }
+    mpz_class activity{0};
+    Row& new_row = rows_.emplace_back();
+    new_row.addends.reserve(entries[row].size());
+    for (const auto& [column, coeff] : entries[row]) {
+      activity += coeff * point[column];
+      new_row.addends.emplace_back(columns_[column].var, coeff);
+    }
+    if (degenerate) {
+      // All the rows are active at the known point
+      new_row.ub = mpq_class{activity};
+      continue;
+    }
+    switch (Uniform(3)) {
+      case 0:
+        new_row.ub = mpq_class{activity + Magnitude() - 1};
+        break;
+      case 1:
+        new_row.lb = mpq_class{activity - Magnitude() + 1};
+        break;
+      default:
+        new_row.lb = new_row.ub = mpq_class{activity};
+        break;
+    }
+  }
+  if (options_.expected == LpResult::INFEASIBLE) MakeInfeasible();
+}
+
+void Generator::GenerateTransportation() {
+  const int num_sources = std::max(1, options_.num_rows / 2);
+  const int num_destinations = std::max(1, options_.num_rows - num_sources);
+  AddColumns(num_sources * num_destinations, 0, std::nullopt);
+  for (Column& column : columns_) column.obj = Magnitude();
+
+  std::vector<mpz_class> demands(num_destinations);
+  mpz_class total_demand{0};
+  for (mpz_class& demand : demands) {
+    demand = Magnitude();
+    total_demand += demand;
+  }
+  // The supply is enough to satisfy the demand only if the problem is feasible
+  const bool feasible = options_.expected != LpResult::INFEASIBLE;
+  const mpz_class base_supply{feasible ? mpz_class{(total_demand + num_sources - 1) / num_sources}
+                                       : mpz_class{(total_demand - 1) / num_sources}};
+
+  rows_.reserve(num_sources + num_destinations);
+  for (int source = 0; source < num_sources; ++source) {
+    Row& row = rows_.emplace_back();
+    for (int destination = 0; destination < num_destinations; ++destination)
+      row.addends.emplace_back(columns_[source * num_destinations + destination].var, 1);
+    row.ub = feasible ? mpz_class{base_supply + Magnitude() - 1} : base_supply;
+  }
+  for (int destination = 0; destination < num_destinations; ++destination) {
+    Row& row = rows_.emplace_back();
+    for (int source = 0; source < num_sources; ++source)
+      row.addends.emplace_back(columns_[source * num_destinations + destination].var, 1);
+    row.lb = demands[destination];
+  }
+}
+
+void Generator::GenerateMulticommodity() {
+  const int num_nodes = options_.num_rows;
+  const int num_commodities = options_.num_commodities;
+  // A ring makes sure every node can reach every other node. The remaining arcs are random
+  std::vector<std::pair<int, int>> arcs;
+  arcs.reserve(std::max(num_nodes, options_.num_columns));
+  for (int node = 0; node < num_nodes; ++node) arcs.emplace_back(node, (node + 1) % num_nodes);
+  while (static_cast<int>(arcs.size()) < options_.num_columns) {
+    const int from = static_cast<int>(Uniform(num_nodes));
+    const int to = static_cast<int>((from + 1 + Uniform(num_nodes - 1)) % num_nodes);
+    arcs.emplace_back(from, to);
+  }
+  const int num_arcs = static_cast<int>(arcs.size());
+
+  // Column of the flow of commodity k on arc a is k * num_arcs + a
+  AddColumns(num_commodities * num_arcs, 0, std::nullopt);
+  for (Column& column : columns_) column.obj = Magnitude();
+
+  std::vector<int> sources(num_commodities), sinks(num_commodities);
+  std::vector<mpz_class> demands(num_commodities);
+  mpz_class total_demand{0};
+  for (int k = 0; k < num_commodities; ++k) {
+    sources[k] = static_cast<int>(Uniform(num_nodes));
+    sinks[k] = static_cast<int>((sources[k] + 1 + Uniform(num_nodes - 1)) % num_nodes);
+    demands[k] = Magnitude();
+    total_demand += demands[k];
+  }
+
+  rows_.reserve(num_nodes * num_commodities + num_arcs);
+  // Flow conservation
+  for (int k = 0; k < num_commodities; ++k) {
+    for (int node = 0; node < num_nodes; ++node) {
+      Row& row = rows_.emplace_back();
+      for (int a = 0; a < num_arcs; ++a) {
+        if (arcs[a].first == node) row.addends.emplace_back(columns_[k * num_arcs + a].var, 1);
+        if (arcs[a].second == node) row.addends.emplace_back(columns_[k * num_arcs + a].var, -1);
+      }
+      mpz_class balance{0};
+      if (node == sources[k]) balance = demands[k];
+      if (node == sinks[k]) balance = -demands[k];
+      row.lb = row.ub = balance;
+    }
+  }
+  // Arc capacity. The ring alone can carry all the demand, unless the problem must be infeasible,
+  // in which case no flow can leave the source of the first commodity
+  const bool feasible = options_.expected != LpResult::INFEASIBLE;
+  for (int a = 0; a < num_arcs; ++a) {
+    Row& row = rows_.emplace_back();
+    for (int k = 0; k < num_commodities; ++k) row.addends.emplace_back(columns_[k * num_arcs + a].var, 1);
+    if (!feasible && arcs[a].first == sources[0]) {
+      row.ub = 0;
+    } else {
+      row.ub = a < num_nodes ? mpz_class{total_demand + Magnitude() - 1} : Magnitude();
+    }
+  }
+}
+
+void Generator::MakeInfeasible() {
+  // The sum of the first columns can't exceed the sum of their upper bounds
+  Row& row = rows_.emplace_back();
+  mpq_class bound{1};
+  for (std::size_t i = 0; i < std::min<std::size_t>(2, columns_.size()); ++i) {
+    row.addends.emplace_back(columns_[i].var, 1);
+    bound += columns_[i].ub.value();
+  }
+  row.lb = bound;
+}
+
+void Generator::MakeUnbounded() {
+  columns_.push_back(Column{Variable{"x" + std::to_string(columns_.size())}, std::nullopt, std::nullopt, -1});
+}
+
+void Generator::WriteMps(std::ostream& os) const {
+  std::unordered_map<Variable, std::size_t> column_indices;
+  column_indices.reserve(columns_.size());
+  for (std::size_t i = 0; i < columns_.size(); ++i) column_indices.emplace(columns_[i].var, i);
+  // The MPS format lists the coefficients column by column
+  std::vector<std::vector<std::pair<std::size_t, const mpq_class*>>> entries(columns_.size());
+  for (std::size_t i = 0; i < rows_.size(); ++i) {
+    for (const auto& [var, coeff] : rows_[i].addends) entries[column_indices.at(var)].emplace_back(i, &coeff);
+  }
+
+  os << "* Generated by delpi_gen: " << *this << "\n";
+  os << "* @set-info :status " << options_.expected << "\n";
+  os << "NAME " << options_.kind << "_" << seed_ << "\n";
+  os << "ROWS\n N  obj\n";
+  for (std::size_t i = 0; i < rows_.size(); ++i) {
+    const Row& row = rows_[i];
+    DELPI_ASSERT(row.lb.has_value() || row.ub.has_value(), "Free rows are not supported");
+    const char* sense = "L";
+    if (!row.ub.has_value()) sense = "G";
+    else if (row.lb.has_value() && *row.lb == *row.ub) sense = "E";
+    os << " " << sense << "  r" << i << "\n";
+  }
+
+  os << "COLUMNS\n";
+  for (std::size_t i = 0; i < columns_.size(); ++i) {
+    const Column& column = columns_[i];
+    if (column.obj.has_value() || entries[i].empty())
+      os << "    " << column.var.name() << "  obj  " << column.obj.value_or(0) << "\n";
+    for (const auto& [row, coeff] : entries[i])
+      os << "    " << column.var.name() << "  r" << row << "  " << *coeff << "\n";
+  }
+
+  os << "RHS\n";
+  for (std::size_t i = 0; i < rows_.size(); ++i) {
+    const mpq_class& rhs = rows_[i].ub.has_value() ? *rows_[i].ub : *rows_[i].lb;
+    if (rhs != 0) os << "    rhs  r" << i << "  " << rhs << "\n";
+  }
+
+  bool has_ranges = false;
+  for (std::size_t i = 0; i < rows_.size(); ++i) {
+    const Row& row = rows_[i];
+    if (!row.lb.has_value() || !row.ub.has_value() || *row.lb == *row.ub) continue;
+    if (!has_ranges) os << "RANGES\n";
+    has_ranges = true;
+    os << "    rng  r" << i << "  " << mpq_class{*row.ub - *row.lb} << "\n";
+  }
+
+  os << "BOUNDS\n";
+  for (const Column& column : columns_) {
+    const std::string& name = column.var.name();
+    if (!column.lb.has_value() && !column.ub.has_value()) {
+      os << " FR bnd  " << name << "\n";
+      continue;
+    }
+    if (column.lb.has_value() && column.ub.has_value() && *column.lb == *column.ub) {
+      os << " FX bnd  " << name << "  " << *column.lb << "\n";
+      continue;
+    }
+    if (!column.lb.has_value()) {
+      os << " MI bnd  " << name << "\n";
+    } else if (*column.lb != 0) {
+      os << " LO bnd  " << name << "  " << *column.lb << "\n";
+    }
+    if (column.ub.has_value()) os << " UP bnd  " << name << "  " << *column.ub << "\n";
+  }
+  os << "ENDATA\n";
+}
+
+void Generator::AddTo(LpSolver& lp_solver) const {
+  std::stringstream ss;
+  ss << options_.expected;
+  lp_solver.SetInfo(":status", ss.str());
+  lp_solver.ReserveColumns(static_cast<int>(columns_.size()));
+  lp_solver.ReserveRows(static_cast<int>(rows_.size()));
+  for (const Column& column : columns_) lp_solver.AddColumn(column);
+  for (const Row& row : rows_) lp_solver.AddRow(row);
+}
+
+std::ostream& operator<<(std::ostream& os, const Generator::Kind kind) {
+  switch (kind) {
+    case Generator::Kind::RANDOM:
+      return os << "random";
+    case Generator::Kind::TRANSPORTATION:
+      return os << "transportation";
+    case Generator::Kind::MULTICOMMODITY:
+      return os << "multicommodity";
+    case Generator::Kind::DEGENERATE:
+      return os << "degenerate";
+    default:
+      DELPI_UNREACHABLE();
+  }
+}
+
+std::ostream& operator<<(std::ostream& os, const Generator& generator) {
+  const Generator::Options& options = generator.options();
+  return os << "Generator{kind: " << options.kind << ", seed: " << generator.seed()
+            << ", rows: " << generator.rows().size() << ", columns: " << generator.columns().size()
+            << ", nnz: " << generator.nnz() << ", coefficient_bits: " << options.coefficient_bits
+            << ", expected: " << options.expected << "}";
+}
+
+}  // namespace delpi
@@ -0,0 +1,152 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * Generator class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <optional>
+#include <vector>
+
+#include "delpi/libs/gmp.h"
+#include "delpi/solver/Column.h"
+#include "delpi/solver/LpResult.h"
+#include "delpi/solver/LpSolver.h"
+#include "delpi/solver/Row.h"
+#include "delpi/util/Config.h"
+
+namespace delpi {
+
+/**
+ * Generator of synthetic LP problems of controlled size, density and structure.
+ *
+ * All coefficients are integers, so the problems can be written in MPS format without loss of precision.
+ * The outcome of the problem is known by construction, and it is stored as the `:status` info of the problem.
+ * The same seed and options always produce the same problem.
+ * @code
+ * Config config;
+ * config.m_random_seed() = 42;
+ * Generator generator{config, {.kind = Generator::Kind::TRANSPORTATION, .num_rows = 1000}};
+ * generator.WriteMps(std::cout);
+ * @endcode
+ */
+class Generator {
+ public:
+  /** Structure of the generated problem. */
+  enum class Kind {
+    RANDOM,          ///< Random sparse matrix, with a mix of `<=`, `>=` and `=` rows around a known feasible point
+    TRANSPORTATION,  ///< Transportation problem between `num_rows / 2` sources and the remaining destinations
+    MULTICOMMODITY,  ///< Multicommodity flow on a network with `num_rows` nodes and `num_columns` arcs
+    DEGENERATE,      ///< Random sparse matrix whose rows are all active at a known point, with many redundant rows
+  };
+  /** Parameters of the generated problem. */
+  struct Options {
+    Kind kind{Kind::RANDOM};               ///< Structure of the problem
+    int num_rows{100};                     ///< Number of rows. For network problems, it sets the number of nodes
+    int num_columns{100};                  ///< Number of columns. For network problems, it sets the number of arcs
+    int nnz_per_column{4};                 ///< Non-zero coefficients in each column. Ignored by network problems
+    int coefficient_bits{8};               ///< Maximum bit-length of the coefficients, right-hand sides and costs
+    LpResult expected{LpResult::OPTIMAL};  ///< Outcome of the problem. One of optimal, infeasible or unbounded
+    int num_commodities{2};                ///< Number of commodities. Only used by multicommodity flow problems
+  };
+
+  /**
+   * Generate a new problem.
+   *
+   * The pseudo-random generator is seeded with @ref Config::random_seed.
+   * If it is 0, a random seed is used instead, which can be retrieved with @ref seed.
+   * @param config configuration providing the seed
+   * @param options parameters of the problem
+   * @throw DelpiInvalidArgumentException if the options are not valid
+   */
+  Generator(const Config& config, Options options);
+  /**
+   * Generate a new problem with the default options.
+   * @param config configuration providing the seed
+   */
+  explicit Generator(const Config& config);
+
+  /**
+   * Write the problem in MPS format.
+   * @param os output stream
+   */
+  void WriteMps(std::ostream& os) const;
+  /**
+   * Add the problem to the `lp_solver`.
+   * @param lp_solver LP solver receiving the columns and the rows of the problem
+   */
+  void AddTo(LpSolver& lp_solver) const;
+
+  /** @getter{seed used by the pseudo-random generator, generator} */
+  [[nodiscard]] unsigned int seed() const { return seed_; }
+  /** @getter{options, generator} */
+  [[nodiscard]] const Options& options() const { return options_; }
+  /** @getter{columns of the problem, generator} */
+  [[nodiscard]] const std::vector<Column>& columns() const { return columns_; }
+  /** @getter{rows of the problem, generator} */
+  [[nodiscard]] const std::vector<Row>& rows() const { return rows_; }
+  /** @getter{number of non-zero coefficients in the constraint matrix, generator} */
+  [[nodiscard]] std::size_t nnz() const;
+
+ private:
+  /**
+   * Uniformly random integer in @f$ [0, n) @f$.
+   * @param n upper bound, excluded
+   * @return random integer
+   */
+  unsigned long Uniform(unsigned long n);
+  /**
+   * Random positive integer with at most @ref Options::coefficient_bits bits.
+   * @return random integer in @f$ [1, 2^{bits}) @f$
+   */
+  mpz_class Magnitude();
+  /**
+   * Random non-zero integer with at most @ref Options::coefficient_bits bits.
+   * @return random integer in @f$ (-2^{bits}, 2^{bits}) \setminus \{0\} @f$
+   */
+  mpz_class Coefficient();
+  /**
+   * Add `n` new columns with bounds @f$ [lb, ub] @f$ and no objective.
+   * @param n number of columns
+   * @param lb lower bound of the columns
+   * @param ub upper bound of the columns
+   */
+  void AddColumns(int n, const std::optional<mpq_class>& lb, const std::optional<mpq_class>& ub);
+
+  /**
+   * Generate a random sparse problem around a known feasible point.
+   * @param degenerate whether all the rows should be active at the known point
+   */
+  void GenerateRandom(bool degenerate);
+  /** Generate a transportation problem, feasible only if the total supply covers the total demand. */
+  void GenerateTransportation();
+  /** Generate a multicommodity flow problem, with flow conservation and arc capacity rows. */
+  void GenerateMulticommodity();
+  /** Add a row that can't be satisfied by any point within the bounds of the columns. */
+  void MakeInfeasible();
+  /** Add a free column that only appears in the objective, making the problem unbounded. */
+  void MakeUnbounded();
+
+  Options options_;              ///< Parameters of the problem
+  unsigned int seed_;            ///< Seed of the pseudo-random generator
+  gmp_randclass rng_;            ///< Pseudo-random generator
+  std::vector<Column> columns_;  ///< Columns of the problem
+  std::vector<Row> rows_;        ///< Rows of the problem
+};
+
+std::ostream& operator<<(std::ostream& os, Generator::Kind kind);
+std::ostream& operator<<(std::ostream& os, const Generator& generator);
+
+}  // namespace delpi
+
+#ifdef DELPI_INCLUDE_FMT
+
+#include "delpi/util/logging.h"
+
+OSTREAM_FORMATTER(delpi::Generator::Kind)
+OSTREAM_FORMATTER(delpi::Generator)
+
+#endif
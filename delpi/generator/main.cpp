@@ -0,0 +1,114 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * Entry point of delpi_gen, the generator of synthetic LP problems.
+ * Use the `-h` flag to show the help tooltip.
+ */
+#include <argparse/argparse.hpp>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "delpi/generator/Generator.h"
+#include "delpi/util/Config.h"
+#include "delpi/util/error.h"
+#include "delpi/util/exception.h"
+#include "delpi/version.h"
+
+using delpi::Config;
+using delpi::Generator;
+using delpi::LpResult;
+
+int main(const int argc, const char* argv[]) {
+  const Generator::Options defaults{};
+  argparse::ArgumentParser parser{"delpi_gen", DELPI_VERSION_STRING};
+  parser.add_description("Generate a synthetic LP problem in MPS format, with a known outcome");
+  parser.add_argument("-k", "--kind")
+      .help("structure of the problem. One of: random, transportation, multicommodity, degenerate")
+      .default_value(defaults.kind)
+      .action([](const std::string& value) {
+        if (value == "random") return Generator::Kind::RANDOM;
+        if (value == "transportation") return Generator::Kind::TRANSPORTATION;
+        if (value == "multicommodity") return Generator::Kind::MULTICOMMODITY;
+        if (value == "degenerate") return Generator::Kind::DEGENERATE;
+        DELPI_INVALID_ARGUMENT_EXPECTED("--kind", value, "random, transportation, multicommodity or degenerate");
+      })
+      .nargs(1);
+  parser.add_argument("--rows")
+      .help("number of rows. For network problems, number of nodes")
+      .default_value(defaults.num_rows)
+      .nargs(1)
+      .scan<'i', int>();
+  parser.add_argument("--columns")
+      .help("number of columns. For multicommodity flow problems, number of arcs. Ignored by transportation problems")
+      .default_value(defaults.num_columns)
+      .nargs(1)
+      .scan<'i', int>();
+  parser.add_argument("--nnz")
+      .help("number of non-zero coefficients in each column. Ignored by network problems")
+      .default_value(defaults.nnz_per_column)
+      .nargs(1)
+      .scan<'i', int>();
+  parser.add_argument("--bits")
+      .help("maximum bit-length of the coefficients, right-hand sides and costs")
+      .default_value(defaults.coefficient_bits)
+      .nargs(1)
+      .scan<'i', int>();
+  parser.add_argument("--commodities")
+      .help("number of commodities. Only used by multicommodity flow problems")
+      .default_value(defaults.num_commodities)
+      .nargs(1)
+      .scan<'i', int>();
+  parser.add_argument("--status")
+      .help("outcome of the problem. One of: optimal, infeasible, unbounded")
+      .default_value(defaults.expected)
+      .action([](const std::string& value) {
+        if (value == "optimal") return LpResult::OPTIMAL;
+        if (value == "infeasible") return LpResult::INFEASIBLE;
+        if (value == "unbounded") return LpResult::UNBOUNDED;
+        DELPI_INVALID_ARGUMENT_EXPECTED("--status", value, "optimal, infeasible or unbounded");
+      })
+      .nargs(1);
+  parser.add_argument("-r", "--random-seed")
+      .help(std::string{Config::help_random_seed})
+      .default_value(Config::default_random_seed)
+      .nargs(1)
+      .scan<'i', unsigned int>();
+  parser.add_argument("-o", "--output").help("output file. If not provided, the standard output is used").nargs(1);
+
+  try {
+    parser.parse_args(argc, argv);
+
+    Config config;
+    config.m_random_seed() = parser.get<unsigned int>("random-seed");
+    Generator::Options options;
+    options.kind = parser.get<Generator::Kind>("kind");
+    options.num_rows = parser.get<int>("rows");
+    options.num_columns = parser.get<int>("columns");
+    options.nnz_per_column = parser.get<int>("nnz");
+    options.coefficient_bits = parser.get<int>("bits");
+    options.num_commodities = parser.get<int>("commodities");
+    options.expected = parser.get<LpResult>("status");
+    const Generator generator{config, options};
+
+    if (!parser.is_used("output")) {
+      generator.WriteMps(std::cout);
+      return EXIT_SUCCESS;
+    }
+    std::ofstream out{parser.get<std::string>("output")};
+    if (!out.good()) {
+      std::cerr << "Cannot open the output file " << parser.get<std::string>("output") << std::endl;
+      return EXIT_FAILURE;
+    }
+    generator.WriteMps(out);
+    return EXIT_SUCCESS;
+  } catch (const delpi::DelpiException& err) {
+    std::cerr << err.what() << "\n\n" << parser.usage() << std::endl;
+  } catch (const std::runtime_error& err) {
+    std::cerr << err.what() << "\n" << parser << std::endl;
+  }
+  return EXIT_FAILURE;
+}
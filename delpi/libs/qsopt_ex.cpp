@@ -7,6 +7,7 @@
 #include "delpi/libs/qsopt_ex.h"
 
 #include <iostream>
+#include <mutex>
 
 namespace delpi::qsopt_ex {
 
@@ -77,17 +78,21 @@ std::ostream &operator<<(std::ostream &os, const MpqArray &array) {
 }
 
 namespace {
-bool is_qsopt_initialized = false;
-}
+// Multiple solver instances may be alive at the same time (e.g. in server mode).
+// The library is initialised by the first one and cleared by the last one.
+std::mutex qsopt_mutex;
+std::size_t qsopt_users = 0;
+}  // namespace
 
 void QSXStart() {
-  if (!is_qsopt_initialized) QSexactStart();
-  is_qsopt_initialized = true;
+  std::lock_guard<std::mutex> lock{qsopt_mutex};
+  if (qsopt_users++ == 0) QSexactStart();
 }
 
 void QSXFinish() {
-  if (is_qsopt_initialized) QSexactClear();
-  is_qsopt_initialized = false;
+  std::lock_guard<std::mutex> lock{qsopt_mutex};
+  if (qsopt_users == 0) return;
+  if (--qsopt_users == 0) QSexactClear();
 }
 
 }  // namespace delpi::qsopt_ex
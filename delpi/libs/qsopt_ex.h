@@ -133,7 +133,15 @@ class MpqArray {
 
 std::ostream &operator<<(std::ostream &os, const MpqArray &array);
 
+/**
+ * Initialise the QSopt_ex library.
+ * Calls are reference counted, so the library is only initialised the first time.
+ */
 void QSXStart();
+/**
+ * Release the QSopt_ex library.
+ * Calls are reference counted, so the library is only cleared when the last user calls it.
+ */
 void QSXFinish();
 
 }  // namespace delpi::qsopt_ex
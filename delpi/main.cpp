@@ -5,9 +5,13 @@
  * Entry point of delpi.
  * Use the `-h` flag to show the help tooltip.
  */
+#include <algorithm>
 #include <iostream>
+#include <utility>
+#include <vector>
 
 #include "delpi/delpi.h"
+#include "delpi/util/exception.h"
 
 void OnSolve(const delpi::LpSolver& lp_solver, const delpi::LpResult result, const std::vector<mpq_class>& x,
              const std::vector<mpq_class>&, const mpq_class& obj_lb, const mpq_class& obj_ub, const mpq_class&) {
@@ -42,6 +46,95 @@ bool OnPartialSolve(const delpi::LpSolver& lp_solver, const delpi::LpResult resu
   return true;
 }
 
+void OnScenarioSolve(const delpi::LpSolver& lp_solver, const delpi::ScenarioResult& result) {
+  if (lp_solver.config().silent()) return;
+
+  const mpq_class diff = result.obj_ub - result.obj_lb;
+  switch (result.result) {
+    case delpi::LpResult::OPTIMAL:
+      fmt::println("{}: {}, objective value = {} ( = {})", result.name, result.result, result.obj_lb,
+                   result.obj_lb.get_d());
+      break;
+    case delpi::LpResult::DELTA_OPTIMAL:
+      fmt::println("{}: {} with delta = {} ( = {}), range = [{}, {}] ( = [{}, {}])", result.name, result.result,
+                   diff.get_d(), diff, result.obj_lb, result.obj_ub, result.obj_lb.get_d(), result.obj_ub.get_d());
+      break;
+    default:
+      fmt::println("{}: {}", result.name, result.result);
+  }
+  if (lp_solver.config().produce_models()) fmt::println("Model: {}", lp_solver.model(result.solution));
+  std::cout << std::flush;
+}
+
+/**
+ * Print the sensitivity ranges of the final basis of the last solve.
+ * If the last solve did not produce a basis, e.g., because the basis of the dual problem has no counterpart
+ * in the original one, or the basis cannot be proven optimal in exact arithmetic, only a notice is printed.
+ * @param lp_solver LP solver that has just found an optimal solution
+ */
+void PrintSensitivity(const delpi::LpSolver& lp_solver) {
+  if (lp_solver.basis().columns.empty()) {
+    fmt::println("Sensitivity: no basis available");
+    std::cout << std::flush;
+    return;
+  }
+  delpi::SensitivityReport report;
+  try {
+    report = lp_solver.Sensitivity();
+  } catch (const delpi::DelpiException&) {
+    fmt::println("Sensitivity: basis not optimal");
+    std::cout << std::flush;
+    return;
+  }
+  fmt::println("Objective ranges:");
+  for (std::size_t j = 0; j < report.objective.size(); ++j) {
+    fmt::println("  {}: {}", lp_solver.var(static_cast<int>(j)), report.objective[j]);
+  }
+  fmt::println("Rhs ranges:");
+  for (std::size_t i = 0; i < report.rhs.size(); ++i) fmt::println("  row {}: {}", i, report.rhs[i]);
+  std::cout << std::flush;
+}
+
+/**
+ * Print the features of the LP problem, in CSV format if requested.
+ * @param lp_solver LP solver holding the problem
+ */
+void PrintFeatures(const delpi::LpSolver& lp_solver) {
+  const delpi::ModelFeatures features{lp_solver.Features()};
+  if (lp_solver.config().csv()) {
+    delpi::ModelFeatures::WriteCsvHeader(std::cout);
+    std::cout << "\n";
+    features.WriteCsv(std::cout);
+    std::cout << std::endl;
+  } else {
+    fmt::println("{}", features);
+    std::cout << std::flush;
+  }
+}
+
+/**
+ * Solve all the scenarios collected from the input, reporting the result of each one.
+ * @param lp_solver LP solver holding the base problem and its scenarios
+ * @param precision desired precision for the optimisation
+ * @return worst exit code among the scenarios
+ */
+int SolveScenarios(delpi::LpSolver& lp_solver, const mpq_class& precision) {
+  const std::vector<delpi::ScenarioResult> results{
+      lp_solver.SolveScenarios(lp_solver.scenarios(), precision, lp_solver.config().produce_models())};
+  int exit_code = 0;
+  for (const delpi::ScenarioResult& result : results) {
+    OnScenarioSolve(lp_solver, result);
+    exit_code = std::max(exit_code, ExitCode(result.result));
+  }
+  if (!lp_solver.config().silent() && lp_solver.config().with_timings()) {
+    if (lp_solver.config().csv())
+      lp_solver.profiler().WriteCsv(std::cout);
+    else
+      std::cout << lp_solver.profiler() << std::endl;
+  }
+  return exit_code;
+}
+
 int main(const int argc, const char* argv[]) {
   // Initialize the command line parser.
   delpi::ArgParser parser{};
@@ -50,8 +143,14 @@ int main(const int argc, const char* argv[]) {
   // Get the configuration from the command line arguments.
   const delpi::Config config = parser.ToConfig();
 
+  // In server mode, the problems are received through the requests
+  if (config.server()) {
+    delpi::Server server{config};
+    return server.Run();
+  }
+
   // Setup the infinity values.
-  const auto lp_solver{delpi::LpSolver::GetInstance(config)};
+  auto lp_solver{delpi::LpSolver::GetInstance(config)};
   lp_solver->m_solve_cb() = &OnSolve;
   lp_solver->m_partial_solve_cb() = &OnPartialSolve;
 
@@ -59,10 +158,15 @@ int main(const int argc, const char* argv[]) {
     std::cerr << "Error parsing the input" << std::endl;
     return EXIT_FAILURE;
   }
+  // With --lp-solver auto, move the problem to the LP solver best suited for it
+  if (auto selected = lp_solver->SelectBackend()) lp_solver = std::move(selected);
+  if (config.features() && !config.silent()) PrintFeatures(*lp_solver);
 
   // Run the solver
   mpq_class precision{config.precision()};
-  const delpi::LpResult result = lp_solver->Solve(precision);
+  if (config.scenarios()) return SolveScenarios(*lp_solver, precision);
+  const delpi::LpResult result =
+      config.decompose() ? lp_solver->SolveDecomposed(precision) : lp_solver->Solve(precision);
 
   if (config.silent()) return ExitCode(result);
 
@@ -70,12 +174,20 @@ int main(const int argc, const char* argv[]) {
   if (!lp_solver->CheckAgainstExpected(result)) {
     std::cerr << "WARNING: Expected " << lp_solver->expected() << " but got " << result << std::endl;
   }
+  if (config.sensitivity() && result == delpi::LpResult::OPTIMAL) PrintSensitivity(*lp_solver);
   if (config.verify() && IsFeasible(result)) {
     if (lp_solver->Verify())
       std::cout << "Model correctly satisfies the input" << std::endl;
     else
       std::cerr << "WARNING: Model does not satisfy the input" << std::endl;
   }
+  // Print the time spent in each phase, alongside the counters collected along the way
+  if (config.with_timings()) {
+    if (config.csv())
+      lp_solver->profiler().WriteCsv(std::cout);
+    else
+      std::cout << lp_solver->profiler() << std::endl;
+  }
 
   return ExitCode(result);
 }
@@ -11,6 +11,7 @@
 
 #include "delpi/libs/gmp.h"
 #include "delpi/util/Config.h"
+#include "delpi/util/Profiler.h"
 #include "delpi/util/error.h"
 
 namespace delpi {
@@ -20,6 +21,7 @@ Driver::Driver(LpSolver& lp_solver, const std::string& class_name)
 
 bool Driver::ParseStream(std::istream& in, const std::string& sname) {
   TimerGuard timer_guard(&stats_.m_timer(), stats_.enabled());
+  const ProfilerGuard profiler_guard{lp_solver_.m_profiler(), "parse"};
   stream_name_ = sname;
   return ParseStreamCore(in);
 }
@@ -6,13 +6,127 @@
 
 #include "delpi/parser/mps/Driver.h"
 
+#include <algorithm>
 #include <iostream>
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include "delpi/util/Profiler.h"
 #include "delpi/util/error.h"
 #include "delpi/util/logging.h"
 
 namespace delpi::mps {
 
+namespace {
+
+/**
+ * Set the rhs of the `row_data` to `value`, based on its sense.
+ * @param row_data row to update
+ * @param value rhs value
+ */
+void ApplyRhs(Row &row_data, const mpq_class &value) {
+  switch (row_data.sense) {
+    case SenseType::L:
+      row_data.ub = value;
+      break;
+    case SenseType::G:
+      row_data.lb = value;
+      break;
+    case SenseType::E:
+      row_data.lb = row_data.ub = value;
+      break;
+    case SenseType::N:
+      DELPI_WARN("SenseType N is used only for objective function. No action to take");
+      break;
+    default:
+      DELPI_UNREACHABLE();
+  }
+}
+
+/**
+ * Apply the range `value` to the `row_data`, based on its sense.
+ * @param row_data row to update
+ * @param value range value
+ * @see MpsDriver::AddRange
+ */
+void ApplyRange(Row &row_data, mpq_class value) {
+  switch (row_data.sense) {
+    case SenseType::L:
+      mpq_abs(value.get_mpq_t(), value.get_mpq_t());
+      row_data.lb = row_data.ub.value_or(0) - value;
+      break;
+    case SenseType::G:
+      mpq_abs(value.get_mpq_t(), value.get_mpq_t());
+      row_data.ub = row_data.lb.value_or(0) + value;
+      break;
+    case SenseType::E:
+      if (value > 0) {
+        row_data.ub = row_data.ub.value_or(0) + value;
+      } else {
+        row_data.lb = row_data.lb.value_or(0) + value;
+      }
+      break;
+    case SenseType::N:
+      DELPI_WARN("SenseType N is used only for objective function. No action to take");
+      break;
+    default:
+      DELPI_UNREACHABLE();
+  }
+}
+
+/**
+ * Apply the bound of type `bound_type` with the given `value` to the `column_data`.
+ * @param column_data column to update
+ * @param bound_type bound type. Must be one of UP, UI, LO, LI or FX
+ * @param value bound value
+ */
+void ApplyBound(Column &column_data, const BoundType bound_type, const mpq_class &value) {
+  switch (bound_type) {
+    case BoundType::UP:
+    case BoundType::UI:
+      column_data.ub = value;
+      break;
+    case BoundType::LO:
+    case BoundType::LI:
+      column_data.lb = value;
+      break;
+    case BoundType::FX:
+      column_data.lb = column_data.ub = value;
+      break;
+    default:
+      DELPI_UNREACHABLE();
+  }
+}
+
+/**
+ * Apply the bound of type `bound_type`, which does not require a value, to the `column_data`.
+ * @param column_data column to update
+ * @param bound_type bound type. Must be one of BV, FR, MI or PL
+ */
+void ApplyBound(Column &column_data, const BoundType bound_type) {
+  switch (bound_type) {
+    case BoundType::BV:
+      column_data.lb = 0;
+      column_data.ub = 1;
+      break;
+    case BoundType::FR:
+    case BoundType::MI:
+      column_data.is_infinite_lb = true;
+      break;
+    case BoundType::PL:
+      DELPI_DEBUG("Infinity bound, no action to take");
+      break;
+    default:
+      DELPI_UNREACHABLE();
+  }
+}
+
+}  // namespace
+
 MpsDriver::MpsDriver(LpSolver &lp_solver) : Driver{lp_solver, "MpsDriver"} {}
 
 bool MpsDriver::ParseStreamCore(std::istream &in) {
@@ -90,26 +204,26 @@ void MpsDriver::AddColumn(const std::string &column, const std::string &row, mpq
   DELPI_TRACE_FMT("Updated row {}", row);
 }
 
+template <class Entry>
+bool MpsDriver::RecordScenarioEntry(std::vector<EntrySet<Entry>> &sets, const std::string &name, Entry entry) {
+  auto it = std::ranges::find(sets, name, &EntrySet<Entry>::first);
+  if (it == sets.end()) {
+    DELPI_DEBUG_FMT("Driver::RecordScenarioEntry: new set {}", name);
+    it = sets.insert(it, {name, {}});
+  }
+  it->second.push_back(std::move(entry));
+  return it == sets.begin();
+}
+
 void MpsDriver::AddRhs(const std::string &rhs, const std::string &row, mpq_class value) {
   DELPI_TRACE_FMT("Driver::AddRhs {} {} {}", rhs, row, value);
+  if (config().scenarios()) {
+    if (!rows_.contains(row)) DELPI_RUNTIME_ERROR_FMT("Row {} not found", row);
+    if (!RecordScenarioEntry(rhs_sets_, rhs, RhsEntry{row, value})) return;
+  }
   if (!VerifyStrictRhs(rhs)) return;
   try {
-    switch (Row &row_data = rows_.at(row); row_data.sense) {
-      case SenseType::L:
-        row_data.ub = value;
-        break;
-      case SenseType::G:
-        row_data.lb = value;
-        break;
-      case SenseType::E:
-        row_data.lb = row_data.ub = value;
-        break;
-      case SenseType::N:
-        DELPI_WARN("SenseType N is used only for objective function. No action to take");
-        break;
-      default:
-        DELPI_UNREACHABLE();
-    }
+    ApplyRhs(rows_.at(row), value);
   } catch (const std::out_of_range &) {
     DELPI_RUNTIME_ERROR_FMT("Row {} not found", row);
   }
@@ -120,53 +234,23 @@ void MpsDriver::AddRange(const std::string &rhs, const std::string &row, mpq_cla
   DELPI_TRACE_FMT("Driver::AddRange {} {} {}", rhs, row, value);
   if (!VerifyStrictRhs(rhs)) return;
   try {
-    switch (Row &row_data = rows_.at(row); row_data.sense) {
-      case SenseType::L:
-        mpq_abs(value.get_mpq_t(), value.get_mpq_t());
-        row_data.lb = row_data.ub.value_or(0) - value;
-        break;
-      case SenseType::G:
-        mpq_abs(value.get_mpq_t(), value.get_mpq_t());
-        row_data.ub = row_data.lb.value_or(0) + value;
-        break;
-      case SenseType::E:
-        if (value > 0) {
-          *row_data.ub += value;
-        } else {
-          *row_data.lb += value;
-        }
-        break;
-      case SenseType::N:
-        DELPI_WARN("SenseType N is used only for objective function. No action to take");
-        break;
-      default:
-        DELPI_UNREACHABLE();
-    }
+    ApplyRange(rows_.at(row), value);
   } catch (const std::out_of_range &) {
     DELPI_RUNTIME_ERROR_FMT("Row {} not found", row);
   }
+  if (config().scenarios()) ranges_.push_back({row, std::move(value)});
 }
 
 void MpsDriver::AddBound(const BoundType bound_type, const std::string &bound, const std::string &column,
                          mpq_class value) {
   DELPI_TRACE_FMT("Driver::AddBound {} {} {} {}", bound_type, bound, column, value);
+  if (config().scenarios()) {
+    if (!columns_.contains(column)) DELPI_RUNTIME_ERROR_FMT("Column {} not found", column);
+    if (!RecordScenarioEntry(bound_sets_, bound, BoundEntry{bound_type, column, value})) return;
+  }
   if (!VerifyStrictBound(bound)) return;
   try {
-    switch (Column &column_data = columns_.at(column); bound_type) {
-      case BoundType::UP:
-      case BoundType::UI:
-        column_data.ub = value;
-        break;
-      case BoundType::LO:
-      case BoundType::LI:
-        column_data.lb = value;
-        break;
-      case BoundType::FX:
-        column_data.lb = column_data.ub = value;
-        break;
-      default:
-        DELPI_UNREACHABLE();
-    }
+    ApplyBound(columns_.at(column), bound_type, value);
   } catch (const std::out_of_range &) {
     DELPI_RUNTIME_ERROR_FMT("Column {} not found", column);
   }
@@ -176,23 +260,13 @@ void MpsDriver::AddBound(const BoundType bound_type, const std::string &bound, c
 
 void MpsDriver::AddBound(const BoundType bound_type, const std::string &bound, const std::string &column) {
   DELPI_TRACE_FMT("Driver::AddBound {} {} {}", bound_type, bound, column);
+  if (config().scenarios()) {
+    if (!columns_.contains(column)) DELPI_RUNTIME_ERROR_FMT("Column {} not found", column);
+    if (!RecordScenarioEntry(bound_sets_, bound, BoundEntry{bound_type, column, std::nullopt})) return;
+  }
   if (!VerifyStrictBound(bound)) return;
   try {
-    switch (Column &column_data = columns_.at(column); bound_type) {
-      case BoundType::BV:
-        column_data.lb = 0;
-        column_data.ub = 1;
-        break;
-      case BoundType::FR:
-      case BoundType::MI:
-        column_data.is_infinite_lb = true;
-        break;
-      case BoundType::PL:
-        DELPI_DEBUG("Infinity bound, no action to take");
-        break;
-      default:
-        DELPI_UNREACHABLE();
-    }
+    ApplyBound(columns_.at(column), bound_type);
   } catch (const std::out_of_range &) {
     DELPI_RUNTIME_ERROR_FMT("Column {} not found", column);
   }
@@ -200,27 +274,47 @@ void MpsDriver::AddBound(const BoundType bound_type, const std::string &bound, c
   DELPI_TRACE_FMT("Updated bound {}", column);
 }
 
+mpq_class MpsDriver::ParseRational(const std::string_view number) {
+  Profiler &profiler = lp_solver_.m_profiler();
+  const ProfilerGuard profiler_guard{profiler, "rationals"};
+  profiler.Count("rationals");
+  return gmp::StringToMpq(number);
+}
+
+mpq_class MpsDriver::ColumnLowerBound(const Column &column_data) const {
+  // The lower bound is either
+  // - set explicitly
+  // - negative infinity if an infinite bound has been encountered or the upper bound is negative
+  // - 0 otherwise
+  if (column_data.lb.has_value()) return column_data.lb.value();
+  if (column_data.is_infinite_lb || column_data.ub.value_or(0) < 0) return lp_solver_.ninfinity();
+  return 0;
+}
+
 void MpsDriver::End() {
   DELPI_DEBUG_FMT("Driver::EndData reached end of file {}", problem_name_);
   DELPI_DEBUG_FMT("Found {} variables and {} constraints", columns_.size(), rows_.size());
+  Profiler &profiler = lp_solver_.m_profiler();
+  const ProfilerGuard profiler_guard{profiler, "build"};
+  profiler.Count("columns", columns_.size());
+  std::unordered_map<std::string, LpSolver::ColumnIndex> column_indices;
+  std::unordered_map<std::string, LpSolver::RowIndex> row_indices;
   for (const auto &[name, column_data] : columns_) {
-    // The lower bound is either
-    // - set explicitly
-    // - negative infinity if an infinite bound has been encountered or the upper bound is negative
-    // - 0 otherwise
-    const mpq_class &lb = column_data.lb.has_value()                                     ? column_data.lb.value()
-                          : column_data.is_infinite_lb || column_data.ub.value_or(0) < 0 ? lp_solver_.ninfinity()
-                                                                                         : 0;
-    lp_solver_.AddColumn(column_data.var, lb, column_data.ub.value_or(lp_solver_.infinity()));
-  }
-  for (const auto &[row, row_data] : rows_) {
+    const LpSolver::ColumnIndex column_idx = lp_solver_.AddColumn(
+        column_data.var, ColumnLowerBound(column_data), column_data.ub.value_or(lp_solver_.infinity()));
+    if (config().scenarios()) column_indices.emplace(name, column_idx);
+  }
+  for (auto &[row, row_data] : rows_) {
     if (row_data.addends.empty()) continue;  // No point in adding empty rows
     if (row_data.sense != SenseType::N && !row_data.lb.has_value() && !row_data.ub.has_value()) {
       DELPI_TRACE_FMT("Row {} has no RHS. Adding 0", row);
-      AddRhs(rhs_name_, row, 0);
+      ApplyRhs(row_data, 0);
     }
-    lp_solver_.AddRow(row_data.addends, row_data.lb.value_or(lp_solver_.ninfinity()),
-                      row_data.ub.value_or(lp_solver_.infinity()));
+    const LpSolver::RowIndex row_idx = lp_solver_.AddRow(row_data.addends, row_data.lb.value_or(lp_solver_.ninfinity()),
+                                                         row_data.ub.value_or(lp_solver_.infinity()));
+    if (config().scenarios() && row_data.sense != SenseType::N) row_indices.emplace(row, row_idx);
+    profiler.Count("rows");
+    profiler.Count("nnz", row_data.addends.size());
   }
 
   if (is_min_) {
@@ -228,6 +322,83 @@ void MpsDriver::End() {
   } else {
     lp_solver_.Maximise(obj_);
   }
+
+  if (config().scenarios()) AddScenarios(row_indices, column_indices);
+}
+
+void MpsDriver::AddScenarios(const std::unordered_map<std::string, LpSolver::RowIndex> &row_indices,
+                             const std::unordered_map<std::string, LpSolver::ColumnIndex> &column_indices) {
+  const std::size_t num_scenarios = std::max({rhs_sets_.size(), bound_sets_.size(), std::size_t{1}});
+  DELPI_DEBUG_FMT("Driver::AddScenarios: {} rhs sets and {} bound sets make {} scenarios", rhs_sets_.size(),
+                  bound_sets_.size(), num_scenarios);
+  const ProfilerGuard profiler_guard{lp_solver_.m_profiler(), "scenarios"};
+  for (std::size_t k = 0; k < num_scenarios; ++k) {
+    // The sets missing from this scenario are the ones of the base problem
+    const EntrySet<RhsEntry> *const base_rhs_set = rhs_sets_.empty() ? nullptr : &rhs_sets_.front();
+    const EntrySet<RhsEntry> *const rhs_set = k < rhs_sets_.size() ? &rhs_sets_[k] : base_rhs_set;
+    const EntrySet<BoundEntry> *const base_bound_set = bound_sets_.empty() ? nullptr : &bound_sets_.front();
+    const EntrySet<BoundEntry> *const bound_set = k < bound_sets_.size() ? &bound_sets_[k] : base_bound_set;
+
+    Scenario scenario;
+    scenario.name = rhs_set == nullptr ? "" : rhs_set->first;
+    if (bound_set != nullptr) scenario.name += (scenario.name.empty() ? "" : "/") + bound_set->first;
+    if (scenario.name.empty()) scenario.name = "base";
+
+    // Only the rows appearing in either rhs set can differ from the base problem.
+    // They are rebuilt from scratch, in the same order used for the base problem
+    std::map<std::string, Row> scenario_rows;
+    for (const EntrySet<RhsEntry> *const set : {base_rhs_set, rhs_set}) {
+      if (set == nullptr) continue;
+      for (const RhsEntry &entry : set->second) {
+        if (row_indices.contains(entry.row)) scenario_rows.try_emplace(entry.row, rows_.at(entry.row).sense);
+      }
+    }
+    if (rhs_set != nullptr) {
+      for (const RhsEntry &entry : rhs_set->second) {
+        if (const auto it = scenario_rows.find(entry.row); it != scenario_rows.end()) ApplyRhs(it->second, entry.value);
+      }
+    }
+    for (const RhsEntry &entry : ranges_) {
+      if (const auto it = scenario_rows.find(entry.row); it != scenario_rows.end()) ApplyRange(it->second, entry.value);
+    }
+    for (auto &[name, row_data] : scenario_rows) {
+      if (!row_data.lb.has_value() && !row_data.ub.has_value()) ApplyRhs(row_data, 0);
+      const Row &base = rows_.at(name);
+      if (row_data.lb != base.lb || row_data.ub != base.ub) {
+        scenario.rows.push_back({row_indices.at(name), std::move(row_data.lb), std::move(row_data.ub)});
+      }
+    }
+
+    // Same for the columns appearing in either bound set
+    std::map<std::string, Column> scenario_columns;
+    for (const EntrySet<BoundEntry> *const set : {base_bound_set, bound_set}) {
+      if (set == nullptr) continue;
+      for (const BoundEntry &entry : set->second) {
+        scenario_columns.try_emplace(entry.column, columns_.at(entry.column).var);
+      }
+    }
+    if (bound_set != nullptr) {
+      for (const BoundEntry &entry : bound_set->second) {
+        Column &column_data = scenario_columns.at(entry.column);
+        if (entry.value.has_value()) {
+          ApplyBound(column_data, entry.type, entry.value.value());
+        } else {
+          ApplyBound(column_data, entry.type);
+        }
+      }
+    }
+    for (const auto &[name, column_data] : scenario_columns) {
+      const Column &base = columns_.at(name);
+      mpq_class lb{ColumnLowerBound(column_data)};
+      if (lb == ColumnLowerBound(base) && column_data.ub == base.ub) continue;
+      scenario.columns.push_back({column_indices.at(name),
+                                  lb == lp_solver_.ninfinity() ? std::nullopt : std::optional{std::move(lb)},
+                                  column_data.ub});
+    }
+
+    DELPI_TRACE_FMT("Driver::AddScenarios: {}", scenario);
+    lp_solver_.AddScenario(std::move(scenario));
+  }
 }
 
 }  // namespace delpi::mps
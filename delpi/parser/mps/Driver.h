@@ -10,7 +10,9 @@
 
 #include <istream>
 #include <map>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -106,6 +108,8 @@ class MpsDriver : public Driver {
    * using the sense of the row.
    * If strict_mps_ is true and multiple rhs are found,
    * only the first one is considered, the others are skipped.
+   * If Config::scenarios is true, each rhs is recorded as part of a scenario,
+   * and only the first one is used in the base problem.
    * In the mps file, an RHS line is defined by:
    *
    *    | Field1 | Field2 | Field3 | Field4       | Field5 | Field6       |
@@ -149,6 +153,8 @@ class MpsDriver : public Driver {
    * Add a bound to a variable (column).
    * If strict_mps_ is true and multiple bounds are found,
    * only the first one is considered, the others are skipped.
+   * If Config::scenarios is true, each bound is recorded as part of a scenario,
+   * and only the first one is used in the base problem.
    * In the mps file, a bound line is defined by:
    *
    *   | Field1     | Field2 | Field3 | Field4 | Field5 | Field6 |
@@ -167,6 +173,8 @@ class MpsDriver : public Driver {
    * The value is not present, for it is inferred from the bound type.
    * If strict_mps_ is true and multiple bounds are found,
    * only the first one is considered, the others are skipped.
+   * If Config::scenarios is true, each bound is recorded as part of a scenario,
+   * and only the first one is used in the base problem.
    * In the mps file, a bound line is defined by:
    *
    *   | Field1     | Field2 | Field3 | Field4 | Field5 | Field6 |
@@ -179,9 +187,18 @@ class MpsDriver : public Driver {
    */
   void AddBound(BoundType bound_type, const std::string &bound, const std::string &column);
 
+  /**
+   * Convert the `number` found in the input to a rational.
+   * @param number string representation of the number
+   * @return rational value of the number
+   * @see gmp::StringToMpq
+   */
+  mpq_class ParseRational(std::string_view number);
+
   /**
    * Called when the parser has reached the `ENDATA` section.
    * It finalizes the constraint, adding the default lower bound if needed, and launches the solver.
+   * If Config::scenarios is true, the scenarios are added to the LP solver as well.
    */
   void End();
 
@@ -206,6 +223,55 @@ class MpsDriver : public Driver {
   [[nodiscard]] MpsScanner *scanner() { return scanner_; }
 
  private:
+  /** Entry of an rhs or range set. */
+  struct RhsEntry {
+    std::string row;  ///< Name of the row
+    mpq_class value;  ///< Value of the rhs or range
+  };
+  /** Entry of a bound set. */
+  struct BoundEntry {
+    BoundType type;                  ///< Type of the bound
+    std::string column;              ///< Name of the column
+    std::optional<mpq_class> value;  ///< Value of the bound, if the type requires one
+  };
+  /**
+   * Named set of entries, in the order they appear in the file.
+   * @tparam Entry type of the entries
+   */
+  template <class Entry>
+  using EntrySet = std::pair<std::string, std::vector<Entry>>;
+
+  /**
+   * Record the `entry` as part of the set with the given `name`, creating it if it is the first time it is seen.
+   * @tparam Entry type of the entries
+   * @param sets sets recorded so far, in order of appearance
+   * @param name name of the set the entry belongs to
+   * @param entry entry to record
+   * @return true if the entry belongs to the first set, the one used in the base problem
+   * @return false if the entry belongs to any other set
+   */
+  template <class Entry>
+  static bool RecordScenarioEntry(std::vector<EntrySet<Entry>> &sets, const std::string &name, Entry entry);
+
+  /**
+   * Compute the lower bound of the `column_data` in the LP problem.
+   * @param column_data column parsed from the file
+   * @return lower bound of the column
+   */
+  [[nodiscard]] mpq_class ColumnLowerBound(const Column &column_data) const;
+
+  /**
+   * Build a scenario for each rhs and bound set and add them to the LP solver.
+   *
+   * The k-th scenario pairs the k-th rhs set with the k-th bound set, or the first one if there are fewer sets.
+   * Only the rows and columns whose bounds differ from the ones of the base problem are part of a scenario.
+   * The ranges are the ones of the base problem.
+   * @param row_indices index of each row of the LP problem that can be part of a scenario
+   * @param column_indices index of each column of the LP problem
+   */
+  void AddScenarios(const std::unordered_map<std::string, LpSolver::RowIndex> &row_indices,
+                    const std::unordered_map<std::string, LpSolver::ColumnIndex> &column_indices);
+
   /**
    * If @ref strict_mps_ is true, keeps track of the name of the first `rhs` found.
    * All the other rhs must have the same name, otherwise they are skipped.
@@ -240,6 +306,10 @@ class MpsDriver : public Driver {
 
   std::string rhs_name_;    ///< The name of the first rhs found. Used if strict_mps_ is true.
   std::string bound_name_;  ///< The name of the first bound found. Used if strict_mps_ is true.
+
+  std::vector<EntrySet<RhsEntry>> rhs_sets_;      ///< All the rhs sets. Used if Config::scenarios is true.
+  std::vector<EntrySet<BoundEntry>> bound_sets_;  ///< All the bound sets. Used if Config::scenarios is true.
+  std::vector<RhsEntry> ranges_;  ///< Ranges of the base problem. Used if Config::scenarios is true.
 };
 
 }  // namespace delpi::mps
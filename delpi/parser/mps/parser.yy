@@ -13,8 +13,6 @@
 #include "delpi/parser/mps/BoundType.h"
 #include "delpi/util/error.h"
 
-using delpi::gmp::StringToMpq;
-
 /* void yyerror(SmtPrsr parser, const char *); */
 #define YYMAXDEPTH 1024 * 1024
 %}
@@ -160,11 +158,11 @@ columns: columns column
         Field 6: Value of matrix coefficient specified by Fields 2 and 5 (optional)
     */
 column: SYMBOL SYMBOL SYMBOL SYMBOL SYMBOL '\n' { 
-        driver.AddColumn($1, $2, mpq_class{StringToMpq($3)});
-        driver.AddColumn($1, $4, mpq_class{StringToMpq($5)});
+        driver.AddColumn($1, $2, driver.ParseRational($3));
+        driver.AddColumn($1, $4, driver.ParseRational($5));
     }
     | SYMBOL SYMBOL SYMBOL '\n' { 
-        driver.AddColumn($1, $2, mpq_class{StringToMpq($3)});
+        driver.AddColumn($1, $2, driver.ParseRational($3));
     }
     | SYMBOL QUOTED_SYMBOL QUOTED_SYMBOL '\n' { }
     | command
@@ -187,18 +185,18 @@ rhs: rhs rhs_row
         Field 6: Value of RHS coefficient specified by Field 2 and 5 (optional)
     */
 rhs_row: SYMBOL SYMBOL SYMBOL SYMBOL SYMBOL '\n' { 
-        driver.AddRhs($1, $2, mpq_class{StringToMpq($3)});
-        driver.AddRhs($1, $4, mpq_class{StringToMpq($5)});
+        driver.AddRhs($1, $2, driver.ParseRational($3));
+        driver.AddRhs($1, $4, driver.ParseRational($5));
     }
     | SYMBOL SYMBOL SYMBOL SYMBOL '\n' { 
-        driver.AddRhs("", $1, mpq_class{StringToMpq($2)});
-        driver.AddRhs("", $3, mpq_class{StringToMpq($4)});
+        driver.AddRhs("", $1, driver.ParseRational($2));
+        driver.AddRhs("", $3, driver.ParseRational($4));
     }
     | SYMBOL SYMBOL SYMBOL '\n' { 
-        driver.AddRhs($1, $2, mpq_class{StringToMpq($3)});
+        driver.AddRhs($1, $2, driver.ParseRational($3));
     }
     | SYMBOL SYMBOL '\n' { 
-        driver.AddRhs("", $1, mpq_class{StringToMpq($2)});
+        driver.AddRhs("", $1, driver.ParseRational($2));
     }
     | command
     | '\n'
@@ -220,11 +218,11 @@ ranges: ranges range
         Field 6: Value of the range applied to row specified by Field 5 (optional)
     */
 range: SYMBOL SYMBOL SYMBOL SYMBOL SYMBOL '\n' { 
-        driver.AddRange($1, $2, mpq_class{StringToMpq($3)});
-        driver.AddRange($1, $4, mpq_class{StringToMpq($5)});
+        driver.AddRange($1, $2, driver.ParseRational($3));
+        driver.AddRange($1, $4, driver.ParseRational($5));
     }
     | SYMBOL SYMBOL SYMBOL '\n' { 
-        driver.AddRange($1, $2, mpq_class{StringToMpq($3)});
+        driver.AddRange($1, $2, driver.ParseRational($3));
     }
     | command
     | '\n'
@@ -251,10 +249,10 @@ bounds: bounds bound
         Fields 5 and 6 are not used in the BOUNDS section.
     */
 bound: BOUND_TYPE SYMBOL SYMBOL SYMBOL '\n' { 
-        driver.AddBound($1, $2, $3, mpq_class{StringToMpq($4)});
+        driver.AddBound($1, $2, $3, driver.ParseRational($4));
     }
     | BOUND_TYPE SYMBOL SYMBOL '\n' { 
-        driver.AddBound($1, "", $2, mpq_class{StringToMpq($3)});
+        driver.AddBound($1, "", $2, driver.ParseRational($3));
     }
     | BOUND_TYPE_SINGLE SYMBOL SYMBOL SYMBOL '\n' { 
         driver.AddBound($1, $2, $3);
@@ -0,0 +1,359 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/server/Server.h"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <exception>
+#include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#ifdef DELPI_ENABLED_QSOPTEX
+#include "delpi/libs/qsopt_ex.h"
+#endif
+#include "delpi/libs/gmp.h"
+#include "delpi/solver/LpSolver.h"
+#include "delpi/util/error.h"
+#include "delpi/util/logging.h"
+
+namespace delpi {
+
+namespace {
+
+/**
+ * Compute the number of workers the server can safely use.
+ * Without a thread safe build, the symbolic layer cannot be shared among threads,
+ * while QSopt_ex relies on global state when building, parsing and solving a problem, no matter the build.
+ * @param config configuration of the server
+ * @return number of worker threads
+ */
+unsigned int NumWorkers(const Config &config) {
+#ifdef DELPI_THREAD_SAFE
+  if (config.lp_solver() == Config::LpSolver::QSOPTEX && config.number_of_jobs() > 1) {
+    DELPI_WARN_FMT("Server: {} jobs requested, but QSopt_ex cannot solve problems in parallel. Using 1",
+                   config.number_of_jobs());
+    return 1;
+  }
+  return config.number_of_jobs();
+#else
+  if (config.number_of_jobs() > 1)
+    DELPI_WARN_FMT("Server: {} jobs requested, but delpi has not been built with --enable_thread_safe_build. Using 1",
+                   config.number_of_jobs());
+  return 1;
+#endif
+}
+
+/** Minimal buffered reader over a file descriptor. */
+class FdReader {
+ public:
+  explicit FdReader(const int fd) : fd_{fd} {}
+
+  /**
+   * Read a line from the file descriptor, discarding the newline.
+   * @param[out] line line read
+   * @return true if a line has been read
+   * @return false if the input has been closed before a newline was found
+   */
+  bool ReadLine(std::string &line) {
+    line.clear();
+    while (true) {
+      const std::size_t newline = buffer_.find('\n', pos_);
+      if (newline != std::string::npos) {
+        line.append(buffer_, pos_, newline - pos_);
+        pos_ = newline + 1;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        return true;
+      }
+      line.append(buffer_, pos_, std::string::npos);
+      pos_ = buffer_.size();
+      if (!Fill()) return false;
+    }
+  }
+
+  /**
+   * Read exactly `size` bytes from the file descriptor.
+   * @param size number of bytes to read
+   * @param[out] data bytes read
+   * @return true if all the bytes have been read
+   * @return false if the input has been closed too early
+   */
+  bool ReadExact(const std::size_t size, std::string &data) {
+    data.clear();
+    // The buffer grows as the data arrives, so a size the input never delivers does not allocate anything
+    while (data.size() < size) {
+      if (pos_ == buffer_.size() && !Fill()) return false;
+      const std::size_t chunk = std::min(size - data.size(), buffer_.size() - pos_);
+      data.append(buffer_, pos_, chunk);
+      pos_ += chunk;
+    }
+    return true;
+  }
+
+ private:
+  /**
+   * Replace the consumed buffer with new data from the file descriptor.
+   * @return true if some data has been read
+   * @return false if the input has been closed or an error occurred
+   */
+  bool Fill() {
+    buffer_.resize(buffer_size);
+    pos_ = 0;
+    ssize_t n;
+    do {
+      n = read(fd_, buffer_.data(), buffer_.size());
+    } while (n < 0 && errno == EINTR);
+    buffer_.resize(n > 0 ? static_cast<std::size_t>(n) : 0);
+    return n > 0;
+  }
+
+  static constexpr std::size_t buffer_size = 1 << 16;
+  const int fd_;
+  std::string buffer_;
+  std::size_t pos_{0};
+};
+
+/**
+ * Write all the `data` to the file descriptor `fd`, making sure concurrent writers do not interleave.
+ * @param fd file descriptor to write to
+ * @param mutex mutex guarding the file descriptor
+ * @param data data to write
+ */
+void WriteAll(const int fd, std::mutex &mutex, const std::string &data) {
+  std::lock_guard<std::mutex> lock{mutex};
+  std::size_t written = 0;
+  while (written < data.size()) {
+    const ssize_t n = write(fd, data.data() + written, data.size() - written);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) {
+      DELPI_ERROR_FMT("Server: failed to write the response: {}", std::strerror(errno));
+      return;
+    }
+    written += static_cast<std::size_t>(n);
+  }
+}
+
+}  // namespace
+
+Server::Server(Config config) : config_{std::move(config)}, pool_{NumWorkers(config_)} {
+  // Requests do not carry a filename, so the format cannot be deduced from the extension
+  if (config_.format() == Config::Format::AUTO) config_.m_format() = Config::Format::MPS;
+#ifdef DELPI_ENABLED_QSOPTEX
+  // Keep the library initialised for the whole lifetime of the server instead of once per request
+  if (config_.lp_solver() == Config::LpSolver::QSOPTEX) qsopt_ex::QSXStart();
+#endif
+  DELPI_DEBUG_FMT("Server::Server: {} workers", pool_.size());
+}
+
+Server::~Server() {
+  pool_.Wait();
+#ifdef DELPI_ENABLED_QSOPTEX
+  if (config_.lp_solver() == Config::LpSolver::QSOPTEX) qsopt_ex::QSXFinish();
+#endif
+}
+
+int Server::Run() {
+  // The standard output may carry the responses, which must not be interleaved with the logs
+  DELPI_LOG_OUT_TO_STDERR();
+  if (config_.server_socket().empty()) {
+    DELPI_INFO("Server::Run: reading requests from the standard input");
+    Serve(STDIN_FILENO, STDOUT_FILENO);
+    return 0;
+  }
+  return ServeSocket();
+}
+
+void Server::Serve(const int in_fd, const int out_fd) {
+  FdReader reader{in_fd};
+  std::mutex out_mutex;
+  std::vector<std::future<void>> pending;
+  std::string header;
+  while (reader.ReadLine(header)) {
+    if (header.empty()) continue;
+    ServerRequest request;
+    try {
+      request = ParseRequestHeader(header);
+    } catch (const DelpiException &ex) {
+      WriteAll(out_fd, out_mutex, FormatResponse({"-", LpResult::ERROR, ex.what()}));
+      break;
+    }
+    if (!reader.ReadExact(request.size, request.payload)) {
+      WriteAll(out_fd, out_mutex, FormatResponse({request.id, LpResult::ERROR, "Truncated payload"}));
+      break;
+    }
+    DELPI_DEBUG_FMT("Server::Serve: received {}", request);
+    pending.emplace_back(pool_.Submit([this, request = std::move(request), out_fd, &out_mutex]() {
+      WriteAll(out_fd, out_mutex, FormatResponse(Process(request)));
+    }));
+    // Forget about the requests that have already been answered
+    std::erase_if(pending, [](const std::future<void> &f) {
+      return f.wait_for(std::chrono::seconds::zero()) == std::future_status::ready;
+    });
+  }
+  for (std::future<void> &f : pending) f.wait();
+}
+
+ServerResponse Server::Process(const ServerRequest &request) {
+  ServerResponse response{request.id, LpResult::ERROR, ""};
+  try {
+    const std::unique_ptr<LpSolver> lp_solver{LpSolver::GetInstance(config_)};
+    for (const auto &[key, value] : request.options) lp_solver->SetOption(":" + key, value);
+
+    mpq_class obj_lb, obj_ub;
+    lp_solver->m_solve_cb() = [&obj_lb, &obj_ub](const LpSolver &, LpResult, const std::vector<mpq_class> &,
+                                                 const std::vector<mpq_class> &, const mpq_class &lb,
+                                                 const mpq_class &ub, const mpq_class &) {
+      obj_lb = lb;
+      obj_ub = ub;
+    };
+
+    if (!lp_solver->ParseString(request.payload)) {
+      response.body = "Error parsing the input";
+      return response;
+    }
+
+    mpq_class precision{lp_solver->config().precision()};
+    response.result = lp_solver->Solve(precision);
+
+    if (response.result == LpResult::OPTIMAL || response.result == LpResult::DELTA_OPTIMAL) {
+      std::ostringstream body;
+      body << "objective " << obj_lb << " " << obj_ub << "\n";
+      if (lp_solver->config().produce_models()) {
+        for (const Variable &var : lp_solver->variables()) body << var << " " << lp_solver->solution(var) << "\n";
+      }
+      response.body = body.str();
+    }
+  } catch (const DelpiException &ex) {
+    // Must come first, since some delpi exceptions are ambiguous std::exception
+    response.result = LpResult::ERROR;
+    response.body = ex.what();
+  } catch (const std::exception &ex) {
+    response.result = LpResult::ERROR;
+    response.body = ex.what();
+  }
+  return response;
+}
+
+ServerRequest Server::ParseRequestHeader(const std::string &header) {
+  std::istringstream iss{header};
+  ServerRequest request;
+  std::string size;
+  if (!(iss >> request.id >> size)) DELPI_INVALID_ARGUMENT("request header", "expected '<id> <payload-size>'");
+  if (size.empty() || size.find_first_not_of("0123456789") != std::string::npos)
+    DELPI_INVALID_ARGUMENT("request header", fmt::format("invalid payload size '{}'", size));
+  try {
+    request.size = std::stoull(size);
+  } catch (const std::out_of_range &) {
+    request.size = std::numeric_limits<std::size_t>::max();
+  }
+  if (request.size > max_payload_size)
+    DELPI_INVALID_ARGUMENT("request header",
+                           fmt::format("payload size '{}' exceeds the maximum of {} bytes", size, max_payload_size));
+  std::string option;
+  while (iss >> option) {
+    const std::size_t eq = option.find('=');
+    if (eq == std::string::npos || eq == 0)
+      DELPI_INVALID_ARGUMENT("request header", fmt::format("invalid option '{}', expected <key>=<value>", option));
+    request.options.emplace_back(option.substr(0, eq), option.substr(eq + 1));
+  }
+  return request;
+}
+
+std::string Server::FormatResponse(const ServerResponse &response) {
+  std::ostringstream oss;
+  oss << response.id << " " << response.result << " " << response.body.size() << "\n" << response.body;
+  return oss.str();
+}
+
+int Server::ServeSocket() {
+  const std::string &path = config_.server_socket();
+  sockaddr_un address{};
+  if (path.size() >= sizeof(address.sun_path)) {
+    DELPI_ERROR_FMT("Server: socket path '{}' is too long", path);
+    return 1;
+  }
+  address.sun_family = AF_UNIX;
+  std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+  const int server_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (server_fd < 0) {
+    DELPI_ERROR_FMT("Server: cannot create the socket: {}", std::strerror(errno));
+    return 1;
+  }
+  unlink(path.c_str());
+  if (bind(server_fd, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) < 0 ||
+      listen(server_fd, SOMAXCONN) < 0) {
+    DELPI_ERROR_FMT("Server: cannot listen on '{}': {}", path, std::strerror(errno));
+    close(server_fd);
+    return 1;
+  }
+  // A client closing the connection early must not bring the whole server down
+  std::signal(SIGPIPE, SIG_IGN);
+  DELPI_INFO_FMT("Server::ServeSocket: listening on {}", path);
+
+  // Each connection runs on its own detached thread, so that no handle is kept around once it has been served
+  std::mutex connections_mutex;
+  std::condition_variable connections_cv;
+  std::size_t live_connections = 0;
+  while (true) {
+    const int connection_fd = accept(server_fd, nullptr, nullptr);
+    if (connection_fd < 0) {
+      if (errno == EINTR) continue;
+      DELPI_ERROR_FMT("Server: accept failed: {}", std::strerror(errno));
+      break;
+    }
+    {
+      const std::lock_guard<std::mutex> lock{connections_mutex};
+      ++live_connections;
+    }
+    std::thread{[this, connection_fd, &connections_mutex, &connections_cv, &live_connections]() {
+      // An exception escaping a detached thread would terminate the whole server
+      try {
+        Serve(connection_fd, connection_fd);
+      } catch (const std::exception &ex) {
+        DELPI_ERROR_FMT("Server: connection dropped: {}", ex.what());
+      }
+      close(connection_fd);
+      // Notify while holding the lock, or the waiting thread could destroy the condition variable first
+      const std::lock_guard<std::mutex> lock{connections_mutex};
+      --live_connections;
+      connections_cv.notify_all();
+    }}.detach();
+  }
+  {
+    std::unique_lock<std::mutex> lock{connections_mutex};
+    connections_cv.wait(lock, [&live_connections]() { return live_connections == 0; });
+  }
+  close(server_fd);
+  unlink(path.c_str());
+  return 1;
+}
+
+std::ostream &operator<<(std::ostream &os, const ServerRequest &request) {
+  os << "ServerRequest{id: " << request.id << ", size: " << request.size << ", options: [";
+  for (const auto &[key, value] : request.options) os << key << "=" << value << " ";
+  return os << "]}";
+}
+
+std::ostream &operator<<(std::ostream &os, const ServerResponse &response) {
+  return os << "ServerResponse{id: " << response.id << ", result: " << response.result
+            << ", body-size: " << response.body.size() << "}";
+}
+
+}  // namespace delpi
@@ -0,0 +1,151 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * Server class.
+ * Persistent process that solves a stream of LP problems without paying the startup cost each time.
+ */
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "delpi/solver/LpResult.h"
+#include "delpi/util/Config.h"
+#include "delpi/util/ThreadPool.h"
+
+namespace delpi {
+
+/** Request received by the @ref Server. */
+struct ServerRequest {
+  std::string id;                                            ///< Identifier chosen by the client
+  std::size_t size{0};                                       ///< Size of the payload in bytes
+  std::vector<std::pair<std::string, std::string>> options;  ///< Options to apply before parsing the payload
+  std::string payload;                                       ///< Problem to solve, in the configured format
+};
+
+/** Response produced by the @ref Server. */
+struct ServerResponse {
+  std::string id;                       ///< Identifier of the request the response refers to
+  LpResult result{LpResult::UNSOLVED};  ///< Result of the LP solver
+  std::string body;                     ///< Objective, model or error message
+};
+
+/**
+ * Persistent solver daemon.
+ *
+ * The server reads framed requests from the standard input or from a UNIX socket,
+ * solves each of them on a pool of worker threads and writes back the responses as soon as they are ready.
+ * Hence, responses are not guaranteed to come in the same order as the requests.
+ *
+ * A request is made of a single header line followed by the payload
+ * ```
+ * <id> <payload-size>[ <key>=<value>]*\n
+ * <payload>
+ * ```
+ * where `<id>` is an arbitrary token without spaces, `<payload-size>` is the number of bytes of the payload and
+ * each `<key>=<value>` pair is an option applied as if it were a `@set-option :<key> <value>` in the input.
+ * The response is framed in the same way
+ * ```
+ * <id> <result> <body-size>\n
+ * <body>
+ * ```
+ * where `<result>` is the textual representation of the @ref LpResult.
+ * If the problem is feasible, the body starts with the line `objective <lb> <ub>`,
+ * followed by a `<variable> <value>` line for each variable if `produce-models` is enabled.
+ * If the result is `error`, the body contains the error message.
+ */
+class Server {
+ public:
+  /** Largest payload accepted in a request, in bytes. Larger requests are rejected before reading their payload. */
+  static constexpr std::size_t max_payload_size = std::size_t{1} << 30;
+
+  /**
+   * Construct a new Server object using the given `config` for all the requests.
+   * @param config base configuration shared by all the requests
+   */
+  explicit Server(Config config);
+  Server(const Server &) = delete;
+  Server(Server &&) = delete;
+  Server &operator=(const Server &) = delete;
+  Server &operator=(Server &&) = delete;
+  ~Server();
+
+  /**
+   * Run the server until the input is closed.
+   *
+   * If @ref Config::server_socket is empty, the requests are read from the standard input and the responses are
+   * written on the standard output.
+   * Otherwise, the server listens on the UNIX socket and accepts any number of concurrent connections.
+   * In both cases, the logs are written on the standard error.
+   * @return exit code of the server
+   */
+  int Run();
+
+  /**
+   * Serve all the requests read from the `in_fd` file descriptor, writing the responses on `out_fd`.
+   *
+   * The method returns when the input is closed and all the pending requests have been answered.
+   * If a malformed request is received, an error response is sent and the stream is abandoned,
+   * since it is impossible to resynchronise with the framing.
+   * @param in_fd file descriptor to read the requests from
+   * @param out_fd file descriptor to write the responses to
+   */
+  void Serve(int in_fd, int out_fd);
+
+  /**
+   * Solve the problem in the `request`.
+   *
+   * Any error is reported in the response, never thrown.
+   * @param request request to process
+   * @return response to the request
+   */
+  [[nodiscard]] ServerResponse Process(const ServerRequest &request);
+
+  /**
+   * Parse the header line of a request.
+   * @param header header line, without the trailing newline
+   * @return request with all the fields but the payload filled
+   * @throw DelpiInvalidArgumentException if the header is malformed or the payload is larger than
+   * @ref max_payload_size
+   */
+  [[nodiscard]] static ServerRequest ParseRequestHeader(const std::string &header);
+  /**
+   * Serialise the `response` following the framing protocol.
+   * @param response response to serialise
+   * @return framed response
+   */
+  [[nodiscard]] static std::string FormatResponse(const ServerResponse &response);
+
+  /** @getter{configuration, server} */
+  [[nodiscard]] const Config &config() const { return config_; }
+  /** @getter{number of worker threads, server} */
+  [[nodiscard]] std::size_t num_workers() const { return pool_.size(); }
+
+ private:
+  /**
+   * Listen on the UNIX socket in @ref Config::server_socket, serving each connection on its own thread.
+   * @return exit code of the server
+   */
+  int ServeSocket();
+
+  Config config_;    ///< Base configuration shared by all the requests
+  ThreadPool pool_;  ///< Workers solving the requests. A single one with QSopt_ex, which relies on global state
+};
+
+std::ostream &operator<<(std::ostream &os, const ServerRequest &request);
+std::ostream &operator<<(std::ostream &os, const ServerResponse &response);
+
+}  // namespace delpi
+
+#ifdef DELPI_INCLUDE_FMT
+
+#include "delpi/util/logging.h"
+
+OSTREAM_FORMATTER(delpi::ServerRequest)
+OSTREAM_FORMATTER(delpi::ServerResponse)
+
+#endif
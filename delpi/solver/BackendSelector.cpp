@@ -0,0 +1,155 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/solver/BackendSelector.h"
+
+#include <exception>
+#include <fstream>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "delpi/util/error.h"
+#include "delpi/util/logging.h"
+
+namespace delpi {
+
+namespace {
+
+/**
+ * Check whether the `lp_solver` supports the `lp_mode`.
+ * @param lp_solver LP solver
+ * @param lp_mode LP mode
+ * @return true if the mode is supported
+ * @return false if the mode is not supported
+ */
+bool Supports(const Config::LpSolver lp_solver, const Config::LpMode lp_mode) {
+  return lp_solver != Config::LpSolver::QSOPTEX || lp_mode == Config::LpMode::AUTO ||
+         lp_mode == Config::LpMode::PURE_PRECISION_BOOSTING;
+}
+
+/**
+ * Parse a rule from a line of the CSV file.
+ * @param line line with the five fields of the rule
+ * @param line_number number of the line, for error reporting
+ * @return rule in the line
+ */
+BackendSelector::Rule ParseRule(const std::string& line, const std::size_t line_number) {
+  std::vector<std::string> fields;
+  std::stringstream ss{line};
+  for (std::string field; std::getline(ss, field, ',');) fields.push_back(field);
+  if (!line.empty() && line.back() == ',') fields.emplace_back();
+  if (fields.size() != 5) DELPI_RUNTIME_ERROR_FMT("Line {}: expected 5 fields, found {}", line_number, fields.size());
+
+  BackendSelector::Rule rule{std::nullopt, true, 0, Config::LpSolver::SOPLEX, Config::LpMode::AUTO};
+  if (!fields[0].empty()) {
+    rule.feature = ModelFeatures::FromName(fields[0]);
+    if (!rule.feature.has_value()) DELPI_RUNTIME_ERROR_FMT("Line {}: unknown feature '{}'", line_number, fields[0]);
+    if (fields[1] != "<" && fields[1] != ">=")
+      DELPI_RUNTIME_ERROR_FMT("Line {}: comparison must be '<' or '>=', found '{}'", line_number, fields[1]);
+    rule.at_least = fields[1] == ">=";
+    try {
+      rule.threshold = std::stod(fields[2]);
+    } catch (const std::exception&) {
+      DELPI_RUNTIME_ERROR_FMT("Line {}: invalid threshold '{}'", line_number, fields[2]);
+    }
+  }
+
+  if (fields[3] == "soplex") {
+    rule.lp_solver = Config::LpSolver::SOPLEX;
+  } else if (fields[3] == "qsoptex") {
+    rule.lp_solver = Config::LpSolver::QSOPTEX;
+  } else {
+    DELPI_RUNTIME_ERROR_FMT("Line {}: LP solver must be 'soplex' or 'qsoptex', found '{}'", line_number, fields[3]);
+  }
+
+  if (fields[4] == "auto") {
+    rule.lp_mode = Config::LpMode::AUTO;
+  } else if (fields[4] == "pure-precision-boosting") {
+    rule.lp_mode = Config::LpMode::PURE_PRECISION_BOOSTING;
+  } else if (fields[4] == "pure-iterative-refinement") {
+    rule.lp_mode = Config::LpMode::PURE_ITERATIVE_REFINEMENT;
+  } else if (fields[4] == "hybrid") {
+    rule.lp_mode = Config::LpMode::HYBRID;
+  } else if (fields[4] == "float-first") {
+    rule.lp_mode = Config::LpMode::FLOAT_FIRST;
+  } else {
+    DELPI_RUNTIME_ERROR_FMT("Line {}: unknown LP mode '{}'", line_number, fields[4]);
+  }
+  if (!Supports(rule.lp_solver, rule.lp_mode))
+    DELPI_RUNTIME_ERROR_FMT("Line {}: {} does not support the LP mode '{}'", line_number, fields[3], fields[4]);
+  return rule;
+}
+
+}  // namespace
+
+bool BackendSelector::Rule::Holds(const ModelFeatures& features) const {
+  if (!feature.has_value()) return true;
+  return at_least ? features[*feature] >= threshold : features[*feature] < threshold;
+}
+
+BackendSelector::BackendSelector()
+    : BackendSelector{{
+          // Numbers this large make floating point useless, and QSopt_ex boosts the precision the fastest
+          {ModelFeatures::Feature::MAX_COMPLEXITY, true, 8, Config::LpSolver::QSOPTEX,
+           Config::LpMode::PURE_PRECISION_BOOSTING},
+          // Iterative refinement stalls on badly scaled problems
+          {ModelFeatures::Feature::LOG2_DYNAMIC_RANGE, true, 64, Config::LpSolver::SOPLEX,
+           Config::LpMode::PURE_PRECISION_BOOSTING},
+          // If the floating-point problem is the actual one, its optimal basis is likely to be certified right away
+          {ModelFeatures::Feature::DOUBLE_EXACT_RATIO, true, 1, Config::LpSolver::SOPLEX, Config::LpMode::FLOAT_FIRST},
+          {std::nullopt, true, 0, Config::LpSolver::SOPLEX, Config::LpMode::HYBRID},
+      }} {}
+
+BackendSelector::BackendSelector(std::vector<Rule> rules) : rules_{std::move(rules)} {
+  for ([[maybe_unused]] const Rule& rule : rules_) {
+    DELPI_ASSERT(Supports(rule.lp_solver, rule.lp_mode), "The LP solver of the rule does not support its LP mode");
+  }
+}
+
+BackendSelector::BackendSelector(std::istream& is) {
+  std::size_t line_number = 0;
+  for (std::string line; std::getline(is, line);) {
+    ++line_number;
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (line.empty() || line.front() == '#' || line.starts_with("feature,")) continue;
+    rules_.push_back(ParseRule(line, line_number));
+  }
+  DELPI_DEBUG_FMT("BackendSelector::BackendSelector: read {} rules", rules_.size());
+}
+
+BackendSelector BackendSelector::Load(const std::string& filename) {
+  std::ifstream in{filename};
+  if (!in) DELPI_RUNTIME_ERROR_FMT("Cannot read the rules of the LP solver selector from '{}'", filename);
+  return BackendSelector{in};
+}
+
+Config BackendSelector::Select(const ModelFeatures& features, const Config& config) const {
+  Config selected{config};
+  selected.m_lp_solver() = Config::LpSolver::SOPLEX;
+  for (const Rule& rule : rules_) {
+    if (config.lp_mode() != Config::LpMode::AUTO && !Supports(rule.lp_solver, config.lp_mode())) continue;
+    if (!rule.Holds(features)) continue;
+    DELPI_DEBUG_FMT("BackendSelector::Select: {}", rule);
+    selected.m_lp_solver() = rule.lp_solver;
+    if (config.lp_mode() == Config::LpMode::AUTO) selected.m_lp_mode() = rule.lp_mode;
+    break;
+  }
+  return selected;
+}
+
+std::ostream& operator<<(std::ostream& os, const BackendSelector::Rule& rule) {
+  os << "Rule{ ";
+  if (rule.feature.has_value()) {
+    os << *rule.feature << (rule.at_least ? " >= " : " < ") << rule.threshold;
+  } else {
+    os << "always";
+  }
+  return os << " -> " << rule.lp_solver << ", " << rule.lp_mode << " }";
+}
+
+}  // namespace delpi
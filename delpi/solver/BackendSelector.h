@@ -0,0 +1,106 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * BackendSelector class.
+ */
+#pragma once
+
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "delpi/solver/ModelFeatures.h"
+#include "delpi/util/Config.h"
+
+namespace delpi {
+
+/**
+ * Ordered table of rules picking the LP solver and the LP mode best suited for an LP problem
+ * from its @ref ModelFeatures.
+ *
+ * The rules are checked in order and the first one whose condition holds decides.
+ * If none of them does, SoPlex is used with the default mode.
+ * The table can be stored in a CSV file with the header `feature,comparison,threshold,lp_solver,lp_mode`,
+ * where `comparison` is either `<` or `>=` and an empty `feature` makes the rule always hold.
+ * Empty lines and lines starting with `#` are ignored.
+ * @code
+ * # Large coefficients make floating point useless
+ * feature,comparison,threshold,lp_solver,lp_mode
+ * max_complexity,>=,8,qsoptex,pure-precision-boosting
+ * double_exact_ratio,>=,1,soplex,float-first
+ * ,,,soplex,hybrid
+ * @endcode
+ * Such a file can be produced from benchmark results with `scripts/train_selector.py`.
+ */
+class BackendSelector {
+ public:
+  /** Rule of the table: if the feature compares to the threshold as required, the LP solver and mode are used. */
+  struct Rule {
+    std::optional<ModelFeatures::Feature> feature;  ///< Feature to check. If std::nullopt, the rule always holds
+    bool at_least;                                  ///< Whether the feature must be at least or below the threshold
+    double threshold;                               ///< Threshold the feature is compared with
+    Config::LpSolver lp_solver;                     ///< LP solver to use if the rule holds
+    Config::LpMode lp_mode;                         ///< LP mode to use if the rule holds
+
+    /**
+     * Check whether the rule holds for the given `features`.
+     * @param features features of the LP problem
+     * @return true if the rule holds
+     * @return false if the rule does not hold
+     */
+    [[nodiscard]] bool Holds(const ModelFeatures& features) const;
+  };
+
+  /** Construct a selector with the default rules. */
+  BackendSelector();
+  /**
+   * Construct a selector with the given `rules`.
+   * @param rules rules to check, in order
+   */
+  explicit BackendSelector(std::vector<Rule> rules);
+  /**
+   * Construct a selector with the rules read from the CSV `is` stream.
+   * @param is input stream in the CSV format described above
+   * @throw DelpiException if a line is malformed
+   */
+  explicit BackendSelector(std::istream& is);
+
+  /**
+   * Load the rules from the CSV file with the given `filename`.
+   * @param filename name of the file
+   * @return selector with the rules in the file
+   * @throw DelpiException if the file cannot be read or a line is malformed
+   */
+  [[nodiscard]] static BackendSelector Load(const std::string& filename);
+
+  /**
+   * Pick the LP solver and the LP mode for the problem with the given `features`.
+   *
+   * If the LP mode in the `config` is not AUTO, it is kept and rules
+   * whose LP solver does not support it are skipped.
+   * @param features features of the LP problem
+   * @param config configuration to start from
+   * @return copy of `config` with the chosen LP solver and LP mode
+   */
+  [[nodiscard]] Config Select(const ModelFeatures& features, const Config& config) const;
+
+  /** @getter{rules, selector} */
+  [[nodiscard]] const std::vector<Rule>& rules() const { return rules_; }
+
+ private:
+  std::vector<Rule> rules_;  ///< Rules to check, in order
+};
+
+std::ostream& operator<<(std::ostream& os, const BackendSelector::Rule& rule);
+
+}  // namespace delpi
+
+#ifdef DELPI_INCLUDE_FMT
+
+#include "delpi/util/logging.h"
+
+OSTREAM_FORMATTER(delpi::BackendSelector::Rule)
+
+#endif
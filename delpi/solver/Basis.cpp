@@ -0,0 +1,62 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/solver/Basis.h"
+
+#include <ostream>
+
+#include "delpi/util/error.h"
+
+namespace delpi {
+
+char toChar(const BasisStatus status) {
+  switch (status) {
+    case BasisStatus::UNDEFINED:
+      return '?';
+    case BasisStatus::BASIC:
+      return 'B';
+    case BasisStatus::AT_LOWER:
+      return 'L';
+    case BasisStatus::AT_UPPER:
+      return 'U';
+    case BasisStatus::FIXED:
+      return 'X';
+    case BasisStatus::FREE:
+      return 'F';
+    default:
+      DELPI_UNREACHABLE();
+  }
+}
+
+BasisStatus parseBasisStatus(const char status) {
+  switch (status) {
+    case '?':
+      return BasisStatus::UNDEFINED;
+    case 'B':
+      return BasisStatus::BASIC;
+    case 'L':
+      return BasisStatus::AT_LOWER;
+    case 'U':
+      return BasisStatus::AT_UPPER;
+    case 'X':
+      return BasisStatus::FIXED;
+    case 'F':
+      return BasisStatus::FREE;
+    default:
+      DELPI_INVALID_ARGUMENT_EXPECTED("basis status", status, "one of ?, B, L, U, X, F");
+  }
+}
+
+std::ostream& operator<<(std::ostream& os, const BasisStatus status) { return os << toChar(status); }
+
+std::ostream& operator<<(std::ostream& os, const Basis& basis) {
+  os << "Basis{ columns: ";
+  for (const BasisStatus status : basis.columns) os << status;
+  os << ", rows: ";
+  for (const BasisStatus status : basis.rows) os << status;
+  return os << " }";
+}
+
+}  // namespace delpi
@@ -0,0 +1,58 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * Basis struct.
+ */
+#pragma once
+
+#include <iosfwd>
+#include <vector>
+
+namespace delpi {
+
+/** Status of a column or a row in a simplex basis. */
+enum class BasisStatus {
+  UNDEFINED,  ///< The status is not known
+  BASIC,      ///< The variable is in the basis
+  AT_LOWER,   ///< The variable is non-basic and at its lower bound
+  AT_UPPER,   ///< The variable is non-basic and at its upper bound
+  FIXED,      ///< The variable is non-basic and its lower and upper bounds coincide
+  FREE,       ///< The variable is non-basic, unbounded and at zero
+};
+
+/**
+ * Simplex basis of an LP problem.
+ * If the LP solver did not produce a basis, both vectors are empty.
+ */
+struct Basis {
+  std::vector<BasisStatus> columns;  ///< Status of each column
+  std::vector<BasisStatus> rows;     ///< Status of the slack variable of each row
+};
+
+/**
+ * Convert the status to a character.
+ * @param status status to convert
+ * @return corresponding character
+ */
+char toChar(BasisStatus status);
+/**
+ * Parse the status from a character.
+ * @param status character to parse
+ * @return corresponding status
+ */
+BasisStatus parseBasisStatus(char status);
+
+std::ostream& operator<<(std::ostream& os, BasisStatus status);
+std::ostream& operator<<(std::ostream& os, const Basis& basis);
+
+}  // namespace delpi
+
+#ifdef DELPI_INCLUDE_FMT
+
+#include "delpi/util/logging.h"
+
+OSTREAM_FORMATTER(delpi::BasisStatus)
+OSTREAM_FORMATTER(delpi::Basis)
+
+#endif
@@ -0,0 +1,31 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/solver/BasisCertifier.h"
+
+#include "delpi/solver/BasisSolution.h"
+#include "delpi/util/logging.h"
+
+namespace delpi {
+
+BasisCertifier::BasisCertifier(const std::vector<Column>& columns, const std::vector<Row>& rows,
+                               const std::unordered_map<Variable, int>& var_to_col, const unsigned int num_threads)
+    : columns_{columns}, rows_{rows}, var_to_col_{var_to_col}, num_threads_{num_threads} {}
+
+std::optional<BasisCertifier::Certificate> BasisCertifier::Certify(const Basis& basis) const {
+  const BasisSolution basis_solution{columns_, rows_, var_to_col_, basis, num_threads_};
+  if (!basis_solution.optimal()) {
+    DELPI_DEBUG("BasisCertifier::Certify: the basis is not optimal");
+    return std::nullopt;
+  }
+
+  Certificate certificate{basis_solution.solution(), basis_solution.dual_solution(), mpq_class{0}};
+  for (std::size_t j = 0; j < columns_.size(); ++j) {
+    if (columns_[j].obj.has_value()) certificate.objective += *columns_[j].obj * certificate.solution[j];
+  }
+  return certificate;
+}
+
+}  // namespace delpi
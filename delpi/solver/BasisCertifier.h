@@ -0,0 +1,65 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * BasisCertifier class.
+ */
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "delpi/libs/gmp.h"
+#include "delpi/solver/Basis.h"
+#include "delpi/solver/Column.h"
+#include "delpi/solver/Row.h"
+#include "delpi/symbolic/Variable.h"
+
+namespace delpi {
+
+/**
+ * Exact certifier of the optimality of a simplex basis.
+ *
+ * Given the problem @f$ \min c^T x @f$ s.t. @f$ l_r \le A x \le u_r @f$, @f$ l_c \le x \le u_c @f$ and a basis,
+ * usually produced by a floating point simplex, the certifier computes the exact @ref BasisSolution
+ * associated with the basis and checks that it is both primal and dual feasible.
+ * If all checks pass, the basis is optimal and the solution is exact.
+ * The objective is always minimised.
+ * The columns, rows and map from the variables to the columns must outlive the certifier.
+ */
+class BasisCertifier {
+ public:
+  /** Exact primal and dual solution associated with an optimal basis. */
+  struct Certificate {
+    std::vector<mpq_class> solution;       ///< Value of each column
+    std::vector<mpq_class> dual_solution;  ///< Dual value of each row
+    mpq_class objective;                   ///< Objective value
+  };
+
+  /**
+   * Construct a new BasisCertifier object for the given problem.
+   * @param columns columns of the problem
+   * @param rows rows of the problem
+   * @param var_to_col map from the variables to the index of their column
+   * @param num_threads maximum number of threads used to factorise the basis matrix
+   */
+  BasisCertifier(const std::vector<Column>& columns, const std::vector<Row>& rows,
+                 const std::unordered_map<Variable, int>& var_to_col, unsigned int num_threads = 1);
+
+  /**
+   * Certify that the `basis` is primal and dual feasible, hence optimal.
+   * @param basis basis to certify
+   * @return exact solution associated with the basis, if it is optimal
+   * @return std::nullopt if the basis is singular, not primal feasible or not dual feasible
+   */
+  [[nodiscard]] std::optional<Certificate> Certify(const Basis& basis) const;
+
+ private:
+  const std::vector<Column>& columns_;                   ///< Columns of the problem
+  const std::vector<Row>& rows_;                         ///< Rows of the problem
+  const std::unordered_map<Variable, int>& var_to_col_;  ///< Map from the variables to the index of their column
+  const unsigned int num_threads_;  ///< Maximum number of threads used to factorise the basis matrix
+};
+
+}  // namespace delpi
@@ -0,0 +1,220 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/solver/BasisSolution.h"
+
+#include <utility>
+
+#include "delpi/util/logging.h"
+
+namespace delpi {
+
+namespace {
+
+/**
+ * Check whether `value` lies within the bounds.
+ * @param value value to check
+ * @param lb lower bound, if any
+ * @param ub upper bound, if any
+ * @return true if @f$ lb \le value \le ub @f$
+ * @return false otherwise
+ */
+bool InBounds(const mpq_class& value, const std::optional<mpq_class>& lb, const std::optional<mpq_class>& ub) {
+  return (!lb.has_value() || value >= *lb) && (!ub.has_value() || value <= *ub);
+}
+/**
+ * Check whether the dual of a tight row or the reduced cost of a non-basic column
+ * has the sign required by its `status`, unless the bounds coincide.
+ * @param status status in the basis
+ * @param value dual or reduced cost
+ * @param lb lower bound, if any
+ * @param ub upper bound, if any
+ * @return true if the sign is compatible with the status
+ * @return false otherwise
+ */
+bool SignAgrees(const BasisStatus status, const mpq_class& value, const std::optional<mpq_class>& lb,
+                const std::optional<mpq_class>& ub) {
+  if (BasisSolution::FixedBounds(lb, ub)) return true;
+  switch (status) {
+    case BasisStatus::AT_LOWER:
+      return value >= 0;
+    case BasisStatus::AT_UPPER:
+      return value <= 0;
+    case BasisStatus::FREE:
+      return value == 0;
+    default:
+      return true;
+  }
+}
+
+}  // namespace
+
+BasisSolution::BasisSolution(const std::vector<Column>& columns, const std::vector<Row>& rows,
+                             const std::unordered_map<Variable, int>& var_to_col, Basis basis,
+                             const unsigned int num_threads)
+    : columns_{columns},
+      rows_{rows},
+      matrix_(columns.size()),
+      basis_{std::move(basis)},
+      column_position_(columns.size(), -1),
+      row_position_(rows.size(), -1),
+      solution_(columns.size()),
+      activity_(rows.size()),
+      dual_solution_(rows.size()),
+      reduced_costs_(columns.size()),
+      primal_feasible_{false},
+      dual_feasible_{false} {
+  for (int i = 0; i < static_cast<int>(rows_.size()); ++i) {
+    for (const auto& [var, coeff] : rows_[i].addends) matrix_[var_to_col.at(var)].emplace_back(i, coeff);
+  }
+  Solve(num_threads);
+  if (!solved()) return;
+  primal_feasible_ = PrimalFeasible();
+  dual_feasible_ = DualFeasible();
+}
+
+bool BasisSolution::FixedBounds(const std::optional<mpq_class>& lb, const std::optional<mpq_class>& ub) {
+  return lb.has_value() && ub.has_value() && *lb == *ub;
+}
+
+std::optional<mpq_class> BasisSolution::NonBasicValue(const BasisStatus status, const std::optional<mpq_class>& lb,
+                                                      const std::optional<mpq_class>& ub) {
+  switch (status) {
+    case BasisStatus::AT_LOWER:
+      return lb;
+    case BasisStatus::AT_UPPER:
+      return ub;
+    case BasisStatus::FIXED:
+      if (!FixedBounds(lb, ub)) return std::nullopt;
+      return lb;
+    case BasisStatus::FREE:
+      if ((lb.has_value() && *lb > 0) || (ub.has_value() && *ub < 0)) return std::nullopt;
+      return mpq_class{0};
+    default:
+      return std::nullopt;
+  }
+}
+
+void BasisSolution::Solve(const unsigned int num_threads) {
+  const int num_columns = static_cast<int>(columns_.size());
+  const int num_rows = static_cast<int>(rows_.size());
+  if (static_cast<int>(basis_.columns.size()) != num_columns || static_cast<int>(basis_.rows.size()) != num_rows) {
+    DELPI_DEBUG("BasisSolution: the basis does not match the problem");
+    return;
+  }
+
+  // The unknowns are the basic columns. There is an equation for each non-basic (tight) row
+  for (int j = 0; j < num_columns; ++j) {
+    if (basis_.columns[j] != BasisStatus::BASIC) continue;
+    column_position_[j] = static_cast<int>(basic_columns_.size());
+    basic_columns_.push_back(j);
+  }
+  for (int i = 0; i < num_rows; ++i) {
+    if (basis_.rows[i] == BasisStatus::BASIC) continue;
+    row_position_[i] = static_cast<int>(tight_rows_.size());
+    tight_rows_.push_back(i);
+  }
+  if (basic_columns_.size() != tight_rows_.size()) {
+    DELPI_DEBUG_FMT("BasisSolution: {} basic columns but {} non-basic rows", basic_columns_.size(),
+                    tight_rows_.size());
+    return;
+  }
+  const int size = static_cast<int>(basic_columns_.size());
+
+  // Primal system B x_B = b - N x_N
+  std::vector<mpq_class> x(num_columns);
+  for (int j = 0; j < num_columns; ++j) {
+    if (column_position_[j] != -1) continue;
+    std::optional<mpq_class> value{NonBasicValue(basis_.columns[j], columns_[j].lb, columns_[j].ub)};
+    if (!value.has_value()) {
+      DELPI_DEBUG_FMT("BasisSolution: the status of column {} does not fit its bounds", j);
+      return;
+    }
+    x[j] = std::move(*value);
+  }
+  std::vector<SparseVector> basis_matrix(size);
+  std::vector<mpq_class> b(size);
+  for (int e = 0; e < size; ++e) {
+    const Row& row = rows_[tight_rows_[e]];
+    std::optional<mpq_class> value{NonBasicValue(basis_.rows[tight_rows_[e]], row.lb, row.ub)};
+    if (!value.has_value()) {
+      DELPI_DEBUG_FMT("BasisSolution: the status of row {} does not fit its bounds", tight_rows_[e]);
+      return;
+    }
+    b[e] = std::move(*value);
+  }
+  for (int j = 0; j < num_columns; ++j) {
+    for (const auto& [i, coeff] : matrix_[j]) {
+      if (row_position_[i] == -1) continue;
+      if (column_position_[j] != -1) {
+        basis_matrix[column_position_[j]].emplace_back(row_position_[i], coeff);
+      } else if (x[j] != 0) {
+        b[row_position_[i]] -= coeff * x[j];
+      }
+    }
+  }
+  lu_.emplace(basis_matrix, num_threads);
+  if (lu_->singular()) {
+    DELPI_DEBUG("BasisSolution: the basis matrix is singular");
+    lu_.reset();
+    return;
+  }
+  std::vector<mpq_class> x_b{lu_->Solve(std::move(b))};
+  for (int p = 0; p < size; ++p) x[basic_columns_[p]] = std::move(x_b[p]);
+  solution_ = std::move(x);
+  for (int j = 0; j < num_columns; ++j) {
+    if (solution_[j] == 0) continue;
+    for (const auto& [i, coeff] : matrix_[j]) activity_[i] += coeff * solution_[j];
+  }
+
+  // Dual system B^T y_T = c_B, reusing the factorisation
+  std::vector<mpq_class> c_b(size);
+  for (int p = 0; p < size; ++p) c_b[p] = columns_[basic_columns_[p]].obj.value_or(0);
+  std::vector<mpq_class> y_t{lu_->SolveTranspose(std::move(c_b))};
+  for (int e = 0; e < size; ++e) dual_solution_[tight_rows_[e]] = std::move(y_t[e]);
+  for (int j = 0; j < num_columns; ++j) {
+    if (column_position_[j] != -1) continue;
+    reduced_costs_[j] = columns_[j].obj.value_or(0);
+    for (const auto& [i, coeff] : matrix_[j]) reduced_costs_[j] -= coeff * dual_solution_[i];
+  }
+}
+
+bool BasisSolution::PrimalFeasible() const {
+  // Tight rows are satisfied by construction
+  for (const int j : basic_columns_) {
+    if (!InBounds(solution_[j], columns_[j].lb, columns_[j].ub)) {
+      DELPI_DEBUG_FMT("BasisSolution: column {} violates its bounds", j);
+      return false;
+    }
+  }
+  for (int i = 0; i < static_cast<int>(rows_.size()); ++i) {
+    if (row_position_[i] == -1 && !InBounds(activity_[i], rows_[i].lb, rows_[i].ub)) {
+      DELPI_DEBUG_FMT("BasisSolution: row {} violates its bounds", i);
+      return false;
+    }
+  }
+  return true;
+}
+
+bool BasisSolution::DualFeasible() const {
+  // The sign of the dual of a tight row and of the reduced cost of a non-basic column
+  // must agree with the bound they are at, unless the bounds coincide
+  for (const int i : tight_rows_) {
+    if (!SignAgrees(basis_.rows[i], dual_solution_[i], rows_[i].lb, rows_[i].ub)) {
+      DELPI_DEBUG_FMT("BasisSolution: the dual of row {} has the wrong sign", i);
+      return false;
+    }
+  }
+  for (int j = 0; j < static_cast<int>(columns_.size()); ++j) {
+    if (column_position_[j] != -1) continue;
+    if (!SignAgrees(basis_.columns[j], reduced_costs_[j], columns_[j].lb, columns_[j].ub)) {
+      DELPI_DEBUG_FMT("BasisSolution: the reduced cost of column {} has the wrong sign", j);
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace delpi
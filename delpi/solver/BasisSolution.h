@@ -0,0 +1,138 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * BasisSolution class.
+ */
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "delpi/libs/gmp.h"
+#include "delpi/solver/Basis.h"
+#include "delpi/solver/Column.h"
+#include "delpi/solver/Row.h"
+#include "delpi/solver/SparseLu.h"
+#include "delpi/symbolic/Variable.h"
+
+namespace delpi {
+
+/**
+ * Exact primal and dual solution associated with a simplex basis.
+ *
+ * Given the problem @f$ \min c^T x @f$ s.t. @f$ l_r \le A x \le u_r @f$, @f$ l_c \le x \le u_c @f$ and a basis,
+ * - every non-basic column and row is fixed to the bound indicated by its status,
+ * - the basis matrix @f$ B @f$ is factorised with a @ref SparseLu,
+ * - the basis system @f$ B x_B = b - N x_N @f$ is solved in rational arithmetic to obtain the primal solution,
+ * - the transposed system @f$ B^T y = c_B @f$ is solved in rational arithmetic to obtain the dual solution,
+ *   from which the reduced costs of the non-basic columns follow,
+ * - the primal feasibility of the basic columns and rows, and the sign of the reduced costs and duals are checked.
+ *
+ * The factorisation is kept, so that further systems with the same basis matrix can be solved.
+ * The objective is always minimised.
+ * The columns and rows must outlive the solution.
+ */
+class BasisSolution {
+ public:
+  using SparseVector = SparseLu::SparseVector;  ///< Sparse vector as (index, value) pairs
+
+  /**
+   * Compute the solution associated with the `basis` of the given problem.
+   * @param columns columns of the problem
+   * @param rows rows of the problem
+   * @param var_to_col map from the variables to the index of their column
+   * @param basis basis of the problem
+   * @param num_threads maximum number of threads used to factorise the basis matrix
+   */
+  BasisSolution(const std::vector<Column>& columns, const std::vector<Row>& rows,
+                const std::unordered_map<Variable, int>& var_to_col, Basis basis, unsigned int num_threads = 1);
+
+  /**
+   * Check whether the bounds coincide.
+   * @param lb lower bound, if any
+   * @param ub upper bound, if any
+   * @return true if both bounds are present and equal
+   * @return false otherwise
+   */
+  [[nodiscard]] static bool FixedBounds(const std::optional<mpq_class>& lb, const std::optional<mpq_class>& ub);
+
+  /**
+   * Whether the solution has been computed.
+   * @return true if the basis matches the problem, each status is compatible with its bounds
+   * and the basis matrix is not singular
+   * @return false otherwise, in which case all the values are zero
+   */
+  [[nodiscard]] bool solved() const { return lu_.has_value(); }
+  /** @checker{primal feasible, basis} */
+  [[nodiscard]] bool primal_feasible() const { return primal_feasible_; }
+  /** @checker{dual feasible, basis} */
+  [[nodiscard]] bool dual_feasible() const { return dual_feasible_; }
+  /** @checker{optimal, basis} */
+  [[nodiscard]] bool optimal() const { return primal_feasible_ && dual_feasible_; }
+
+  /** @getter{basis, solution} */
+  [[nodiscard]] const Basis& basis() const { return basis_; }
+  /** @getter{constraint matrix\, stored by column, solution} */
+  [[nodiscard]] const std::vector<SparseVector>& matrix() const { return matrix_; }
+  /** @getter{basic columns\, in the order of the basis matrix, solution} */
+  [[nodiscard]] const std::vector<int>& basic_columns() const { return basic_columns_; }
+  /** @getter{position of each column in the basis matrix\, or -1 if non-basic, solution} */
+  [[nodiscard]] const std::vector<int>& column_position() const { return column_position_; }
+  /** @getter{non-basic rows\, in the order of the basis matrix, solution} */
+  [[nodiscard]] const std::vector<int>& tight_rows() const { return tight_rows_; }
+  /** @getter{position of each row in the basis matrix\, or -1 if basic, solution} */
+  [[nodiscard]] const std::vector<int>& row_position() const { return row_position_; }
+  /**
+   * Factorisation of the basis matrix.
+   * @pre The solution has been computed, as told by @ref solved
+   * @return factorisation of the basis matrix
+   */
+  [[nodiscard]] const SparseLu& lu() const { return *lu_; }
+  /** @getter{value of each column, solution} */
+  [[nodiscard]] const std::vector<mpq_class>& solution() const { return solution_; }
+  /** @getter{activity of each row, solution} */
+  [[nodiscard]] const std::vector<mpq_class>& activity() const { return activity_; }
+  /** @getter{dual value of each row, solution} */
+  [[nodiscard]] const std::vector<mpq_class>& dual_solution() const { return dual_solution_; }
+  /** @getter{reduced cost of each column\, zero for the basic ones, solution} */
+  [[nodiscard]] const std::vector<mpq_class>& reduced_costs() const { return reduced_costs_; }
+
+ private:
+  /**
+   * Value of a non-basic column or row, given its `status` and its bounds.
+   * @param status status in the basis
+   * @param lb lower bound, if any
+   * @param ub upper bound, if any
+   * @return value of the variable
+   * @return std::nullopt if the status is not compatible with the bounds
+   */
+  static std::optional<mpq_class> NonBasicValue(BasisStatus status, const std::optional<mpq_class>& lb,
+                                                const std::optional<mpq_class>& ub);
+
+  /** Compute the primal and dual solution, if the basis fits the problem. */
+  void Solve(unsigned int num_threads);
+  /** Check the primal feasibility of the basic columns and rows. */
+  [[nodiscard]] bool PrimalFeasible() const;
+  /** Check the sign of the duals of the tight rows and of the reduced costs of the non-basic columns. */
+  [[nodiscard]] bool DualFeasible() const;
+
+  const std::vector<Column>& columns_;    ///< Columns of the problem
+  const std::vector<Row>& rows_;          ///< Rows of the problem
+  std::vector<SparseVector> matrix_;      ///< Constraint matrix, stored by column
+  Basis basis_;                           ///< Basis the solution is associated with
+  std::vector<int> basic_columns_;        ///< Basic columns, in the order of the basis matrix
+  std::vector<int> column_position_;      ///< Position of each column in the basis matrix, or -1 if non-basic
+  std::vector<int> tight_rows_;           ///< Non-basic rows, in the order of the basis matrix
+  std::vector<int> row_position_;         ///< Position of each row in the basis matrix, or -1 if basic
+  std::optional<SparseLu> lu_;            ///< Factorisation of the basis matrix
+  std::vector<mpq_class> solution_;       ///< Value of each column
+  std::vector<mpq_class> activity_;       ///< Activity of each row
+  std::vector<mpq_class> dual_solution_;  ///< Dual value of each row
+  std::vector<mpq_class> reduced_costs_;  ///< Reduced cost of each column
+  bool primal_feasible_;                  ///< Whether the basic columns and rows are within their bounds
+  bool dual_feasible_;                    ///< Whether the duals and reduced costs have the right sign
+};
+
+}  // namespace delpi
@@ -0,0 +1,173 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/solver/BoundPropagation.h"
+
+#include <optional>
+#include <utility>
+
+#include "delpi/util/logging.h"
+
+namespace delpi {
+
+namespace {
+
+/**
+ * Check whether moving a finite bound from `current` to `bound` is worth it.
+ * @param current current bound
+ * @param bound new bound
+ * @return true if the bound moves by more than 0.1% of the magnitude of `current`, or of 1 if it is smaller
+ */
+bool IsSignificant(const mpq_class& current, const mpq_class& bound) {
+  const mpq_class magnitude{abs(current)};
+  return 1000 * abs(bound - current) > (magnitude > 1 ? magnitude : mpq_class{1});
+}
+
+/**
+ * Bound on the activity of a row, given the bounds of its columns.
+ * Each term contributes either to the finite sum or to the count of the infinite ones.
+ */
+struct Activity {
+  mpq_class sum{0};  ///< Sum of the finite contributions
+  int num_inf{0};    ///< Number of infinite contributions
+
+  /**
+   * Add the contribution of `coeff` times `bound`.
+   * @param coeff coefficient of the column
+   * @param bound bound of the column, if any
+   */
+  void Add(const mpq_class& coeff, const std::optional<mpq_class>& bound) {
+    if (bound.has_value()) {
+      sum += coeff * *bound;
+    } else {
+      ++num_inf;
+    }
+  }
+  /**
+   * Activity of all the other terms of the row, once the contribution of `coeff` times `bound` is removed.
+   * @param coeff coefficient of the column
+   * @param bound bound of the column, if any
+   * @return finite activity of the other terms, or std::nullopt if it is infinite
+   */
+  [[nodiscard]] std::optional<mpq_class> Residual(const mpq_class& coeff, const std::optional<mpq_class>& bound) const {
+    if (num_inf == 0) return sum - coeff * *bound;
+    if (num_inf == 1 && !bound.has_value()) return sum;
+    return std::nullopt;
+  }
+};
+
+}  // namespace
+
+BoundPropagation::BoundPropagation(const std::vector<Column>& columns, const std::vector<Row>& rows,
+                                   const std::unordered_map<Variable, int>& var_to_col, const int max_rounds)
+    : columns_{columns}, num_tightened_{0}, rounds_{0}, infeasible_{false} {
+  const std::size_t m = rows.size();
+  std::vector<std::vector<int>> col_rows(columns.size());
+  std::vector<int> worklist;
+  std::vector<bool> queued(m, false);
+  for (std::size_t i = 0; i < m; ++i) {
+    for (const auto& [var, coeff] : rows[i].addends) {
+      if (coeff != 0) col_rows[var_to_col.at(var)].push_back(static_cast<int>(i));
+    }
+    // Free rows cannot imply anything
+    if (!rows[i].lb.has_value() && !rows[i].ub.has_value()) continue;
+    worklist.push_back(static_cast<int>(i));
+    queued[i] = true;
+  }
+
+  while (!worklist.empty() && rounds_ < max_rounds && !infeasible_) {
+    ++rounds_;
+    std::vector<int> next;
+    for (const int i : worklist) {
+      queued[i] = false;
+      PropagateRow(i, rows, var_to_col, col_rows, queued, next);
+      if (infeasible_) break;
+    }
+    worklist = std::move(next);
+  }
+  DELPI_DEBUG_FMT("BoundPropagation::BoundPropagation: {} bounds tightened in {} rounds{}", num_tightened_, rounds_,
+                  infeasible_ ? ", infeasible" : "");
+}
+
+void BoundPropagation::PropagateRow(const int row_idx, const std::vector<Row>& rows,
+                                    const std::unordered_map<Variable, int>& var_to_col,
+                                    const std::vector<std::vector<int>>& col_rows, std::vector<bool>& queued,
+                                    std::vector<int>& worklist) {
+  const Row& row = rows[row_idx];
+  // The smallest activity takes each column at the bound that minimises its term, the largest at the other one
+  Activity min_activity, max_activity;
+  for (const auto& [var, coeff] : row.addends) {
+    if (coeff == 0) continue;
+    const Column& column = columns_[var_to_col.at(var)];
+    min_activity.Add(coeff, coeff > 0 ? column.lb : column.ub);
+    max_activity.Add(coeff, coeff > 0 ? column.ub : column.lb);
+  }
+  if ((row.ub.has_value() && min_activity.num_inf == 0 && min_activity.sum > *row.ub) ||
+      (row.lb.has_value() && max_activity.num_inf == 0 && max_activity.sum < *row.lb)) {
+    DELPI_TRACE_FMT("BoundPropagation::PropagateRow: row {} cannot be satisfied", row_idx);
+    infeasible_ = true;
+    return;
+  }
+
+  for (const auto& [var, coeff] : row.addends) {
+    if (coeff == 0) continue;
+    const int col_idx = var_to_col.at(var);
+    // Copy the bounds the activities have been computed with, since they may be tightened below
+    const std::optional<mpq_class> min_bound{coeff > 0 ? columns_[col_idx].lb : columns_[col_idx].ub};
+    const std::optional<mpq_class> max_bound{coeff > 0 ? columns_[col_idx].ub : columns_[col_idx].lb};
+    bool tightened = false;
+    // coeff * x <= ub - (smallest activity of the other terms)
+    if (row.ub.has_value()) {
+      if (const std::optional<mpq_class> residual{min_activity.Residual(coeff, min_bound)}) {
+        mpq_class bound{(*row.ub - *residual) / coeff};
+        tightened |= coeff > 0 ? TightenUpper(col_idx, std::move(bound)) : TightenLower(col_idx, std::move(bound));
+      }
+    }
+    // coeff * x >= lb - (largest activity of the other terms)
+    if (row.lb.has_value() && !infeasible_) {
+      if (const std::optional<mpq_class> residual{max_activity.Residual(coeff, max_bound)}) {
+        mpq_class bound{(*row.lb - *residual) / coeff};
+        tightened |= coeff > 0 ? TightenLower(col_idx, std::move(bound)) : TightenUpper(col_idx, std::move(bound));
+      }
+    }
+    if (infeasible_) return;
+    if (!tightened) continue;
+    for (const int i : col_rows[col_idx]) {
+      if (i == row_idx || queued[i]) continue;
+      queued[i] = true;
+      worklist.push_back(i);
+    }
+  }
+}
+
+bool BoundPropagation::TightenLower(const int col_idx, mpq_class lb) {
+  Column& column = columns_[col_idx];
+  if (column.ub.has_value() && lb > *column.ub) {
+    DELPI_TRACE_FMT("BoundPropagation::TightenLower: {} has crossing bounds {} > {}", column.var, lb, *column.ub);
+    infeasible_ = true;
+    return false;
+  }
+  if (column.lb.has_value() && (lb <= *column.lb || !IsSignificant(*column.lb, lb))) return false;
+  DELPI_TRACE_FMT("BoundPropagation::TightenLower: {} >= {}", column.var, lb);
+  column.lb = std::move(lb);
+  ++num_tightened_;
+  return true;
+}
+
+bool BoundPropagation::TightenUpper(const int col_idx, mpq_class ub) {
+  Column& column = columns_[col_idx];
+  if (column.lb.has_value() && ub < *column.lb) {
+    DELPI_TRACE_FMT("BoundPropagation::TightenUpper: {} has crossing bounds {} < {}", column.var, ub, *column.lb);
+    infeasible_ = true;
+    return false;
+  }
+  if (column.ub.has_value() && (ub >= *column.ub || !IsSignificant(*column.ub, ub))) return false;
+  DELPI_TRACE_FMT("BoundPropagation::TightenUpper: {} <= {}", column.var, ub);
+  column.ub = std::move(ub);
+  ++num_tightened_;
+  return true;
+}
+
+}  // namespace delpi
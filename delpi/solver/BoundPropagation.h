@@ -0,0 +1,99 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * BoundPropagation class.
+ */
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "delpi/solver/Column.h"
+#include "delpi/solver/Row.h"
+#include "delpi/symbolic/Variable.h"
+
+namespace delpi {
+
+/**
+ * Exact activity-based bound propagation over the rows of an LP problem.
+ *
+ * For each row @f$ lb \le \sum_k a_k x_k \le ub @f$, the minimum and maximum activity of the other columns
+ * bound the term @f$ a_j x_j @f$, which may give a tighter bound for @f$ x_j @f$.
+ * Rows are processed from a worklist, in rounds: whenever a column is tightened,
+ * the rows it appears in are queued for the next round.
+ * All the computations are carried out in arbitrary precision rational arithmetic,
+ * so the new bounds are implied by the rows and the feasible region of the problem does not change.
+ * To avoid long chains of tiny improvements, a finite bound is only replaced if it moves by more than
+ * 0.1% of its magnitude, or of 1 if it is smaller.
+ * @code
+ * const BoundPropagation propagation{columns, rows, var_to_col, 10};
+ * if (!propagation.infeasible()) {
+ *   for (const Column& column : propagation.columns()) lp_solver.SetBound(column.var, column.lb, column.ub);
+ * }
+ * @endcode
+ */
+class BoundPropagation {
+ public:
+  /**
+   * Propagate the bounds of the `columns` over the `rows` for at most `max_rounds` rounds.
+   * @param columns columns of the problem
+   * @param rows rows of the problem
+   * @param var_to_col map from the variables to the index of their column
+   * @param max_rounds maximum number of rounds over the worklist
+   */
+  BoundPropagation(const std::vector<Column>& columns, const std::vector<Row>& rows,
+                   const std::unordered_map<Variable, int>& var_to_col, int max_rounds);
+
+  /** @getter{columns with the tightened bounds\, in the same order as the input, propagation} */
+  [[nodiscard]] const std::vector<Column>& columns() const { return columns_; }
+  /** @getter{number of bounds tightened\, counting every improvement of the same bound, propagation} */
+  [[nodiscard]] int num_tightened() const { return num_tightened_; }
+  /** @getter{number of rounds over the worklist, propagation} */
+  [[nodiscard]] int rounds() const { return rounds_; }
+  /**
+   * Whether the propagation has proved the problem infeasible,
+   * finding a column with crossing bounds or a row its activity can never satisfy.
+   * In that case, the propagation stops early and the bounds in @ref columns are not meaningful.
+   * @return true if the problem is infeasible
+   * @return false if the problem may be feasible
+   */
+  [[nodiscard]] bool infeasible() const { return infeasible_; }
+
+ private:
+  /**
+   * Derive new bounds for the columns of the `row_idx`-th row from its activity.
+   * @param row_idx index of the row
+   * @param rows rows of the problem
+   * @param var_to_col map from the variables to the index of their column
+   * @param col_rows rows each column appears in
+   * @param queued whether each row is already in the worklist
+   * @param worklist rows to process in the next round, where the rows of the tightened columns are added
+   */
+  void PropagateRow(int row_idx, const std::vector<Row>& rows, const std::unordered_map<Variable, int>& var_to_col,
+                    const std::vector<std::vector<int>>& col_rows, std::vector<bool>& queued,
+                    std::vector<int>& worklist);
+  /**
+   * Replace the lower bound of the `col_idx`-th column with `lb` if it is an improvement.
+   * @param col_idx index of the column
+   * @param lb new lower bound
+   * @return true if the bound has been tightened
+   * @return false if the bound has not changed
+   */
+  bool TightenLower(int col_idx, mpq_class lb);
+  /**
+   * Replace the upper bound of the `col_idx`-th column with `ub` if it is an improvement.
+   * @param col_idx index of the column
+   * @param ub new upper bound
+   * @return true if the bound has been tightened
+   * @return false if the bound has not changed
+   */
+  bool TightenUpper(int col_idx, mpq_class ub);
+
+  std::vector<Column> columns_;  ///< Columns with the tightened bounds
+  int num_tightened_;            ///< Number of bounds tightened
+  int rounds_;                   ///< Number of rounds over the worklist
+  bool infeasible_;              ///< Whether the problem has been proved infeasible
+};
+
+}  // namespace delpi
@@ -0,0 +1,143 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/solver/Decomposition.h"
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <ostream>
+
+#include "delpi/util/ThreadPool.h"
+#include "delpi/util/error.h"
+#include "delpi/util/logging.h"
+
+namespace delpi {
+
+namespace {
+
+using Forest = std::vector<std::atomic<int>>;  ///< Parent of each node of a disjoint-set forest
+
+/**
+ * Find the representative of the set containing `node`, halving the path along the way.
+ *
+ * Parents never have a larger index than their children,
+ * so replacing a parent with the grandparent is always safe, even if another thread changes either of them.
+ * @param parent parent of each node in the disjoint-set forest
+ * @param node node to find the representative of
+ * @return representative of the set
+ */
+int FindRoot(Forest& parent, int node) {
+  while (true) {
+    int node_parent = parent[node].load();
+    if (node_parent == node) return node;
+    const int grandparent = parent[node_parent].load();
+    if (grandparent != node_parent) parent[node].compare_exchange_weak(node_parent, grandparent);
+    node = grandparent;
+  }
+}
+/**
+ * Merge the sets containing `a` and `b`.
+ *
+ * The root with the larger index is linked to the other one, but only if it is still a root.
+ * Otherwise, another thread has linked it in the meantime and the roots are looked up again.
+ * @param parent parent of each node in the disjoint-set forest
+ * @param a node in the first set
+ * @param b node in the second set
+ */
+void Join(Forest& parent, int a, int b) {
+  while (true) {
+    a = FindRoot(parent, a);
+    b = FindRoot(parent, b);
+    if (a == b) return;
+    if (a < b) std::swap(a, b);
+    int expected = a;
+    if (parent[a].compare_exchange_strong(expected, b)) return;
+  }
+}
+
+/**
+ * Join the columns of each row in `[begin, end)`.
+ * @param parent parent of each column in the disjoint-set forest
+ * @param rows rows of the problem
+ * @param var_to_col map from the variables to the index of their column
+ * @param begin first row to process
+ * @param end one past the last row to process
+ */
+void JoinRows(Forest& parent, const std::vector<Row>& rows, const std::unordered_map<Variable, int>& var_to_col,
+              const std::size_t begin, const std::size_t end) {
+  for (std::size_t i = begin; i < end; ++i) {
+    int first = -1;
+    for (const auto& [var, coeff] : rows[i].addends) {
+      if (coeff == 0) continue;
+      const int column = var_to_col.at(var);
+      if (first == -1) {
+        first = column;
+      } else {
+        Join(parent, first, column);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+Decomposition::Decomposition(const std::vector<Row>& rows, const std::unordered_map<Variable, int>& var_to_col,
+                             const int num_columns, const unsigned int num_threads)
+    : column_block_(num_columns, -1) {
+  DELPI_ASSERT(num_columns >= 0, "Invalid number of columns");
+  Forest parent(num_columns);
+  for (int j = 0; j < num_columns; ++j) parent[j].store(j, std::memory_order_relaxed);
+
+  const std::size_t num_chunks = std::clamp<std::size_t>(num_threads, 1, std::max<std::size_t>(rows.size(), 1));
+  const auto chunk_begin = [&](const std::size_t chunk) { return chunk * rows.size() / num_chunks; };
+  if (num_chunks > 1) {
+    ThreadPool pool{static_cast<unsigned int>(num_chunks - 1)};
+    std::vector<std::future<void>> futures;
+    futures.reserve(num_chunks - 1);
+    for (std::size_t chunk = 1; chunk < num_chunks; ++chunk) {
+      futures.emplace_back(pool.Submit(
+          [&, chunk]() { JoinRows(parent, rows, var_to_col, chunk_begin(chunk), chunk_begin(chunk + 1)); }));
+    }
+    JoinRows(parent, rows, var_to_col, 0, chunk_begin(1));
+    for (std::future<void>& future : futures) future.get();
+  } else {
+    JoinRows(parent, rows, var_to_col, 0, rows.size());
+  }
+
+  // The root is the smallest column of its set, so blocks are numbered in increasing order of their first column
+  for (int j = 0; j < num_columns; ++j) {
+    const int root = FindRoot(parent, j);
+    if (root == j) {
+      column_block_[j] = static_cast<int>(blocks_.size());
+      blocks_.emplace_back();
+    } else {
+      column_block_[j] = column_block_[root];
+    }
+    blocks_[column_block_[j]].columns.push_back(j);
+  }
+  std::vector<int> empty_rows;
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    const auto it = std::ranges::find_if(rows[i].addends, [](const auto& addend) { return addend.second != 0; });
+    if (it == rows[i].addends.end()) {
+      empty_rows.push_back(static_cast<int>(i));
+    } else {
+      blocks_[column_block_[var_to_col.at(it->first)]].rows.push_back(static_cast<int>(i));
+    }
+  }
+  for (const int row : empty_rows) blocks_.push_back(Block{{}, {row}});
+  DELPI_DEBUG_FMT("Decomposition::Decomposition: {} columns and {} rows split in {} blocks", num_columns, rows.size(),
+                  blocks_.size());
+}
+
+std::ostream& operator<<(std::ostream& os, const Decomposition::Block& block) {
+  os << "Block{ columns: [";
+  for (std::size_t j = 0; j < block.columns.size(); ++j) os << (j == 0 ? "" : ", ") << block.columns[j];
+  os << "], rows: [";
+  for (std::size_t i = 0; i < block.rows.size(); ++i) os << (i == 0 ? "" : ", ") << block.rows[i];
+  return os << "] }";
+}
+
+}  // namespace delpi
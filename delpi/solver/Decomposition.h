@@ -0,0 +1,81 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * Decomposition class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <unordered_map>
+#include <vector>
+
+#include "delpi/solver/Row.h"
+#include "delpi/symbolic/Variable.h"
+
+namespace delpi {
+
+/**
+ * Block-diagonal decomposition of the constraint matrix of an LP problem.
+ *
+ * The blocks are the connected components of the bipartite graph with a node for each row and column,
+ * where a row and a column are adjacent if the coefficient of the column in the row is not zero.
+ * Blocks share no row or column, so each one is an independent LP problem,
+ * and the objective of the whole problem is the sum of the objectives of the blocks.
+ *
+ * Rows only ever join columns, so the components are computed with a disjoint-set forest over the columns alone.
+ * The rows are split into contiguous chunks, one for each thread, which join the columns of their rows concurrently.
+ * The forest is lock-free: a root is linked to another one with a compare-and-swap,
+ * always from the larger to the smaller index, so no cycle can form no matter how the threads interleave.
+ * @code
+ * // x + y <= 1, z >= 2, 0 <= 0
+ * const Decomposition decomposition{rows, var_to_col, 3};
+ * decomposition.blocks();  // [{columns: [0, 1], rows: [0]}, {columns: [2], rows: [1]}, {columns: [], rows: [2]}]
+ * @endcode
+ */
+class Decomposition {
+ public:
+  /** Independent block of the LP problem. */
+  struct Block {
+    std::vector<int> columns;  ///< Columns of the block, in increasing order
+    std::vector<int> rows;     ///< Rows of the block, in increasing order
+  };
+
+  /**
+   * Decompose the LP problem with the given `rows` into independent blocks.
+   *
+   * Each column belongs to exactly one block, possibly without rows if it does not appear in any row.
+   * Each row belongs to the block of its columns, or to a block without columns if all its coefficients are zero.
+   * Blocks with columns come first, in increasing order of their first column, followed by the ones without columns.
+   * @param rows rows of the problem
+   * @param var_to_col map from the variables to the index of their column
+   * @param num_columns number of columns of the problem
+   * @param num_threads maximum number of threads used to join the columns
+   */
+  Decomposition(const std::vector<Row>& rows, const std::unordered_map<Variable, int>& var_to_col, int num_columns,
+                unsigned int num_threads = 1);
+
+  /** @getter{independent blocks, decomposition} */
+  [[nodiscard]] const std::vector<Block>& blocks() const { return blocks_; }
+  /** @getter{number of independent blocks, decomposition} */
+  [[nodiscard]] std::size_t size() const { return blocks_.size(); }
+  /** @getter{index of the block of each column, decomposition} */
+  [[nodiscard]] const std::vector<int>& column_block() const { return column_block_; }
+
+ private:
+  std::vector<Block> blocks_;      ///< Independent blocks
+  std::vector<int> column_block_;  ///< Index of the block of each column
+};
+
+std::ostream& operator<<(std::ostream& os, const Decomposition::Block& block);
+
+}  // namespace delpi
+
+#ifdef DELPI_INCLUDE_FMT
+
+#include "delpi/util/logging.h"
+
+OSTREAM_FORMATTER(delpi::Decomposition::Block)
+
+#endif
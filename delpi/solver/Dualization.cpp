@@ -0,0 +1,136 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/solver/Dualization.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+#include "delpi/util/error.h"
+#include "delpi/util/logging.h"
+
+namespace delpi {
+
+namespace {
+
+/**
+ * Sign of the dual column associated with the bound identified by `status`.
+ * @param status AT_LOWER, AT_UPPER or FIXED
+ * @return -1 for the upper bound, 1 otherwise
+ */
+int BoundSign(const BasisStatus status) { return status == BasisStatus::AT_UPPER ? -1 : 1; }
+
+}  // namespace
+
+Dualization::Dualization(const std::vector<Column>& columns, const std::vector<Row>& rows,
+                         const std::unordered_map<Variable, int>& var_to_col, Variables* const variables)
+    : num_primal_columns_{static_cast<int>(columns.size())},
+      num_primal_rows_{static_cast<int>(rows.size())},
+      rows_(columns.size()) {
+  if (variables != nullptr) {
+    if (variables->rows.size() < 3 * rows.size()) variables->rows.resize(3 * rows.size());
+    if (variables->columns.size() < 3 * columns.size()) variables->columns.resize(3 * columns.size());
+  }
+  for (int i = 0; i < num_primal_rows_; ++i) AddDualColumns(rows[i].lb, rows[i].ub, true, i, variables);
+  for (int j = 0; j < num_primal_columns_; ++j) AddDualColumns(columns[j].lb, columns[j].ub, false, j, variables);
+
+  // The j-th dual row collects the coefficients of the j-th column in each row, plus its own bound multipliers
+  for (std::size_t k = 0; k < columns_.size(); ++k) {
+    const auto& [is_row, index, status] = origins_[k];
+    const int sign = BoundSign(status);
+    if (!is_row) {
+      rows_[index].addends.emplace_back(columns_[k].var, sign);
+      continue;
+    }
+    for (const auto& [var, coeff] : rows[index].addends) {
+      if (coeff == 0) continue;
+      rows_[var_to_col.at(var)].addends.emplace_back(columns_[k].var, sign * coeff);
+    }
+  }
+  for (int j = 0; j < num_primal_columns_; ++j) {
+    rows_[j].lb = rows_[j].ub = columns[j].obj.value_or(0);
+  }
+  DELPI_DEBUG_FMT("Dualization::Dualization: {}x{} problem dualised into {}x{}", num_primal_rows_,
+                  num_primal_columns_, rows_.size(), columns_.size());
+}
+
+void Dualization::AddDualColumns(const std::optional<mpq_class>& lb, const std::optional<mpq_class>& ub,
+                                 const bool is_row, const int index, Variables* const variables) {
+  const auto add_column = [&](const int slot, const char* const suffix, std::optional<mpq_class> column_lb,
+                              const mpq_class& obj, const BasisStatus status) {
+    Variable* const reused = variables == nullptr ? nullptr
+                                                  : &(is_row ? variables->rows : variables->columns)[3 * index + slot];
+    Variable var{reused == nullptr ? Variable{} : *reused};
+    if (var.is_dummy()) {
+      var = Variable{(is_row ? "y" : "d") + std::to_string(index) + suffix};
+      if (reused != nullptr) *reused = var;
+    }
+    columns_.push_back(
+        Column{var, std::move(column_lb), std::nullopt, obj == 0 ? std::nullopt : std::optional<mpq_class>{obj}});
+    origins_.push_back(Origin{is_row, index, status});
+  };
+  // The dual maximises, so the objective coefficients are negated to minimise instead
+  if (lb.has_value() && ub.has_value() && *lb == *ub) {
+    add_column(0, "", std::nullopt, -*lb, BasisStatus::FIXED);
+    return;
+  }
+  if (lb.has_value()) add_column(1, "+", mpq_class{0}, -*lb, BasisStatus::AT_LOWER);
+  if (ub.has_value()) add_column(2, "-", mpq_class{0}, *ub, BasisStatus::AT_UPPER);
+}
+
+std::vector<mpq_class> Dualization::PrimalSolution(const std::span<const mpq_class> dual_solution) const {
+  DELPI_ASSERT(dual_solution.size() == rows_.size(), "The dual solution must have a value for each dual row");
+  std::vector<mpq_class> solution;
+  solution.reserve(dual_solution.size());
+  for (const mpq_class& value : dual_solution) solution.emplace_back(-value);
+  return solution;
+}
+
+std::vector<mpq_class> Dualization::DualSolution(const std::span<const mpq_class> solution) const {
+  DELPI_ASSERT(solution.size() == columns_.size(), "The solution must have a value for each dual column");
+  std::vector<mpq_class> dual_solution(num_primal_rows_);
+  for (std::size_t k = 0; k < columns_.size(); ++k) {
+    if (!origins_[k].is_row) continue;
+    if (BoundSign(origins_[k].status) > 0) {
+      dual_solution[origins_[k].index] += solution[k];
+    } else {
+      dual_solution[origins_[k].index] -= solution[k];
+    }
+  }
+  return dual_solution;
+}
+
+std::optional<Basis> Dualization::PrimalBasis(const Basis& basis) const {
+  if (basis.columns.size() != columns_.size() || basis.rows.size() != rows_.size()) return std::nullopt;
+  // A basic dual row would leave the original problem with too many basic rows and columns
+  for (const BasisStatus status : basis.rows) {
+    if (status == BasisStatus::BASIC) return std::nullopt;
+  }
+  Basis primal_basis{std::vector<BasisStatus>(num_primal_columns_, BasisStatus::BASIC),
+                     std::vector<BasisStatus>(num_primal_rows_, BasisStatus::BASIC)};
+  for (std::size_t k = 0; k < columns_.size(); ++k) {
+    if (basis.columns[k] != BasisStatus::BASIC) continue;
+    const auto& [is_row, index, status] = origins_[k];
+    (is_row ? primal_basis.rows : primal_basis.columns)[index] = status;
+  }
+  return primal_basis;
+}
+
+bool Dualization::SameStructure(const Dualization& other) const {
+  if (columns_.size() != other.columns_.size() || rows_.size() != other.rows_.size()) return false;
+  for (std::size_t k = 0; k < columns_.size(); ++k) {
+    if (!columns_[k].var.equal_to(other.columns_[k].var) || columns_[k].lb != other.columns_[k].lb) return false;
+  }
+  for (std::size_t j = 0; j < rows_.size(); ++j) {
+    const auto same_addend = [](const std::pair<Variable, mpq_class>& lhs, const std::pair<Variable, mpq_class>& rhs) {
+      return lhs.first.equal_to(rhs.first) && lhs.second == rhs.second;
+    };
+    if (!std::ranges::equal(rows_[j].addends, other.rows_[j].addends, same_addend)) return false;
+  }
+  return true;
+}
+
+}  // namespace delpi
@@ -0,0 +1,136 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * Dualization class.
+ */
+#pragma once
+
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "delpi/libs/gmp.h"
+#include "delpi/solver/Basis.h"
+#include "delpi/solver/Column.h"
+#include "delpi/solver/Row.h"
+#include "delpi/symbolic/Variable.h"
+
+namespace delpi {
+
+/**
+ * Exact dual of an LP problem, with the maps to bring its solutions back to the original problem.
+ *
+ * The dual of the problem @f$ \min c^T x @f$ s.t. @f$ l_r \le A x \le u_r @f$, @f$ l_c \le x \le u_c @f$ is
+ * @f[
+ * \begin{array}{}
+ *      & \max              & l_r^T y^+ - u_r^T y^- + l_c^T d^+ - u_c^T d^-  \newline
+ *      & \text{subject to} & A^T (y^+ - y^-) + d^+ - d^- = c                \newline
+ *      &                   & y^+, y^-, d^+, d^- \ge 0
+ * \end{array}
+ * @f]
+ * where a variable is only present if the corresponding bound is finite.
+ * A row or column whose bounds coincide gets a single free variable instead of a pair.
+ * The dual problem has a row for each column of the original one, hence a much smaller basis
+ * when the rows greatly outnumber the columns, at the cost of more columns.
+ *
+ * The dual problem is stated as a minimisation, like any problem given to an LP solver,
+ * so its objective coefficients are negated and its optimal objective value is the opposite of the original one.
+ * The primal solution of the original problem is the opposite of the dual solution of the dual problem,
+ * while the dual solution of the original problem is @f$ y^+ - y^- @f$.
+ *
+ * Each variable adds an entry to the global registry of the symbolic layer,
+ * so an LP solver that dualises its problem over and over should keep the @ref Variables and pass them each time.
+ */
+class Dualization {
+ public:
+  /**
+   * Variables of the columns of the dual problem, created on demand and reused by the following dualizations.
+   * The @f$ i @f$-th row or column of the original problem owns the slots @f$ 3i @f$, @f$ 3i + 1 @f$, @f$ 3i + 2 @f$,
+   * for the free variable of an equality and for the multipliers of its lower and upper bound, respectively.
+   */
+  struct Variables {
+    std::vector<Variable> rows;     ///< Variables originating from the rows of the original problem
+    std::vector<Variable> columns;  ///< Variables originating from the columns of the original problem
+  };
+
+  /**
+   * Construct the dual of the problem with the given `columns` and `rows`.
+   * @param columns columns of the problem
+   * @param rows rows of the problem
+   * @param var_to_col map from the variables to the index of their column
+   * @param variables variables to reuse for the columns of the dual problem, where the missing ones are added.
+   * If null, new variables are created
+   */
+  Dualization(const std::vector<Column>& columns, const std::vector<Row>& rows,
+              const std::unordered_map<Variable, int>& var_to_col, Variables* variables = nullptr);
+
+  /**
+   * Map the dual solution of the dual problem to the primal solution of the original problem.
+   * @param dual_solution dual value of each row of the dual problem
+   * @return value of each column of the original problem
+   */
+  [[nodiscard]] std::vector<mpq_class> PrimalSolution(std::span<const mpq_class> dual_solution) const;
+  /**
+   * Map the primal solution of the dual problem to the dual solution of the original problem.
+   * @param solution value of each column of the dual problem
+   * @return dual value of each row of the original problem
+   */
+  [[nodiscard]] std::vector<mpq_class> DualSolution(std::span<const mpq_class> solution) const;
+  /**
+   * Map the basis of the dual problem to the complementary basis of the original problem.
+   *
+   * A row or column of the original problem is non-basic at the bound of the basic column of the dual problem
+   * it originates, if any, and basic otherwise.
+   * @param basis basis of the dual problem
+   * @return basis of the original problem
+   * @return std::nullopt if the `basis` is empty, or a row of the dual problem is basic
+   */
+  [[nodiscard]] std::optional<Basis> PrimalBasis(const Basis& basis) const;
+  /**
+   * Check whether this dual problem has the same variables and matrix as the `other` one.
+   *
+   * If so, the two only differ in the objective, which comes from the bounds of the original problem,
+   * and in the bounds of the rows, which come from its objective,
+   * so an LP solver holding the `other` dual problem can be updated in place, keeping its basis.
+   * The variables are only the same if both dualizations reused the same @ref Variables.
+   * @param other dual problem to compare with
+   * @return true if the dual problems have the same columns, apart from the objective, and the same rows,
+   * apart from their bounds
+   * @return false otherwise
+   */
+  [[nodiscard]] bool SameStructure(const Dualization& other) const;
+
+  /** @getter{columns, dual problem} */
+  [[nodiscard]] const std::vector<Column>& columns() const { return columns_; }
+  /** @getter{rows, dual problem} */
+  [[nodiscard]] const std::vector<Row>& rows() const { return rows_; }
+
+ private:
+  /** Row or column of the original problem a column of the dual problem originates from. */
+  struct Origin {
+    bool is_row;         ///< Whether the column originates from a row or from a column
+    int index;           ///< Index of the row or column
+    BasisStatus status;  ///< Bound of the row or column: AT_LOWER, AT_UPPER or FIXED if they coincide
+  };
+
+  /**
+   * Add the columns of the dual problem that originate from a row or column of the original problem with the bounds.
+   * @param lb lower bound of the row or column, if any
+   * @param ub upper bound of the row or column, if any
+   * @param is_row whether the bounds belong to a row or to a column
+   * @param index index of the row or column
+   * @param variables variables to reuse, if any
+   */
+  void AddDualColumns(const std::optional<mpq_class>& lb, const std::optional<mpq_class>& ub, bool is_row, int index,
+                      Variables* variables);
+
+  int num_primal_columns_;       ///< Number of columns of the original problem
+  int num_primal_rows_;          ///< Number of rows of the original problem
+  std::vector<Column> columns_;  ///< Columns of the dual problem
+  std::vector<Row> rows_;        ///< Rows of the dual problem, one for each column of the original problem
+  std::vector<Origin> origins_;  ///< Origin of each column of the dual problem
+};
+
+}  // namespace delpi
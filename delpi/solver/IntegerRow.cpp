@@ -0,0 +1,117 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/solver/IntegerRow.h"
+
+#include <algorithm>
+
+#include "delpi/util/error.h"
+
+namespace delpi {
+
+namespace {
+
+/**
+ * Add `coeff` times `value` to `sum`, without converting `coeff` to a GMP integer.
+ * @pre `coeff` must fit in a long
+ * @param sum accumulator
+ * @param coeff machine word coefficient
+ * @param value GMP integer value
+ */
+void AddMul(mpz_class& sum, const std::int64_t coeff, const mpz_class& value) {
+  const long word = static_cast<long>(coeff);  // NOLINT(runtime/int): GMP API
+  if (word >= 0) {
+    mpz_addmul_ui(sum.get_mpz_t(), value.get_mpz_t(), static_cast<unsigned long>(word));  // NOLINT(runtime/int)
+  } else {
+    mpz_submul_ui(sum.get_mpz_t(), value.get_mpz_t(), 0UL - static_cast<unsigned long>(word));  // NOLINT(runtime/int)
+  }
+}
+
+}  // namespace
+
+IntegerRow::IntegerRow(const Row& row, const std::unordered_map<Variable, int>& var_to_col) : denominator_{1} {
+  std::vector<const mpq_class*> coefficients;
+  columns_.reserve(row.addends.size());
+  coefficients.reserve(row.addends.size());
+  for (const auto& [var, coeff] : row.addends) {
+    if (coeff == 0) continue;
+    columns_.push_back(var_to_col.at(var));
+    coefficients.push_back(&coeff);
+  }
+  Store(coefficients, true);
+}
+
+IntegerRow::IntegerRow(const std::span<const std::pair<int, mpq_class>> entries) : denominator_{1} {
+  std::vector<const mpq_class*> coefficients;
+  columns_.reserve(entries.size());
+  coefficients.reserve(entries.size());
+  for (const auto& [col_idx, coeff] : entries) {
+    if (coeff == 0) continue;
+    columns_.push_back(col_idx);
+    coefficients.push_back(&coeff);
+  }
+  Store(coefficients, true);
+}
+
+IntegerRow::IntegerRow(const std::span<const mpq_class> values) : denominator_{1} {
+  std::vector<const mpq_class*> coefficients;
+  columns_.reserve(values.size());
+  coefficients.reserve(values.size());
+  for (std::size_t j = 0; j < values.size(); ++j) {
+    columns_.push_back(static_cast<int>(j));
+    coefficients.push_back(&values[j]);
+  }
+  // The values of a point are multiplied by the numerators of many rows, so they are kept as GMP integers
+  Store(coefficients, false);
+}
+
+void IntegerRow::Store(const std::span<const mpq_class* const> coefficients, const bool allow_small) {
+  for (const mpq_class* const coeff : coefficients) {
+    if (!mpz_divisible_p(denominator_.get_mpz_t(), coeff->get_den_mpz_t())) {
+      mpz_lcm(denominator_.get_mpz_t(), denominator_.get_mpz_t(), coeff->get_den_mpz_t());
+    }
+  }
+
+  large_numerators_.reserve(coefficients.size());
+  bool fits = allow_small;
+  for (const mpq_class* const coeff : coefficients) {
+    mpz_class& numerator = large_numerators_.emplace_back();
+    mpz_divexact(numerator.get_mpz_t(), denominator_.get_mpz_t(), coeff->get_den_mpz_t());
+    numerator *= coeff->get_num();
+    fits = fits && numerator.fits_slong_p();
+  }
+  if (!fits || large_numerators_.empty()) return;
+
+  small_numerators_.reserve(large_numerators_.size());
+  for (const mpz_class& numerator : large_numerators_) small_numerators_.push_back(numerator.get_si());
+  large_numerators_.clear();
+  large_numerators_.shrink_to_fit();
+}
+
+mpq_class IntegerRow::Dot(const IntegerRow& point) const {
+  DELPI_ASSERT(point.small_numerators_.empty(), "The point must be dense");
+  DELPI_ASSERT(std::ranges::all_of(columns_, [&point](const int j) { return j < static_cast<int>(point.size()); }),
+               "The point must have a value for each column of the row");
+  mpz_class sum{0};
+  if (small()) {
+    for (std::size_t k = 0; k < columns_.size(); ++k) {
+      AddMul(sum, small_numerators_[k], point.large_numerators_[columns_[k]]);
+    }
+  } else {
+    for (std::size_t k = 0; k < columns_.size(); ++k) {
+      mpz_addmul(sum.get_mpz_t(), large_numerators_[k].get_mpz_t(), point.large_numerators_[columns_[k]].get_mpz_t());
+    }
+  }
+  mpq_class result{sum, denominator_ * point.denominator_};
+  result.canonicalize();
+  return result;
+}
+
+mpz_class IntegerRow::numerator(const std::size_t k) const {
+  if (small()) return mpz_class{static_cast<long>(small_numerators_.at(k))};  // NOLINT(runtime/int): GMP API
+  return large_numerators_.at(k);
+}
+
+}  // namespace delpi
@@ -0,0 +1,104 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * IntegerRow class.
+ */
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "delpi/libs/gmp.h"
+#include "delpi/solver/Row.h"
+#include "delpi/symbolic/Variable.h"
+
+namespace delpi {
+
+/**
+ * Fraction-free storage of a sparse row, as integer numerators over a single positive denominator per row.
+ *
+ * A row @f$ \sum_k a_k x_{j_k} @f$ is stored as @f$ \frac{1}{d} \sum_k n_k x_{j_k} @f$,
+ * where @f$ d @f$ is the least common multiple of the denominators of the coefficients and @f$ n_k = d a_k @f$.
+ * If all the numerators fit in a machine word, they are stored as 64-bit integers, otherwise as GMP integers.
+ *
+ * Computing @f$ \sum_k a_k x_{j_k} @f$ with rational numbers canonicalises every product and partial sum,
+ * which means a gcd for each arithmetic operation.
+ * With a point whose values are stored the same way, over a common denominator @f$ q @f$,
+ * the dot product becomes an integer multiply-accumulate and the only gcd is the one of the final fraction
+ * @f$ \frac{1}{dq} \sum_k n_k p_{j_k} @f$.
+ * The common denominator of a point stays small when its values share their denominators,
+ * as the vertices of an LP problem do with the determinant of the basis,
+ * or the solutions of floating point solvers, whose denominators are all powers of two.
+ * @code
+ * const IntegerRow point{solution};
+ * for (const Row& row : rows) {
+ *   const mpq_class activity{IntegerRow{row, var_to_col}.Dot(point)};
+ * }
+ * @endcode
+ */
+class IntegerRow {
+ public:
+  /**
+   * Construct the fraction-free version of the `row`, ignoring its bounds.
+   * @param row row of the problem
+   * @param var_to_col map from the variables to the index of their column
+   */
+  IntegerRow(const Row& row, const std::unordered_map<Variable, int>& var_to_col);
+  /**
+   * Construct the fraction-free version of a sparse row from its non-zero entries.
+   * @param entries pairs of column index and coefficient
+   */
+  explicit IntegerRow(std::span<const std::pair<int, mpq_class>> entries);
+  /**
+   * Construct the fraction-free version of a dense point, whose @f$ j @f$-th entry is the value of column @f$ j @f$.
+   * Zero values are kept, so the point can be used as the right operand of @ref Dot.
+   * @param values value of each column
+   */
+  explicit IntegerRow(std::span<const mpq_class> values);
+
+  /**
+   * Compute the exact dot product between this row and the `point`.
+   * @pre `point` must have been constructed from a dense point with a value for each column of this row
+   * @param point dense point
+   * @return @f$ \sum_k a_k x_{j_k} @f$
+   */
+  [[nodiscard]] mpq_class Dot(const IntegerRow& point) const;
+
+  /** @getter{number of stored entries, row} */
+  [[nodiscard]] std::size_t size() const { return columns_.size(); }
+  /** @getter{column index of each stored entry, row} */
+  [[nodiscard]] const std::vector<int>& columns() const { return columns_; }
+  /** @getter{positive denominator shared by all the entries, row} */
+  [[nodiscard]] const mpz_class& denominator() const { return denominator_; }
+  /**
+   * Whether all the numerators fit in a machine word and are stored as 64-bit integers.
+   * @return true if the numerators are stored as 64-bit integers
+   * @return false if the numerators are stored as GMP integers
+   */
+  [[nodiscard]] bool small() const { return large_numerators_.empty() && !columns_.empty(); }
+  /**
+   * Numerator of the `k`-th stored entry.
+   * @param k index of the entry
+   * @return numerator of the entry, so that its coefficient is the numerator over @ref denominator
+   */
+  [[nodiscard]] mpz_class numerator(std::size_t k) const;
+
+ private:
+  /**
+   * Store the numerators of the `coefficients` over their least common denominator.
+   * @param coefficients coefficient of each stored entry, in the same order as @ref columns_
+   * @param allow_small whether the numerators may be stored as 64-bit integers
+   */
+  void Store(std::span<const mpq_class* const> coefficients, bool allow_small);
+
+  std::vector<int> columns_;                    ///< Column index of each entry
+  std::vector<std::int64_t> small_numerators_;  ///< Numerators, if all of them fit in a machine word
+  std::vector<mpz_class> large_numerators_;     ///< Numerators, if at least one does not fit in a machine word
+  mpz_class denominator_;                       ///< Positive denominator shared by all the entries
+};
+
+}  // namespace delpi
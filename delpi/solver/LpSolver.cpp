@@ -5,7 +5,15 @@
  */
 #include "delpi/solver/LpSolver.h"
 
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <optional>
 #include <ostream>
+#include <random>
 #include <utility>
 
 #if DELPI_ENABLED_QSOPTEX
@@ -20,6 +28,18 @@
 #include <span>  // NOLINT(build/include_order): c++20 header
 #include <unordered_set>
 
+#include "delpi/solver/BackendSelector.h"
+#include "delpi/solver/BasisCertifier.h"
+#include "delpi/solver/BoundPropagation.h"
+#include "delpi/solver/Dualization.h"
+#include "delpi/solver/IntegerRow.h"
+#include "delpi/solver/Pdhg.h"
+#include "delpi/solver/ResultCache.h"
+#include "delpi/solver/SafeDualBound.h"
+#include "delpi/solver/Scaling.h"
+#include "delpi/solver/SensitivityAnalysis.h"
+#include "delpi/solver/TriangularCrash.h"
+#include "delpi/util/ThreadPool.h"
 #include "delpi/util/error.h"
 
 namespace delpi {
@@ -30,18 +50,149 @@ bool IsYes(std::string value) {
   std::ranges::transform(value, value.begin(), [](const unsigned char c) { return std::tolower(c); });
   return value == "yes" || value == "true" || value == "1" || value == "on";
 }
+
+/**
+ * Sort the `indices` and remove the duplicates.
+ * @param indices indices to normalise
+ * @param size number of valid indices
+ * @return sorted indices, without duplicates
+ */
+std::vector<int> SortedUniqueIndices(const std::span<const int> indices, [[maybe_unused]] const int size) {
+  std::vector<int> sorted{indices.begin(), indices.end()};
+  std::ranges::sort(sorted);
+  sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+  DELPI_ASSERT(sorted.empty() || (sorted.front() >= 0 && sorted.back() < size), "Index out of bounds");
+  return sorted;
+}
+
+/**
+ * Remove the elements at the `sorted` indices from the `statuses` of a basis.
+ * @param statuses statuses of the columns or rows of a basis
+ * @param sorted indices to remove, sorted in increasing order and without duplicates
+ * @param kept_basic whether the removed elements must be basic for the basis to remain valid
+ * @return true if the basis is still valid
+ * @return false if at least one of the removed elements is basic and `kept_basic` is false, or vice versa
+ */
+bool EraseBasisStatuses(std::vector<BasisStatus>& statuses, const std::span<const int> sorted,
+                        const bool kept_basic) {
+  std::size_t next = 0, write = 0;
+  bool valid = true;
+  for (std::size_t i = 0; i < statuses.size(); ++i) {
+    if (next < sorted.size() && static_cast<std::size_t>(sorted[next]) == i) {
+      valid = valid && (statuses[i] == BasisStatus::BASIC) == kept_basic;
+      ++next;
+      continue;
+    }
+    statuses[write++] = statuses[i];
+  }
+  statuses.resize(write);
+  return valid;
+}
+
+/** Minimum ratio between the number of rows and the number of columns for the automatic dualization to kick in. */
+constexpr int auto_dualize_ratio = 10;
+/** Minimum number of rows for the automatic dualization to kick in, below which building the dual does not pay off. */
+constexpr int auto_dualize_min_rows = 1000;
+
+/**
+ * Decide whether to solve the dual of the problem instead of the problem itself.
+ * The simplex works with a basis as large as the number of rows, while the dual problem has a row for each column.
+ * @param config configuration of the LP solver
+ * @param num_rows number of rows of the problem
+ * @param num_columns number of columns of the problem
+ * @return true if the dual problem should be solved
+ * @return false if the problem should be solved directly
+ */
+bool ShouldDualize(const Config& config, const int num_rows, const int num_columns) {
+  switch (config.dualize()) {
+    case Config::Dualize::ON:
+      return true;
+    case Config::Dualize::OFF:
+      return false;
+    default:
+      return num_rows >= auto_dualize_min_rows && num_rows >= auto_dualize_ratio * num_columns;
+  }
+}
+
+/**
+ * Pick the result of the whole problem between the results `a` and `b` of two of its independent blocks.
+ * An infeasible block makes the whole problem infeasible,
+ * while an unbounded block makes it unbounded only if all the others are optimal.
+ * @param a result of the first block
+ * @param b result of the second block
+ * @return result of the problem made of the two blocks
+ */
+LpResult CombineBlockResults(const LpResult a, const LpResult b) {
+  constexpr auto severity = [](const LpResult result) {
+    switch (result) {
+      case LpResult::OPTIMAL:
+        return 0;
+      case LpResult::DELTA_OPTIMAL:
+        return 1;
+      case LpResult::UNBOUNDED:
+        return 2;
+      case LpResult::INFEASIBLE:
+        return 4;
+      default:
+        return 3;
+    }
+  };
+  return severity(a) >= severity(b) ? a : b;
+}
+
+/**
+ * Adjust the `status` of a column or row in a basis to its bounds, after they have been changed.
+ * @param status current status of the column or row
+ * @param lb lower bound of the column or row. Equal to `ninfinity` if unbounded
+ * @param ub upper bound of the column or row. Equal to `infinity` if unbounded
+ * @param ninfinity negative infinity threshold value
+ * @param infinity infinity threshold value
+ * @return status compatible with the bounds
+ */
+BasisStatus BoundedStatus(const BasisStatus status, const mpq_class& lb, const mpq_class& ub,
+                          const mpq_class& ninfinity, const mpq_class& infinity) {
+  if (status == BasisStatus::BASIC || status == BasisStatus::UNDEFINED) return status;
+  const bool has_lb = lb > ninfinity, has_ub = ub < infinity;
+  if (has_lb && has_ub && lb == ub) return BasisStatus::FIXED;
+  if (status == BasisStatus::AT_UPPER && has_ub) return BasisStatus::AT_UPPER;
+  if (has_lb) return BasisStatus::AT_LOWER;
+  if (has_ub) return BasisStatus::AT_UPPER;
+  return BasisStatus::FREE;
+}
+
+/**
+ * Compute the number of LP solvers that can run in parallel, e.g., one for each chain of scenarios or block.
+ * Without a thread safe build, the symbolic layer cannot be shared among threads,
+ * while QSopt_ex relies on global state no matter the build.
+ * @param config configuration of the LP solver
+ * @param num_tasks number of independent tasks to run
+ * @return number of parallel jobs, between 1 and `num_tasks`, or 1 if there are no tasks
+ */
+std::size_t NumParallelJobs(const Config& config, [[maybe_unused]] const std::size_t num_tasks) {
+#ifdef DELPI_THREAD_SAFE
+  if (config.lp_solver() == Config::LpSolver::QSOPTEX) return 1;
+  return std::clamp<std::size_t>(config.number_of_jobs(), 1, std::max<std::size_t>(num_tasks, 1));
+#else
+  if (config.number_of_jobs() > 1)
+    DELPI_WARN_FMT("LpSolver: {} jobs requested, but delpi has not been built with --enable_thread_safe_build. Using 1",
+                   config.number_of_jobs());
+  return 1;
+#endif
+}
 }  // namespace
 
 LpSolver::LpSolver(mpq_class ninfinity, mpq_class infinity, Config config, const std::string& class_name)
     : config_{std::move(config)},
-      stats_{config.with_timings(), class_name, "Total time spent in Optimise", "Total # of Optimise"},
+      stats_{config_.with_timings(), class_name, "Total time spent in Optimise", "Total # of Optimise"},
+      profiler_{config_.with_timings()},
       var_to_col_{},
       col_to_var_{},
       solution_{},
       dual_solution_{},
       solve_cb_{},
       ninfinity_{std::move(ninfinity)},
-      infinity_{std::move(infinity)} {}
+      infinity_{std::move(infinity)},
+      changes_{} {}
 
 std::unique_ptr<LpSolver> LpSolver::GetInstance(const Config& config) {
   switch (config.lp_solver()) {
@@ -49,6 +200,9 @@ std::unique_ptr<LpSolver> LpSolver::GetInstance(const Config& config) {
       return std::make_unique<SoplexLpSolver>(config);
     case Config::LpSolver::QSOPTEX:
       return std::make_unique<QsoptexLpSolver>(config);
+    case Config::LpSolver::AUTO:
+      // Until a backend is selected, the problem is stored in SoPlex, the usual choice
+      return std::make_unique<SoplexLpSolver>(config);
     default:
       DELPI_UNREACHABLE();
   }
@@ -77,7 +231,7 @@ std::unordered_map<Variable, mpq_class> LpSolver::model(const std::vector<mpq_cl
 
 LpSolver::ColumnIndex LpSolver::AddColumn(const Column& column) {
   DELPI_ASSERT(!var_to_col_.contains(column.var), "Variable already exists in the LP.");
-  return AddColumn(column.var, column.obj.value_or(ninfinity_), column.lb.value_or(infinity_), column.ub.value_or(0));
+  return AddColumn(column.var, column.obj.value_or(0), column.lb.value_or(ninfinity_), column.ub.value_or(infinity_));
 }
 LpSolver::ColumnIndex LpSolver::AddColumn(const Variable& var) {
   DELPI_ASSERT(!var_to_col_.contains(var), "Variable already exists in the LP.");
@@ -105,6 +259,38 @@ LpSolver::RowIndex LpSolver::AddRow(const Expression& lhs, const FormulaKind sen
   return AddRow(lhs.addends(), sense, rhs);
 }
 
+std::vector<Column> LpSolver::columns() const {
+  std::vector<Column> columns;
+  columns.reserve(num_columns());
+  for (int i = 0; i < num_columns(); ++i) columns.emplace_back(column(i));
+  return columns;
+}
+std::vector<Row> LpSolver::rows() const {
+  std::vector<Row> rows;
+  rows.reserve(num_rows());
+  for (int i = 0; i < num_rows(); ++i) rows.emplace_back(row(i));
+  return rows;
+}
+
+ModelFeatures LpSolver::Features() const { return ModelFeatures{columns(), rows()}; }
+
+void LpSolver::SetBasis(const Basis& basis) {
+  if (basis.columns.size() != static_cast<std::size_t>(num_columns()) ||
+      basis.rows.size() != static_cast<std::size_t>(num_rows())) {
+    DELPI_RUNTIME_ERROR_FMT("The basis has {} columns and {} rows, but the problem has {} columns and {} rows",
+                            basis.columns.size(), basis.rows.size(), num_columns(), num_rows());
+  }
+  const auto count = [&basis](const BasisStatus status) {
+    return std::ranges::count(basis.columns, status) + std::ranges::count(basis.rows, status);
+  };
+  if (count(BasisStatus::BASIC) != num_rows())
+    DELPI_RUNTIME_ERROR_FMT("The basis has {} basic statuses instead of {}", count(BasisStatus::BASIC), num_rows());
+  if (count(BasisStatus::UNDEFINED) != 0) DELPI_RUNTIME_ERROR("The basis has undefined statuses");
+  LoadBasis(basis);
+  // The basis need not be optimal for any previous version of the problem
+  changes_.structure = true;
+}
+
 std::vector<Formula> LpSolver::constraints() const {
   std::vector<Formula> constraints;
   constraints.reserve(num_rows() + num_columns());
@@ -146,9 +332,12 @@ void LpSolver::ReserveColumns([[maybe_unused]] const int size) {
   DELPI_ASSERT(size >= 0, "Invalid number of columns.");
 }
 void LpSolver::ReserveRows([[maybe_unused]] const int size) { DELPI_ASSERT(size >= 0, "Invalid number of rows."); }
+void LpSolver::Interrupt() {}
+void LpSolver::ResetInterrupt() {}
 
 const std::string& LpSolver::GetInfo(const std::string& key) const { return info_.at(key); }
 void LpSolver::SetInfo(const std::string& key, const std::string& value) { info_.emplace(key, value); }
+void LpSolver::AddScenario(Scenario scenario) { scenarios_.push_back(std::move(scenario)); }
 void LpSolver::SetOption(const std::string& key, const std::string& value) {
   DELPI_TRACE_FMT("LpSolver::SetOption({}, {})", key, value);
   if (key == ":csv") {
@@ -180,19 +369,1004 @@ void LpSolver::SetObjective(const std::unordered_map<int, mpq_class>& objective)
 void LpSolver::SetObjective(const std::vector<mpq_class>& objective) {
   for (int i = 0; i < static_cast<int>(objective.size()); ++i) SetObjective(i, objective.at(i));
 }
+void LpSolver::RemoveRows(const std::span<const RowIndex> rows) {
+  DELPI_ASSERT(scopes_.empty(), "Cannot remove rows while a scope is open");
+  const std::vector<RowIndex> sorted{SortedUniqueIndices(rows, num_rows())};
+  if (sorted.empty()) return;
+  DELPI_DEBUG_FMT("LpSolver::RemoveRows: removing {} rows", sorted.size());
+  RemoveRowsCore(sorted);
+  changes_.structure = true;
+  solution_.clear();
+  dual_solution_.clear();
+  // Removing a row whose slack is basic leaves a valid basis of the smaller problem
+  if (!basis_.rows.empty() && !EraseBasisStatuses(basis_.rows, sorted, true)) basis_ = {};
+}
+void LpSolver::RemoveColumns(const std::span<const ColumnIndex> columns) {
+  DELPI_ASSERT(scopes_.empty(), "Cannot remove columns while a scope is open");
+  const std::vector<ColumnIndex> sorted{SortedUniqueIndices(columns, num_columns())};
+  if (sorted.empty()) return;
+  DELPI_DEBUG_FMT("LpSolver::RemoveColumns: removing {} columns", sorted.size());
+  RemoveColumnsCore(sorted);
+  changes_.structure = true;
+  for (const ColumnIndex column : sorted) var_to_col_.erase(col_to_var_[column]);
+  std::size_t next = 0;
+  ColumnIndex write = 0;
+  for (ColumnIndex column = 0; column < static_cast<ColumnIndex>(col_to_var_.size()); ++column) {
+    if (next < sorted.size() && sorted[next] == column) {
+      ++next;
+      continue;
+    }
+    if (write != column) {
+      var_to_col_[col_to_var_[column]] = write;
+      col_to_var_[write] = col_to_var_[column];
+    }
+    ++write;
+  }
+  col_to_var_.erase(col_to_var_.begin() + write, col_to_var_.end());
+  solution_.clear();
+  dual_solution_.clear();
+  // Removing a non-basic column leaves a valid basis of the smaller problem
+  if (!basis_.columns.empty() && !EraseBasisStatuses(basis_.columns, sorted, false)) basis_ = {};
+}
+void LpSolver::Push() {
+  scopes_.push_back({num_columns(), num_rows(), bound_trail_.size(), row_bound_trail_.size(), objective_trail_.size(),
+                     CurrentBasis()});
+  DELPI_TRACE_FMT("LpSolver::Push: {} scopes open", scopes_.size());
+}
+void LpSolver::Pop(const int n) {
+  DELPI_ASSERT(n > 0 && n <= num_scopes(), "Cannot close more scopes than the open ones");
+  Scope scope{std::move(scopes_[scopes_.size() - n])};
+  scopes_.erase(scopes_.end() - n, scopes_.end());
+  DELPI_TRACE_FMT("LpSolver::Pop: {} scopes open", scopes_.size());
+
+  Basis basis{CurrentBasis()};
+  bool keep_basis = !basis.columns.empty();
+  bool basis_changed = false;
+  while (objective_trail_.size() > scope.num_objective_changes) {
+    const ObjectiveChange& change = objective_trail_.back();
+    SetObjectiveCore(change.column, change.obj);
+    objective_trail_.pop_back();
+    changes_.objective = true;
+  }
+  while (bound_trail_.size() > scope.num_bound_changes) {
+    const BoundChange& change = bound_trail_.back();
+    SetBoundCore(col_to_var_[change.column], change.lb, change.ub);
+    // The status of a non-basic column may refer to a bound that no longer exists
+    if (keep_basis && change.column < scope.num_columns) {
+      basis.columns[change.column] =
+          BoundedStatus(basis.columns[change.column], change.lb, change.ub, ninfinity_, infinity_);
+    }
+    bound_trail_.pop_back();
+    basis_changed = true;
+    changes_.bounds = true;
+  }
+  while (row_bound_trail_.size() > scope.num_row_bound_changes) {
+    const RowBoundChange& change = row_bound_trail_.back();
+    SetRowBoundCore(change.row, change.lb, change.ub);
+    if (keep_basis && change.row < scope.num_rows) {
+      basis.rows[change.row] = BoundedStatus(basis.rows[change.row], change.lb, change.ub, ninfinity_, infinity_);
+    }
+    row_bound_trail_.pop_back();
+    basis_changed = true;
+    changes_.bounds = true;
+  }
+
+  // The current basis remains valid only if the removed rows have a basic slack and the removed columns are non-basic
+  if (scope.num_rows < num_rows()) {
+    std::vector<RowIndex> rows(num_rows() - scope.num_rows);
+    std::iota(rows.begin(), rows.end(), scope.num_rows);
+    RemoveRowsCore(rows);
+    if (keep_basis) {
+      keep_basis = std::all_of(basis.rows.begin() + scope.num_rows, basis.rows.end(),
+                               [](const BasisStatus status) { return status == BasisStatus::BASIC; });
+      basis.rows.erase(basis.rows.begin() + scope.num_rows, basis.rows.end());
+    }
+    basis_changed = true;
+  }
+  if (scope.num_columns < num_columns()) {
+    std::vector<ColumnIndex> columns(num_columns() - scope.num_columns);
+    std::iota(columns.begin(), columns.end(), scope.num_columns);
+    RemoveColumnsCore(columns);
+    for (const ColumnIndex column_idx : columns) var_to_col_.erase(col_to_var_[column_idx]);
+    col_to_var_.erase(col_to_var_.begin() + scope.num_columns, col_to_var_.end());
+    if (keep_basis) {
+      keep_basis = std::none_of(basis.columns.begin() + scope.num_columns, basis.columns.end(),
+                                [](const BasisStatus status) { return status == BasisStatus::BASIC; });
+      basis.columns.erase(basis.columns.begin() + scope.num_columns, basis.columns.end());
+    }
+    basis_changed = true;
+  }
+
+  solution_.clear();
+  dual_solution_.clear();
+  basis_ = {};
+  if (!keep_basis) {
+    basis = std::move(scope.basis);
+    basis_changed = true;
+    changes_.structure = true;
+  }
+  if (basis_changed && !basis.columns.empty()) LoadBasis(basis);
+}
+
 LpResult LpSolver::Solve(mpq_class& precision, const bool store_solution) {
   DELPI_ASSERT(num_rows() > 0, "Cannot optimise without rows.");
   DELPI_ASSERT(num_columns() > 0, "Cannot optimise without columns.");
   DELPI_DEBUG_FMT("LpSolver::Solve({}, {})", precision, store_solution);
   const TimerGuard timer_guard(&stats_.m_timer(), stats_.enabled());
+  const ProfilerGuard profiler_guard{profiler_, "solve"};
+  stats_.Increase();
+  solution_.clear();
+  dual_solution_.clear();
+  basis_ = {};
+  LpResult result = LpResult::UNSOLVED;
+  if (config_.scaling()) result = SolveScaled(precision, store_solution);
+  if (result == LpResult::UNSOLVED && ShouldDualize(config_, num_rows(), num_columns())) {
+    result = SolveDualized(precision, store_solution);
+  }
+  if (result == LpResult::UNSOLVED && config_.cache_dir().empty()) {
+    result = SolvePropagated(precision, store_solution);
+  } else if (result == LpResult::UNSOLVED) {
+    result = SolveCached(precision, store_solution);
+  }
+  changes_ = {false, false, false, num_columns(), num_rows()};
+  if (solve_cb_) solve_cb_(*this, result, solution_, dual_solution_, obj_lb_, obj_ub_, precision);
+  return result;
+}
+LpResult LpSolver::SolveDecomposed(mpq_class& precision, const bool store_solution) {
+  DELPI_ASSERT(num_rows() > 0, "Cannot optimise without rows.");
+  DELPI_ASSERT(num_columns() > 0, "Cannot optimise without columns.");
+  const std::vector<Column> problem_columns{columns()};
+  const std::vector<Row> problem_rows{rows()};
+  const Decomposition decomposition{problem_rows, var_to_col_, num_columns(), config_.number_of_jobs()};
+  if (decomposition.size() < 2) return Solve(precision, store_solution);
+  DELPI_DEBUG_FMT("LpSolver::SolveDecomposed({}, {}): {} blocks", precision, store_solution, decomposition.size());
+  const TimerGuard timer_guard(&stats_.m_timer(), stats_.enabled());
+  const ProfilerGuard profiler_guard{profiler_, "decompose"};
   stats_.Increase();
+  profiler_.Count("blocks", decomposition.size());
   solution_.clear();
   dual_solution_.clear();
-  const LpResult result = SolveCore(precision, store_solution);
+  basis_ = {};
+
+  const std::vector<Decomposition::Block>& blocks = decomposition.blocks();
+  std::vector<BlockSolution> solutions(blocks.size());
+  std::vector<std::unique_ptr<LpSolver>> solvers(blocks.size());
+  std::vector<std::size_t> lp_blocks;
+  for (std::size_t b = 0; b < blocks.size(); ++b) {
+    if (blocks[b].rows.empty() || blocks[b].columns.empty()) {
+      solutions[b] = SolveTrivialBlock(blocks[b], problem_columns, problem_rows);
+    } else {
+      solvers[b] = BlockSolver(blocks[b], problem_columns, problem_rows);
+      lp_blocks.push_back(b);
+    }
+  }
+  const auto solve_block = [&](const std::size_t b) {
+    BlockSolution& solution = solutions[b];
+    solution.precision = precision;
+    solution.result = solvers[b]->Solve(solution.precision, store_solution);
+    solution.obj_lb = solvers[b]->obj_lb_;
+    solution.obj_ub = solvers[b]->obj_ub_;
+    solution.solution = std::move(solvers[b]->solution_);
+    solution.dual_solution = std::move(solvers[b]->dual_solution_);
+    solution.basis = std::move(solvers[b]->basis_);
+  };
+  const std::size_t num_jobs = NumParallelJobs(config_, lp_blocks.size());
+  if (num_jobs > 1) {
+    ThreadPool pool{static_cast<unsigned int>(num_jobs)};
+    std::vector<std::future<void>> futures;
+    futures.reserve(lp_blocks.size());
+    for (const std::size_t b : lp_blocks) futures.emplace_back(pool.Submit([&, b]() { solve_block(b); }));
+    for (std::future<void>& future : futures) future.get();
+  } else {
+    for (const std::size_t b : lp_blocks) solve_block(b);
+  }
+
+  LpResult result = LpResult::OPTIMAL;
+  for (const BlockSolution& solution : solutions) result = CombineBlockResults(result, solution.result);
+  DELPI_DEBUG_FMT("LpSolver::SolveDecomposed: {} blocks solved in {} jobs, result {}", blocks.size(), num_jobs,
+                  result);
+  if (result == LpResult::OPTIMAL || result == LpResult::DELTA_OPTIMAL) {
+    // The blocks share no row or column, so the objective is the sum of theirs and so are its bounds
+    precision = 0;
+    obj_lb_ = 0;
+    obj_ub_ = 0;
+    for (const BlockSolution& solution : solutions) {
+      precision = std::max(precision, solution.precision);
+      obj_lb_ += solution.obj_lb;
+      obj_ub_ += solution.obj_ub;
+    }
+    if (store_solution) {
+      solution_.resize(num_columns());
+      dual_solution_.resize(num_rows());
+      const bool has_basis = std::ranges::none_of(solutions, [](const BlockSolution& solution) {
+        return solution.basis.columns.empty() && solution.basis.rows.empty();
+      });
+      if (has_basis) basis_ = Basis{std::vector<BasisStatus>(num_columns()), std::vector<BasisStatus>(num_rows())};
+      for (std::size_t b = 0; b < blocks.size(); ++b) {
+        for (std::size_t j = 0; j < blocks[b].columns.size(); ++j) {
+          solution_[blocks[b].columns[j]] = std::move(solutions[b].solution[j]);
+          if (has_basis) basis_.columns[blocks[b].columns[j]] = solutions[b].basis.columns[j];
+        }
+        for (std::size_t i = 0; i < blocks[b].rows.size(); ++i) {
+          dual_solution_[blocks[b].rows[i]] = std::move(solutions[b].dual_solution[i]);
+          if (has_basis) basis_.rows[blocks[b].rows[i]] = solutions[b].basis.rows[i];
+        }
+      }
+    }
+  } else if (result == LpResult::INFEASIBLE && store_solution) {
+    // Keep the dual solution sized as for any other infeasible result, even though it is not a certificate
+    dual_solution_.assign(num_rows(), 0);
+  }
   if (solve_cb_) solve_cb_(*this, result, solution_, dual_solution_, obj_lb_, obj_ub_, precision);
   return result;
 }
+std::vector<ScenarioResult> LpSolver::SolveScenarios(const std::span<const Scenario> scenarios,
+                                                     const mpq_class& precision, const bool store_solution) {
+  std::vector<ScenarioResult> results(scenarios.size());
+  if (scenarios.empty()) return results;
+  const ProfilerGuard profiler_guard{profiler_, "scenarios"};
+  profiler_.Count("scenarios", scenarios.size());
+  const std::size_t num_chains = NumParallelJobs(config_, scenarios.size());
+  DELPI_DEBUG_FMT("LpSolver::SolveScenarios: {} scenarios in {} chains", scenarios.size(), num_chains);
+
+  // The callback reports on the problem as a whole, not on its scenarios
+  SolveCallback solve_cb{std::move(solve_cb_)};
+  solve_cb_ = nullptr;
+  // Each chain is a contiguous range of scenarios, since consecutive ones are usually the most similar
+  const auto chain_begin = [&](const std::size_t chain) { return chain * scenarios.size() / num_chains; };
+  const auto chain_size = [&](const std::size_t chain) { return chain_begin(chain + 1) - chain_begin(chain); };
+  if (num_chains > 1) {
+    std::vector<std::unique_ptr<LpSolver>> clones;
+    clones.reserve(num_chains - 1);
+    for (std::size_t chain = 1; chain < num_chains; ++chain) clones.emplace_back(Clone());
+    ThreadPool pool{static_cast<unsigned int>(num_chains - 1)};
+    std::vector<std::future<void>> futures;
+    futures.reserve(num_chains - 1);
+    for (std::size_t chain = 1; chain < num_chains; ++chain) {
+      futures.emplace_back(pool.Submit([&, chain]() {
+        clones[chain - 1]->SolveScenarioChain(scenarios.subspan(chain_begin(chain), chain_size(chain)), precision,
+                                              store_solution,
+                                              std::span{results}.subspan(chain_begin(chain), chain_size(chain)));
+      }));
+    }
+    SolveScenarioChain(scenarios.first(chain_size(0)), precision, store_solution,
+                       std::span{results}.first(chain_size(0)));
+    for (std::future<void>& future : futures) future.get();
+  } else {
+    SolveScenarioChain(scenarios, precision, store_solution, results);
+  }
+  solve_cb_ = std::move(solve_cb);
+  return results;
+}
+void LpSolver::SolveScenarioChain(const std::span<const Scenario> scenarios, const mpq_class& precision,
+                                  const bool store_solution, const std::span<ScenarioResult> results) {
+  for (std::size_t i = 0; i < scenarios.size(); ++i) {
+    const Scenario& scenario = scenarios[i];
+    DELPI_DEBUG_FMT("LpSolver::SolveScenarioChain: solving scenario {}", scenario.name);
+    Push();
+    for (const auto& [index, lb, ub] : scenario.rows) {
+      SetRowBound(index, lb.value_or(ninfinity_), ub.value_or(infinity_));
+    }
+    for (const auto& [index, lb, ub] : scenario.columns) {
+      SetBound(col_to_var_.at(index), lb.value_or(ninfinity_), ub.value_or(infinity_));
+    }
+    ScenarioResult& result = results[i];
+    result.name = scenario.name;
+    result.precision = precision;
+    result.result = Solve(result.precision, store_solution);
+    result.obj_lb = obj_lb_;
+    result.obj_ub = obj_ub_;
+    if (store_solution) result.solution = solution_;
+    // Only bounds have changed, so the basis of this scenario is kept as the starting point of the next one
+    Pop();
+  }
+}
+
+std::unique_ptr<LpSolver> LpSolver::BlockSolver(const Decomposition::Block& block,
+                                                const std::vector<Column>& problem_columns,
+                                                const std::vector<Row>& problem_rows) const {
+  std::unique_ptr<LpSolver> solver{GetInstance(config_)};
+  solver->ReserveColumns(static_cast<int>(block.columns.size()));
+  solver->ReserveRows(static_cast<int>(block.rows.size()));
+  for (const int j : block.columns) solver->AddColumn(problem_columns[j]);
+  for (const int i : block.rows) {
+    // Variables with a zero coefficient may belong to other blocks, so they must not reach the block's solver
+    Row row{problem_rows[i]};
+    std::erase_if(row.addends, [](const auto& addend) { return addend.second == 0; });
+    solver->AddRow(row);
+  }
+  return solver;
+}
+LpSolver::BlockSolution LpSolver::SolveTrivialBlock(const Decomposition::Block& block,
+                                                    const std::vector<Column>& problem_columns,
+                                                    const std::vector<Row>& problem_rows) const {
+  BlockSolution solution{LpResult::OPTIMAL, 0, 0, 0, {}, {}, {}};
+  if (block.columns.empty()) {
+    DELPI_ASSERT(block.rows.size() == 1u, "A block without columns must contain a single row");
+    const Row& row = problem_rows[block.rows.front()];
+    if (row.lb.value_or(0) > 0 || row.ub.value_or(0) < 0) solution.result = LpResult::INFEASIBLE;
+    solution.dual_solution.emplace_back(0);
+    solution.basis.rows.push_back(BasisStatus::BASIC);
+    return solution;
+  }
+  DELPI_ASSERT(block.columns.size() == 1u && block.rows.empty(), "A block without rows must contain a single column");
+  const Column& column = problem_columns[block.columns.front()];
+  const mpq_class obj{column.obj.value_or(0)};
+  if (column.lb.has_value() && column.ub.has_value() && *column.lb > *column.ub) {
+    solution.result = LpResult::INFEASIBLE;
+  } else if ((obj > 0 && !column.lb.has_value()) || (obj < 0 && !column.ub.has_value())) {
+    solution.result = LpResult::UNBOUNDED;
+  }
+  if (solution.result != LpResult::OPTIMAL) return solution;
+  // The objective is minimised, so the column is moved to the bound its coefficient points to, if any
+  const BasisStatus status = BoundedStatus(obj < 0 ? BasisStatus::AT_UPPER : BasisStatus::AT_LOWER,
+                                           column.lb.value_or(ninfinity_), column.ub.value_or(infinity_), ninfinity_,
+                                           infinity_);
+  const mpq_class value{status == BasisStatus::AT_UPPER ? *column.ub
+                        : status == BasisStatus::FREE   ? mpq_class{0}
+                                                        : *column.lb};
+  solution.obj_lb = solution.obj_ub = obj * value;
+  solution.solution.push_back(value);
+  solution.basis.columns.push_back(status);
+  return solution;
+}
+
+SensitivityReport LpSolver::Sensitivity() const {
+  if (basis_.columns.empty()) DELPI_RUNTIME_ERROR("LpSolver::Sensitivity: no basis available, solve the problem first");
+  const std::vector<Column> problem_columns{columns()};
+  const std::vector<Row> problem_rows{rows()};
+  const SensitivityAnalysis analysis{problem_columns, problem_rows, var_to_col_, basis_, config_.number_of_jobs()};
+  if (!analysis.optimal()) DELPI_RUNTIME_ERROR("LpSolver::Sensitivity: the basis is not optimal");
+  return analysis.Report();
+}
+
+std::vector<ParametricSegment> LpSolver::SolveParametric(const std::span<const mpq_class> direction,
+                                                         const mpq_class& t_lb, const mpq_class& t_ub) {
+  DELPI_ASSERT(static_cast<int>(direction.size()) == num_columns(), "The direction must have a value for each column");
+  if (t_lb > t_ub) DELPI_INVALID_ARGUMENT("t_lb", fmt::format("{} is greater than t_ub {}", t_lb, t_ub));
+  const ProfilerGuard profiler_guard{profiler_, "parametric"};
+  std::vector<Column> problem_columns{columns()};
+  const std::vector<Row> problem_rows{rows()};
+  std::vector<mpq_class> objective;
+  objective.reserve(problem_columns.size());
+  for (const Column& column : problem_columns) objective.push_back(column.obj.value_or(0));
+  const auto dot = [](const std::span<const mpq_class> lhs, const std::vector<mpq_class>& rhs) {
+    mpq_class value{0};
+    for (std::size_t j = 0; j < rhs.size(); ++j) value += lhs[j] * rhs[j];
+    return value;
+  };
+
+  // The only full solve, for t = t_lb, in a scope that restores the objective
+  Push();
+  for (ColumnIndex j = 0; j < num_columns(); ++j) {
+    if (direction[j] != 0) SetObjective(j, objective[j] + t_lb * direction[j]);
+  }
+  mpq_class precision{0};
+  const LpResult result = Solve(precision, true);
+  std::vector<mpq_class> solution{std::move(solution_)}, dual_solution{std::move(dual_solution_)};
+  Basis basis{std::move(basis_)};
+  Pop();
+  solution_ = std::move(solution);
+  dual_solution_ = std::move(dual_solution);
+  basis_ = basis;
+  if (result != LpResult::OPTIMAL) return {{t_lb, t_ub, result, 0, 0, {}}};
+  if (basis.columns.empty()) DELPI_RUNTIME_ERROR("LpSolver::SolveParametric: the LP solver did not provide a basis");
+
+  // Walk the breakpoints. The basis is refactorised after each pivot
+  std::vector<ParametricSegment> segments;
+  mpq_class t{t_lb};
+  while (true) {
+    for (std::size_t j = 0; j < problem_columns.size(); ++j) problem_columns[j].obj = objective[j] + t * direction[j];
+    const SensitivityAnalysis analysis{problem_columns, problem_rows, var_to_col_, std::move(basis),
+                                       config_.number_of_jobs()};
+    if (!analysis.optimal()) DELPI_RUNTIME_ERROR("LpSolver::SolveParametric: the basis is not optimal");
+    const SensitivityRange range{analysis.ParametricRange(direction)};
+    const mpq_class end{range.ub.has_value() && t + *range.ub < t_ub ? mpq_class{t + *range.ub} : t_ub};
+    // Bases that are optimal for a single value of t are only an intermediate step towards the next segment
+    if (end > t || t_lb == t_ub) {
+      DELPI_DEBUG_FMT("LpSolver::SolveParametric: new segment [{}, {}]", t, end);
+      segments.push_back({t, end, LpResult::OPTIMAL, dot(objective, analysis.solution()),
+                          dot(direction, analysis.solution()), analysis.solution()});
+    }
+    if (end == t_ub) break;
+
+    profiler_.Count("pivots");
+    std::optional<Basis> next{analysis.NextBasis(direction, end - t)};
+    t = end;
+    if (!next.has_value()) {
+      segments.push_back({t, t_ub, LpResult::UNBOUNDED, 0, 0, {}});
+      break;
+    }
+    if (next->columns == analysis.basis().columns && next->rows == analysis.basis().rows) {
+      DELPI_RUNTIME_ERROR("LpSolver::SolveParametric: no pivot can move past the breakpoint");
+    }
+    basis = std::move(*next);
+  }
+  return segments;
+}
+
+LpResult LpSolver::SolveLexicographic(const std::span<const Expression> objectives, mpq_class& precision,
+                                      const bool store_solution) {
+  DELPI_ASSERT(!objectives.empty(), "There must be at least one objective");
+  const ProfilerGuard profiler_guard{profiler_, "lexicographic"};
+  const std::vector<Row> problem_rows{rows()};
+  const mpq_class requested_precision{precision};
+  precision = 0;
+  // Dense objective of each stage, checked before the problem is modified
+  std::vector<std::vector<mpq_class>> stage_objectives(objectives.size(), std::vector<mpq_class>(num_columns()));
+  for (std::size_t stage = 0; stage < objectives.size(); ++stage) {
+    for (const auto& [var, coeff] : objectives[stage].addends()) {
+      const auto it = var_to_col_.find(var);
+      if (it == var_to_col_.end()) DELPI_INVALID_ARGUMENT("objectives", fmt::format("unknown variable {}", var));
+      stage_objectives[stage][it->second] = coeff;
+    }
+  }
+
+  // The callback reports on the problem as a whole, not on its stages
+  SolveCallback solve_cb{std::move(solve_cb_)};
+  solve_cb_ = nullptr;
+  Push();
+  LpResult result = LpResult::OPTIMAL;
+  for (std::size_t stage = 0; stage < objectives.size(); ++stage) {
+    profiler_.Count("stages");
+    std::vector<mpq_class>& objective = stage_objectives[stage];
+    for (ColumnIndex j = 0; j < num_columns(); ++j) {
+      if (column(j).obj.value_or(0) != objective[j]) SetObjective(j, objective[j]);
+    }
+
+    mpq_class stage_precision{requested_precision};
+    const LpResult stage_result = Solve(stage_precision, true);
+    DELPI_DEBUG_FMT("LpSolver::SolveLexicographic: stage {} is {}", stage, stage_result);
+    if (stage_result != LpResult::OPTIMAL && stage_result != LpResult::DELTA_OPTIMAL) {
+      result = stage_result;
+      break;
+    }
+    if (stage_result == LpResult::DELTA_OPTIMAL) result = LpResult::DELTA_OPTIMAL;
+    precision = std::max(precision, stage_precision);
+    if (stage + 1 == objectives.size()) break;
+
+    // Complementary slackness: the optimal face is where the columns with a non-zero reduced cost
+    // and the rows with a non-zero dual do not move from their current value
+    DELPI_ASSERT(static_cast<int>(dual_solution_.size()) == num_rows(), "There must be a dual value for each row");
+    std::vector<mpq_class> reduced_costs{std::move(objective)};
+    for (RowIndex i = 0; i < num_rows(); ++i) {
+      if (dual_solution_[i] == 0) continue;
+      mpq_class activity{0};
+      for (const auto& [var, coeff] : problem_rows[i].addends) {
+        const ColumnIndex j = var_to_col_.at(var);
+        reduced_costs[j] -= coeff * dual_solution_[i];
+        activity += coeff * solution_[j];
+      }
+      SetRowBound(i, activity, activity);
+      profiler_.Count("fixed_rows");
+    }
+    for (ColumnIndex j = 0; j < num_columns(); ++j) {
+      if (reduced_costs[j] == 0) continue;
+      SetBound(col_to_var_[j], solution_[j], solution_[j]);
+      profiler_.Count("fixed_columns");
+    }
+  }
+  // Closing the scope discards the solution of the last stage, so it is kept aside.
+  // The final basis is not, since it belongs to the restricted problem
+  std::vector<mpq_class> solution{std::move(solution_)}, dual_solution{std::move(dual_solution_)};
+  Pop();
+  if (store_solution) {
+    solution_ = std::move(solution);
+    dual_solution_ = std::move(dual_solution);
+  }
+
+  solve_cb_ = std::move(solve_cb);
+  if (solve_cb_) solve_cb_(*this, result, solution_, dual_solution_, obj_lb_, obj_ub_, precision);
+  return result;
+}
+
+std::unique_ptr<LpSolver> LpSolver::Clone() const { return Clone(config_); }
+
+std::unique_ptr<LpSolver> LpSolver::Clone(const Config& config) const {
+  std::unique_ptr<LpSolver> clone{GetInstance(config)};
+  clone->ReserveColumns(num_columns());
+  clone->ReserveRows(num_rows());
+  for (int i = 0; i < num_columns(); ++i) clone->AddColumn(column(i));
+  for (int i = 0; i < num_rows(); ++i) clone->AddRow(row(i));
+  clone->info_ = info_;
+  const Basis basis{CurrentBasis()};
+  if (!basis.columns.empty()) clone->LoadBasis(basis);
+  return clone;
+}
+
+std::unique_ptr<LpSolver> LpSolver::SelectBackend() const {
+  if (config_.lp_solver() != Config::LpSolver::AUTO) return nullptr;
+  const BackendSelector selector{config_.lp_solver_rules().empty() ? BackendSelector{}
+                                                                   : BackendSelector::Load(config_.lp_solver_rules())};
+  const Config config{selector.Select(Features(), config_)};
+  DELPI_DEBUG_FMT("LpSolver::SelectBackend: picked {} in mode {}", config.lp_solver(), config.lp_mode());
+  std::unique_ptr<LpSolver> selected{Clone(config)};
+  selected->scenarios_ = scenarios_;
+  selected->solve_cb_ = solve_cb_;
+  selected->partial_solve_cb_ = partial_solve_cb_;
+  return selected;
+}
+
+LpResult LpSolver::SolveDualized(mpq_class& precision, const bool store_solution) {
+  const ProfilerGuard profiler_guard{profiler_, "dualize"};
+  Dualization dualization{columns(), rows(), var_to_col_, &dual_variables_};
+  if (dualization.columns().empty()) return LpResult::UNSOLVED;
+  if (dual_solver_ != nullptr && dualization.SameStructure(*dualization_)) {
+    // Only the bounds or the objective of the LP problem have changed, so the dual LP solver keeps its basis
+    profiler_.Count("reuses");
+    for (int k = 0; k < static_cast<int>(dualization.columns().size()); ++k) {
+      const std::optional<mpq_class>& obj = dualization.columns()[k].obj;
+      if (obj != dualization_->columns()[k].obj) dual_solver_->SetObjective(k, obj.value_or(0));
+    }
+    for (RowIndex j = 0; j < static_cast<RowIndex>(dualization.rows().size()); ++j) {
+      const Row& dual_row = dualization.rows()[j];
+      if (dual_row.lb != dualization_->rows()[j].lb) dual_solver_->SetRowBound(j, *dual_row.lb, *dual_row.ub);
+    }
+  } else {
+    Config config{config_};
+    config.m_dualize() = Config::Dualize::OFF;
+    dual_solver_ = GetInstance(config);
+    dual_solver_->ReserveColumns(static_cast<int>(dualization.columns().size()));
+    dual_solver_->ReserveRows(static_cast<int>(dualization.rows().size()));
+    for (const Column& column : dualization.columns()) dual_solver_->AddColumn(column);
+    for (const Row& row : dualization.rows()) dual_solver_->AddRow(row);
+  }
+  dualization_ = std::move(dualization);
+  if (partial_solve_cb_) {
+    dual_solver_->m_partial_solve_cb() = [this](const LpSolver&, const LpResult result, const std::vector<mpq_class>& x,
+                                                const std::vector<mpq_class>& y, const mpq_class& obj_lb,
+                                                const mpq_class& obj_ub, const mpq_class& diff,
+                                                const mpq_class& delta) {
+      return partial_solve_cb_(*this, result, dualization_->PrimalSolution(y), dualization_->DualSolution(x), -obj_ub,
+                               -obj_lb, diff, delta);
+    };
+  } else {
+    dual_solver_->m_partial_solve_cb() = nullptr;
+  }
+
+  mpq_class dual_precision{precision};
+  const LpResult dual_result = dual_solver_->Solve(dual_precision, store_solution);
+  profiler_.Merge(dual_solver_->profiler());
+  dual_solver_->m_profiler().Reset();
+  DELPI_DEBUG_FMT("LpSolver::SolveDualized: the dual problem is {}", dual_result);
+  switch (dual_result) {
+    case LpResult::OPTIMAL:
+    case LpResult::DELTA_OPTIMAL:
+      break;
+    case LpResult::UNBOUNDED:
+      // Keep the dual solution sized as for any other infeasible result, even though it is not a certificate
+      if (store_solution) dual_solution_.assign(num_rows(), 0);
+      return LpResult::INFEASIBLE;
+    case LpResult::INFEASIBLE:
+      // The original problem is either infeasible or unbounded, and only solving it can tell which
+      profiler_.Count("fallbacks");
+      return LpResult::UNSOLVED;
+    default:
+      return dual_result;
+  }
+  // By strong duality, the optimal objective value is the opposite of the one of the dual problem, which is minimised
+  precision = dual_precision;
+  obj_lb_ = -dual_solver_->obj_ub_;
+  obj_ub_ = -dual_solver_->obj_lb_;
+  if (store_solution) {
+    solution_ = dualization_->PrimalSolution(dual_solver_->dual_solution_);
+    dual_solution_ = dualization_->DualSolution(dual_solver_->solution_);
+    if (std::optional<Basis> basis = dualization_->PrimalBasis(dual_solver_->basis_)) basis_ = std::move(*basis);
+  }
+  return dual_result;
+}
+
+LpResult LpSolver::SolveScaled(mpq_class& precision, const bool store_solution) {
+  const ProfilerGuard profiler_guard{profiler_, "scale"};
+  const Scaling scaling{columns(), rows(), var_to_col_};
+  profiler_.Count("passes", scaling.passes());
+  if (scaling.identity()) return LpResult::UNSOLVED;
+  Config config{config_};
+  config.m_scaling() = false;
+  const std::unique_ptr<LpSolver> scaled{GetInstance(config)};
+  scaled->ReserveColumns(num_columns());
+  scaled->ReserveRows(num_rows());
+  for (const Column& column : scaling.columns()) scaled->AddColumn(column);
+  for (const Row& row : scaling.rows()) scaled->AddRow(row);
+  if (const Basis basis{CurrentBasis()}; !basis.columns.empty()) scaled->LoadBasis(basis);
+
+  mpq_class scaled_precision{scaling.ScaledPrecision(precision)};
+  const LpResult result = scaled->Solve(scaled_precision, store_solution);
+  DELPI_DEBUG_FMT("LpSolver::SolveScaled: the scaled problem is {}", result);
+  if (result == LpResult::ERROR) return result;
+  // Multiplying the columns by the scale factors and dividing the objective coefficients by them cancel out
+  precision = scaling.OriginalPrecision(scaled_precision);
+  obj_lb_ = scaled->obj_lb_;
+  obj_ub_ = scaled->obj_ub_;
+  if (store_solution) {
+    if (!scaled->solution_.empty()) solution_ = scaling.PrimalSolution(scaled->solution_);
+    if (!scaled->dual_solution_.empty()) dual_solution_ = scaling.DualSolution(scaled->dual_solution_);
+    basis_ = scaled->basis_;
+  }
+  if (const Basis basis{scaled->CurrentBasis()}; !basis.columns.empty()) LoadBasis(basis);
+  return result;
+}
+
+Config::SimplexAlgorithm LpSolver::NextSimplexAlgorithm() const {
+  if (config_.simplex() != Config::SimplexAlgorithm::AUTO) return config_.simplex();
+  // Rows or columns may have been added since the last solve, so its basis may not fit the problem anymore
+  if (changes_.structure || changes_.num_columns != num_columns() || changes_.num_rows != num_rows()) {
+    return Config::SimplexAlgorithm::AUTO;
+  }
+  // The previous optimal basis is still dual feasible after bound changes and primal feasible after objective ones
+  if (changes_.bounds && !changes_.objective) return Config::SimplexAlgorithm::DUAL;
+  if (changes_.objective && !changes_.bounds) return Config::SimplexAlgorithm::PRIMAL;
+  return Config::SimplexAlgorithm::AUTO;
+}
+
+void LpSolver::WarmStart() {
+  if (config_.warm_start() == Config::WarmStart::NONE || !CurrentBasis().columns.empty()) return;
+  if (config_.warm_start() == Config::WarmStart::CRASH) {
+    const ProfilerGuard profiler_guard{profiler_, "crash"};
+    const TriangularCrash crash{columns(), rows(), var_to_col_};
+    profiler_.Count("structural", crash.num_structural());
+    LoadBasis(crash.basis());
+    return;
+  }
+  const ProfilerGuard profiler_guard{profiler_, "pdhg"};
+  const Pdhg pdhg{columns(), rows(), var_to_col_, config_.number_of_jobs()};
+  const Pdhg::Result result{
+      pdhg.Solve(static_cast<int>(std::min<unsigned int>(config_.pdhg_iterations(), std::numeric_limits<int>::max())),
+                 config_.pdhg_tolerance())};
+  profiler_.Count("iterations", result.iterations);
+  profiler_.Count("restarts", result.restarts);
+  DELPI_DEBUG_FMT("LpSolver::WarmStart: {}", result);
+  // Even if the method has not converged, the iterate is a better guess than the slack basis
+  LoadBasis(pdhg.CrashBasis(result, config_.pdhg_tolerance()));
+}
+
+std::vector<Column> LpSolver::Propagate() {
+  if (config_.propagation_rounds() == 0) return {};
+  if (changes_.bounds || changes_.structure || changes_.num_columns != num_columns() ||
+      changes_.num_rows != num_rows()) {
+    const ProfilerGuard profiler_guard{profiler_, "propagate"};
+    const std::vector<Column> original{columns()};
+    const BoundPropagation propagation{
+        original, rows(), var_to_col_,
+        static_cast<int>(std::min<unsigned int>(config_.propagation_rounds(), std::numeric_limits<int>::max()))};
+    profiler_.Count("rounds", propagation.rounds());
+    propagated_.clear();
+    if (propagation.infeasible()) {
+      // The underlying solver still has to provide the certificate
+      profiler_.Count("infeasible");
+    } else {
+      for (ColumnIndex column_idx = 0; column_idx < num_columns(); ++column_idx) {
+        const Column& tightened = propagation.columns()[column_idx];
+        if (tightened.lb == original[column_idx].lb && tightened.ub == original[column_idx].ub) continue;
+        propagated_.push_back(tightened);
+      }
+    }
+    profiler_.Count("tightened", propagated_.size());
+    DELPI_DEBUG_FMT("LpSolver::Propagate: {} columns tightened in {} rounds", propagated_.size(),
+                    propagation.rounds());
+  }
+
+  std::vector<Column> original;
+  original.reserve(propagated_.size());
+  for (const Column& tightened : propagated_) {
+    original.push_back(column(var_to_col_.at(tightened.var)));
+    SetBoundCore(tightened.var, tightened.lb.value_or(ninfinity_), tightened.ub.value_or(infinity_));
+  }
+  return original;
+}
+
+bool LpSolver::HoldsWithoutPropagation(const LpResult result, const std::vector<Column>& original) const {
+  if (result == LpResult::INFEASIBLE) {
+    // The Farkas ray does not depend on the bounds of the columns it does not combine
+    std::unordered_map<Variable, mpq_class> combination;
+    for (const Column& column : original) combination.emplace(column.var, 0);
+    for (RowIndex i = 0; i < static_cast<RowIndex>(dual_solution_.size()); ++i) {
+      if (dual_solution_[i] == 0) continue;
+      for (const auto& [var, coeff] : row(i).addends) {
+        if (const auto it = combination.find(var); it != combination.end()) it->second += coeff * dual_solution_[i];
+      }
+    }
+    return std::ranges::all_of(combination, [](const auto& entry) { return entry.second == 0; });
+  }
+  if (result != LpResult::OPTIMAL && result != LpResult::DELTA_OPTIMAL) return true;
+  if (basis_.columns.empty()) return false;
+  // Basic columns lie within the bounds set by the user, and non-basic ones must sit on one of them
+  for (std::size_t k = 0; k < propagated_.size(); ++k) {
+    const Column& tightened = propagated_[k];
+    const bool fixed = tightened.lb == tightened.ub;
+    switch (basis_.columns[var_to_col_.at(tightened.var)]) {
+      case BasisStatus::BASIC:
+        break;
+      case BasisStatus::AT_LOWER:
+        if (fixed || tightened.lb != original[k].lb) return false;
+        break;
+      case BasisStatus::AT_UPPER:
+        if (fixed || tightened.ub != original[k].ub) return false;
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+LpResult LpSolver::SolvePropagated(mpq_class& precision, const bool store_solution) {
+  const std::vector<Column> original{Propagate()};
+  WarmStart();
+  const mpq_class requested_precision{precision};
+  const LpResult result = SolvePortfolio(precision, store_solution);
+  // The underlying solver always holds the bounds set by the user outside of a solve
+  for (const Column& column : original) {
+    SetBoundCore(column.var, column.lb.value_or(ninfinity_), column.ub.value_or(infinity_));
+  }
+  if (original.empty() || !store_solution || HoldsWithoutPropagation(result, original)) return result;
+
+  // The reduced cost of an active implied bound belongs to the rows that implied it.
+  // Starting from the final basis, the underlying solver usually moves it back in a few pivots
+  DELPI_DEBUG_FMT("LpSolver::SolvePropagated: the {} result relies on the propagated bounds, solving again", result);
+  {
+    const ProfilerGuard profiler_guard{profiler_, "propagate"};
+    profiler_.Count("resolves");
+  }
+  precision = requested_precision;
+  solution_.clear();
+  dual_solution_.clear();
+  basis_ = {};
+  return SolvePortfolio(precision, store_solution);
+}
+
+LpResult LpSolver::SolveCached(mpq_class& precision, const bool store_solution) {
+  const ResultCache cache{config_};
+  const std::optional<ResultCache::CanonicalModel> model{
+      ResultCache::Canonicalise(columns(), rows(), config_, precision)};
+  if (!model) return SolvePropagated(precision, store_solution);
+
+  if (std::optional<ResultCache::Entry> entry = cache.Load(*model)) {
+    DELPI_DEBUG_FMT("LpSolver::SolveCached: cache hit for {}", model->key);
+    profiler_.Count("cache_hits");
+    precision = std::move(entry->precision);
+    obj_lb_ = std::move(entry->obj_lb);
+    obj_ub_ = std::move(entry->obj_ub);
+    if (store_solution) {
+      solution_ = std::move(entry->solution);
+      dual_solution_ = std::move(entry->dual_solution);
+      basis_ = std::move(entry->basis);
+    }
+    return entry->result;
+  }
+
+  const LpResult result = SolvePropagated(precision, store_solution);
+  // Without the solution, the entry would be useless for the following solves that need it
+  if (store_solution && result != LpResult::ERROR) {
+    cache.Store(*model, {result, precision, obj_lb_, obj_ub_, solution_, dual_solution_, basis_});
+  }
+  return result;
+}
+LpResult LpSolver::SolvePortfolio(mpq_class& precision, const bool store_solution) {
+  if (config_.restarts() <= 1) return SolveCore(precision, store_solution);
+  const ProfilerGuard profiler_guard{profiler_, "portfolio"};
+  const std::size_t num_copies = config_.restarts() - 1;
+  // The racers share the symbolic layer and, with QSopt_ex, its global state, so they may have to run one at a time
+  const std::size_t num_jobs = NumParallelJobs(config_, num_copies + 1);
+  DELPI_DEBUG_FMT("LpSolver::SolvePortfolio({}, {}): racing {} copies in {} jobs", precision, store_solution,
+                  num_copies, num_jobs);
+
+  const std::vector<Column> problem_columns{columns()};
+  const std::vector<Row> problem_rows{rows()};
+  const Basis basis{CurrentBasis()};
+  std::vector<PortfolioCopy> copies(num_copies);
+  const auto make_copy = [&](const std::size_t k) {
+    Config config{config_};
+    config.m_random_seed() = config_.random_seed() + static_cast<unsigned int>(k) + 1;
+    config.m_restarts() = 1;
+    config.m_with_timings() = false;
+    PortfolioCopy& copy = copies[k];
+    std::mt19937 generator{config.random_seed()};
+    copy.columns.resize(problem_columns.size());
+    std::iota(copy.columns.begin(), copy.columns.end(), 0);
+    std::ranges::shuffle(copy.columns, generator);
+    copy.rows.resize(problem_rows.size());
+    std::iota(copy.rows.begin(), copy.rows.end(), 0);
+    std::ranges::shuffle(copy.rows, generator);
+
+    copy.solver = GetInstance(config);
+    copy.solver->ReserveColumns(num_columns());
+    copy.solver->ReserveRows(num_rows());
+    for (const ColumnIndex column_idx : copy.columns) copy.solver->AddColumn(problem_columns[column_idx]);
+    for (const RowIndex row_idx : copy.rows) copy.solver->AddRow(problem_rows[row_idx]);
+    DELPI_ASSERT(copy.solver->num_rows() == num_rows(), "The copy must have the same rows");
+    if (basis.columns.empty()) return;
+    Basis shuffled;
+    for (const ColumnIndex column_idx : copy.columns) shuffled.columns.push_back(basis.columns[column_idx]);
+    for (const RowIndex row_idx : copy.rows) shuffled.rows.push_back(basis.rows[row_idx]);
+    copy.solver->LoadBasis(shuffled);
+  };
+
+  // Racer 0 is this LP solver, racer k + 1 is the k-th copy
+  std::vector<LpResult> results(num_copies + 1, LpResult::UNSOLVED);
+  std::vector<mpq_class> precisions(num_copies + 1, precision);
+  std::optional<std::size_t> winner;
+  std::mutex mutex;
+  const auto finish = [&](const std::size_t racer) {
+    const std::lock_guard<std::mutex> lock{mutex};
+    if (winner.has_value() || results[racer] == LpResult::ERROR) return;
+    winner = racer;
+    if (racer != 0) Interrupt();
+    for (std::size_t k = 0; k < num_copies; ++k) {
+      if (k + 1 != racer && copies[k].solver != nullptr) copies[k].solver->Interrupt();
+    }
+  };
+  const auto race = [&](const std::size_t racer) {
+    {
+      // A racer that has not started yet when another one finishes is not needed anymore
+      const std::lock_guard<std::mutex> lock{mutex};
+      if (winner.has_value()) return;
+    }
+    LpSolver& solver = racer == 0 ? *this : *copies[racer - 1].solver;
+    results[racer] = solver.SolveCore(precisions[racer], store_solution);
+    finish(racer);
+  };
+  // An interrupt left over from a previous race must not stop this one
+  ResetInterrupt();
+  if (num_jobs > 1) {
+    // All the copies are built before the race starts, so that they can be interrupted at any time
+    for (std::size_t k = 0; k < num_copies; ++k) make_copy(k);
+    ThreadPool pool{static_cast<unsigned int>(num_jobs - 1)};
+    std::vector<std::future<void>> futures;
+    futures.reserve(num_copies);
+    for (std::size_t k = 0; k < num_copies; ++k) futures.emplace_back(pool.Submit([&, k]() { race(k + 1); }));
+    race(0);
+    for (std::future<void>& future : futures) future.get();
+  } else {
+    // One after the other, a copy only runs if all the previous racers have failed
+    race(0);
+    for (std::size_t k = 0; k < num_copies && !winner.has_value(); ++k) {
+      make_copy(k);
+      race(k + 1);
+    }
+  }
+  ResetInterrupt();
+  DELPI_DEBUG_FMT("LpSolver::SolvePortfolio: racer {} won with {}", winner.value_or(0), results[winner.value_or(0)]);
+  if (!winner.has_value() || *winner == 0) {
+    precision = precisions[0];
+    return results[0];
+  }
+
+  // Map the result of the winning copy back to the LP problem
+  profiler_.Count("copy_wins");
+  const PortfolioCopy& copy = copies[*winner - 1];
+  const LpSolver& solver = *copy.solver;
+  const auto unshuffle = [&copy](const Basis& shuffled) {
+    Basis unshuffled{std::vector<BasisStatus>(shuffled.columns.size()), std::vector<BasisStatus>(shuffled.rows.size())};
+    for (std::size_t j = 0; j < shuffled.columns.size(); ++j) unshuffled.columns[copy.columns[j]] = shuffled.columns[j];
+    for (std::size_t i = 0; i < shuffled.rows.size(); ++i) unshuffled.rows[copy.rows[i]] = shuffled.rows[i];
+    return unshuffled;
+  };
+  precision = precisions[*winner];
+  obj_lb_ = solver.obj_lb_;
+  obj_ub_ = solver.obj_ub_;
+  solution_.clear();
+  dual_solution_.clear();
+  basis_ = {};
+  if (store_solution) {
+    solution_.resize(solver.solution_.size());
+    for (std::size_t j = 0; j < solver.solution_.size(); ++j) solution_[copy.columns[j]] = solver.solution_[j];
+    dual_solution_.resize(solver.dual_solution_.size());
+    for (std::size_t i = 0; i < solver.dual_solution_.size(); ++i) {
+      dual_solution_[copy.rows[i]] = solver.dual_solution_[i];
+    }
+    if (!solver.basis_.columns.empty()) basis_ = unshuffle(solver.basis_);
+  }
+  const Basis winner_basis{solver.CurrentBasis()};
+  if (!winner_basis.columns.empty()) LoadBasis(unshuffle(winner_basis));
+  return results[*winner];
+}
+bool LpSolver::CertifyBasis(const Basis& basis, const bool store_solution) {
+  const ProfilerGuard profiler_guard{profiler_, "certify"};
+  const std::vector<Column> problem_columns{columns()};
+  const std::vector<Row> problem_rows{rows()};
+  const BasisCertifier certifier{problem_columns, problem_rows, var_to_col_, config_.number_of_jobs()};
+  std::optional<BasisCertifier::Certificate> certificate{certifier.Certify(basis)};
+  if (!certificate.has_value()) {
+    DELPI_DEBUG("LpSolver::CertifyBasis: the basis is not optimal");
+    profiler_.Count("failures");
+    return false;
+  }
+  obj_lb_ = obj_ub_ = certificate->objective;
+  if (store_solution) {
+    solution_ = std::move(certificate->solution);
+    dual_solution_ = std::move(certificate->dual_solution);
+    basis_ = basis;
+  }
+  return true;
+}
+
+std::optional<mpq_class> LpSolver::SafeObjectiveLowerBound(const std::span<const double> dual) const {
+  const std::vector<Column> problem_columns{columns()};
+  const std::vector<Row> problem_rows{rows()};
+  return SafeDualBound{problem_columns, problem_rows, var_to_col_}.LowerBound(dual);
+}
+bool LpSolver::AcceptApproximateSolution(const std::span<const double> solution, const std::span<const double> dual,
+                                         mpq_class& precision, const bool store_solution) {
+  DELPI_ASSERT(static_cast<int>(solution.size()) == num_columns(), "The solution must have a value for each column");
+  const ProfilerGuard profiler_guard{profiler_, "safe_bound"};
+  const std::vector<Column> problem_columns{columns()};
+  const std::vector<Row> problem_rows{rows()};
+  const SafeDualBound safe_dual_bound{problem_columns, problem_rows, var_to_col_};
+  const std::optional<mpq_class> lower_bound{safe_dual_bound.LowerBound(dual)};
+  if (!lower_bound.has_value()) {
+    DELPI_DEBUG("LpSolver::AcceptApproximateSolution: no finite bound from the dual solution");
+    profiler_.Count("failures");
+    return false;
+  }
+
+  // Maximum violation of the bounds and rows, and objective value, computed exactly
+  std::vector<mpq_class> x;
+  x.reserve(solution.size());
+  mpq_class violation{0}, objective{0};
+  for (std::size_t j = 0; j < solution.size(); ++j) {
+    if (!std::isfinite(solution[j])) return false;
+    const mpq_class& value = x.emplace_back(solution[j]);
+    const auto& [var, lb, ub, obj] = problem_columns[j];
+    if (lb.has_value()) violation = std::max(violation, mpq_class{*lb - value});
+    if (ub.has_value()) violation = std::max(violation, mpq_class{value - *ub});
+    if (obj.has_value()) objective += *obj * value;
+  }
+  // The values converted from floating point share a power of two as common denominator
+  const IntegerRow point{x};
+  for (const Row& row : problem_rows) {
+    const mpq_class activity{IntegerRow{row, var_to_col_}.Dot(point)};
+    if (row.lb.has_value()) violation = std::max(violation, mpq_class{*row.lb - activity});
+    if (row.ub.has_value()) violation = std::max(violation, mpq_class{activity - *row.ub});
+  }
+  const mpq_class gap{abs(objective - *lower_bound)};
+  DELPI_DEBUG_FMT("LpSolver::AcceptApproximateSolution: violation = {}, objective = {}, lower bound = {}",
+                  violation.get_d(), objective.get_d(), lower_bound->get_d());
+  if (violation > precision || gap > precision) {
+    profiler_.Count("failures");
+    return false;
+  }
+
+  precision = std::max(violation, gap);
+  obj_lb_ = std::min(objective, *lower_bound);
+  obj_ub_ = std::max(objective, *lower_bound);
+  if (store_solution) {
+    solution_ = std::move(x);
+    dual_solution_.assign(dual.begin(), dual.end());
+  }
+  return true;
+}
+
 void LpSolver::SetObjective(const Variable& var, const mpq_class& value) { SetObjective(var_to_col_.at(var), value); }
+void LpSolver::SetObjective(const int column_idx, const mpq_class& value) {
+  // Columns added inside the innermost scope are removed when it is closed, so there is nothing to restore
+  if (!scopes_.empty() && column_idx < scopes_.back().num_columns) {
+    objective_trail_.push_back({column_idx, column(column_idx).obj.value_or(0)});
+  }
+  SetObjectiveCore(column_idx, value);
+  changes_.objective = true;
+}
+void LpSolver::SetBound(const Variable var, const mpq_class& lb, const mpq_class& ub) {
+  if (!scopes_.empty()) {
+    const ColumnIndex column_idx = var_to_col_.at(var);
+    if (column_idx < scopes_.back().num_columns) {
+      const Column previous{column(column_idx)};
+      bound_trail_.push_back({column_idx, previous.lb.value_or(ninfinity_), previous.ub.value_or(infinity_)});
+    }
+  }
+  SetBoundCore(var, lb, ub);
+  changes_.bounds = true;
+}
+void LpSolver::SetRowBound(const RowIndex row_idx, const mpq_class& lb, const mpq_class& ub) {
+  DELPI_ASSERT(row_idx >= 0 && row_idx < num_rows(), "Row index out of bounds");
+  // Rows added inside the innermost scope are removed when it is closed, so there is nothing to restore
+  if (!scopes_.empty() && row_idx < scopes_.back().num_rows) {
+    const Row previous{row(row_idx)};
+    row_bound_trail_.push_back({row_idx, previous.lb.value_or(ninfinity_), previous.ub.value_or(infinity_)});
+  }
+  SetRowBoundCore(row_idx, lb, ub);
+  changes_.bounds = true;
+}
 
 void LpSolver::Maximise(const Expression& objective_function) { Maximise(objective_function.addends()); }
 template <TypedIterable<std::pair<const Variable, mpq_class>> T>
@@ -224,10 +1398,24 @@ bool LpSolver::CheckAgainstExpected(const LpResult result) const {
 }
 
 bool LpSolver::Verify() const {
-  const std::unordered_map m{model()};
-  for (const Formula& constraint : constraints()) {
-    if (!constraint.Evaluate(m)) {
-      DELPI_ERROR_FMT("Constraint {} violated by the model", constraint);
+  if (solution_.empty()) return num_columns() == 0;
+  DELPI_ASSERT(static_cast<int>(solution_.size()) == num_columns(), "All variables must appear in the solution");
+  for (ColumnIndex j = 0; j < num_columns(); ++j) {
+    const auto [var, lb, ub, obj] = column(j);
+    if ((lb.has_value() && solution_[j] < *lb) || (ub.has_value() && solution_[j] > *ub)) {
+      DELPI_ERROR_FMT("Bound {} <= {} <= {} violated by the model, with {} = {}", lb.value_or(ninfinity_), var,
+                      ub.value_or(infinity_), var, solution_[j]);
+      return false;
+    }
+  }
+  // Each row is evaluated with integer arithmetic over the common denominator of the solution
+  const IntegerRow point{solution_};
+  for (RowIndex i = 0; i < num_rows(); ++i) {
+    const Row row_i{row(i)};
+    if (!row_i.lb.has_value() && !row_i.ub.has_value()) continue;
+    const mpq_class activity{IntegerRow{row_i, var_to_col_}.Dot(point)};
+    if ((row_i.lb.has_value() && activity < *row_i.lb) || (row_i.ub.has_value() && activity > *row_i.ub)) {
+      DELPI_ERROR_FMT("Row {} violated by the model, with activity {}", row_i, activity);
       return false;
     }
   }
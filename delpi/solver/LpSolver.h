@@ -8,20 +8,29 @@
 
 #include <iosfwd>
 #include <memory>
+#include <optional>
+#include <span>  // NOLINT(build/include_order): c++20 header
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "delpi/libs/gmp.h"
+#include "delpi/solver/Basis.h"
 #include "delpi/solver/Column.h"
+#include "delpi/solver/Decomposition.h"
+#include "delpi/solver/Dualization.h"
 #include "delpi/solver/LpResult.h"
 #include "delpi/solver/LpRowSense.h"
+#include "delpi/solver/ModelFeatures.h"
 #include "delpi/solver/Row.h"
+#include "delpi/solver/Scenario.h"
+#include "delpi/solver/SensitivityAnalysis.h"
 #include "delpi/symbolic/Expression.h"
 #include "delpi/symbolic/Formula.h"
 #include "delpi/symbolic/Variable.h"
 #include "delpi/util/Config.h"
+#include "delpi/util/Profiler.h"
 #include "delpi/util/Stats.h"
 #include "delpi/util/concepts.h"
 
@@ -146,12 +155,18 @@ class LpSolver {
   [[nodiscard]] const mpq_class& infinity() const { return infinity_; }
   /** @getter{statistics, lp solver} */
   [[nodiscard]] const IterationStats& stats() const { return stats_; }
+  /** @getter{profiler recording the phases of the parsing and solving process, lp solver} */
+  [[nodiscard]] const Profiler& profiler() const { return profiler_; }
+  /** @getsetter{profiler recording the phases of the parsing and solving process, lp solver} */
+  [[nodiscard]] Profiler& m_profiler() { return profiler_; }
   /** @getter{configuration, lp solver} */
   [[nodiscard]] const Config& config() const { return config_; }
   /** @getter{primal solution\, if the lp is feasible\,, lp solver} */
   [[nodiscard]] const std::vector<mpq_class>& solution() const { return solution_; }
   /** @getter{dual solution\, if the lp is feasible\,, lp solver} */
   [[nodiscard]] const std::vector<mpq_class>& dual_solution() const { return dual_solution_; }
+  /** @getter{final basis\, if the lp is feasible and the underlying solver provides one\,, lp solver} */
+  [[nodiscard]] const Basis& basis() const { return basis_; }
   /** @getter{maps from and to SMT variables to LP columns/rows, lp solver} */
   [[nodiscard]] const std::unordered_map<Variable, int>& var_to_col() const { return var_to_col_; }
   /** @getter{vector of all the variables, lp solver} */
@@ -162,6 +177,8 @@ class LpSolver {
   [[nodiscard]] LpResult expected() const;
   /** @getter{mapping between each variable and its value, lp solution} */
   [[nodiscard]] std::unordered_map<Variable, mpq_class> model() const;
+  /** @getter{scenarios collected from the file, lp problem} */
+  [[nodiscard]] const std::vector<Scenario>& scenarios() const { return scenarios_; }
   /** @getter{callback function invoked upon solving the problem, lp solver} */
   [[nodiscard]] const SolveCallback& solve_cb() const { return solve_cb_; }
   /** @getsetter{callback function invoked upon solving the problem, lp solver} */
@@ -201,6 +218,43 @@ class LpSolver {
    * @return row structure
    */
   [[nodiscard]] virtual Row row(int row_idx) const = 0;
+  /**
+   * Get all the columns of the LP problem, in order.
+   * @return vector of column structures
+   */
+  [[nodiscard]] std::vector<Column> columns() const;
+  /**
+   * Get all the rows of the LP problem, in order.
+   * @return vector of row structures
+   */
+  [[nodiscard]] std::vector<Row> rows() const;
+  /**
+   * Compute the features of the LP problem, in a single pass over its columns and rows.
+   * @return features of the LP problem
+   * @see ModelFeatures
+   */
+  [[nodiscard]] ModelFeatures Features() const;
+  /**
+   * Load the `basis` into the underlying solver, so that the next @ref Solve starts from it.
+   *
+   * The basis can come from anywhere, e.g., a similar problem solved earlier or an approximate solution.
+   * It only affects how fast the solve is: the result is as exact as with the default starting basis,
+   * and a singular basis is repaired by the underlying solver.
+   * @param basis basis with a status for each column and row, exactly @ref num_rows of which are BASIC
+   * @throw DelpiException if the basis does not match the size of the problem or has the wrong number of basic ones
+   */
+  void SetBasis(const Basis& basis);
+  /**
+   * Compute a rigorous lower bound on the optimal objective value from an approximate `dual` solution,
+   * e.g., one produced by a floating point simplex.
+   *
+   * The bound is valid for the objective as minimised internally, like @ref obj_lb_.
+   * @param dual approximate dual value of each row
+   * @return lower bound on the optimal objective value
+   * @return std::nullopt if no finite bound can be derived from `dual`
+   * @see SafeDualBound
+   */
+  [[nodiscard]] std::optional<mpq_class> SafeObjectiveLowerBound(std::span<const double> dual) const;
   /**
    * Reserve space for the given number of columns and rows.
    *
@@ -228,6 +282,11 @@ class LpSolver {
    * @param value value to set the information to set
    */
   void SetInfo(const std::string& key, const std::string& value);
+  /**
+   * Add a `scenario` to the ones stored in the LP solver, usually collected from the file.
+   * @param scenario scenario to add
+   */
+  void AddScenario(Scenario scenario);
   /**
    * Set the option identified by the given `key` to the given `value`.
    *
@@ -355,6 +414,28 @@ class LpSolver {
    */
   virtual RowIndex AddRow(const Expression::Addends& lhs, FormulaKind sense, const mpq_class& rhs) = 0;
 
+  /**
+   * Remove the given `rows` from the LP problem.
+   *
+   * The rows that follow the removed ones are shifted down, preserving their relative order.
+   * The underlying solver keeps its basis if all the removed rows have a basic slack,
+   * so that the next @ref Solve can start from it.
+   * The current @ref solution_ and @ref dual_solution_ are discarded.
+   * @param rows indices of the rows to remove. Duplicates are ignored
+   */
+  void RemoveRows(std::span<const RowIndex> rows);
+  /**
+   * Remove the given `columns` from the LP problem, together with their coefficients in all the rows.
+   *
+   * The columns that follow the removed ones are shifted down, preserving their relative order,
+   * and @ref var_to_col_ and @ref col_to_var_ are updated accordingly.
+   * The underlying solver keeps its basis if none of the removed columns is basic,
+   * so that the next @ref Solve can start from it.
+   * The current @ref solution_ and @ref dual_solution_ are discarded.
+   * @param columns indices of the columns to remove. Duplicates are ignored
+   */
+  void RemoveColumns(std::span<const ColumnIndex> columns);
+
   /**
    * Set the coefficient of the `row` constraint to apply at the `column` decisional variable.
    * @param row row of the constraint
@@ -381,18 +462,54 @@ class LpSolver {
   void SetObjective(const Variable& var, const mpq_class& value);
   /**
    * The the objective coefficient of the given `column` to the given `value`.
+   *
+   * Inside a scope, the previous coefficient is recorded so that @ref Pop can restore it.
    * @param column column to set the objective for
    * @param value new objective coefficient for the column
    */
-  virtual void SetObjective(int column, const mpq_class& value) = 0;
+  void SetObjective(int column, const mpq_class& value);
 
   /**
    * Set the bounds of a `var` in the LP problem to the given `lb` and `ub`.
+   *
+   * Inside a scope, the previous bounds are recorded so that @ref Pop can restore them.
    * @param var variable to be bounded
    * @param lb lower bound
    * @param ub upper bound
    */
-  virtual void SetBound(Variable var, const mpq_class& lb, const mpq_class& ub) = 0;
+  void SetBound(Variable var, const mpq_class& lb, const mpq_class& ub);
+  /**
+   * Set the bounds of the `row` in the LP problem to the given `lb` and `ub`.
+   *
+   * Inside a scope, the previous bounds are recorded so that @ref Pop can restore them.
+   * @param row row to be bounded
+   * @param lb lower bound. Equal to @ref ninfinity_ if unbounded
+   * @param ub upper bound. Equal to @ref infinity_ if unbounded
+   */
+  void SetRowBound(RowIndex row, const mpq_class& lb, const mpq_class& ub);
+
+  /**
+   * Open a new scope.
+   *
+   * All the columns and rows added from now on, as well as the changes to the bounds of the existing rows and to the
+   * bounds and objective coefficients of the existing columns, are undone by the matching @ref Pop.
+   * Changes to the coefficients of existing rows are not tracked.
+   * Rows and columns cannot be removed with @ref RemoveRows and @ref RemoveColumns while a scope is open.
+   */
+  void Push();
+  /**
+   * Close the last `n` scopes, undoing all the changes made since the corresponding @ref Push.
+   *
+   * The work is proportional to the number of changes undone, and the model is never rebuilt.
+   * The underlying solver is left with a basis valid for the restored problem, so that the next @ref Solve is
+   * hot-started: the current basis if it survives the removal of the rows and columns, otherwise the basis the
+   * underlying solver had when the scope was opened.
+   * The current @ref solution_ and @ref dual_solution_ are discarded.
+   * @param n number of scopes to close
+   */
+  void Pop(int n = 1);
+  /** @getter{number of open scopes, lp solver} */
+  [[nodiscard]] int num_scopes() const { return static_cast<int>(scopes_.size()); }
 
   /**
    * Optimise the LP problem with the given `precision`.
@@ -400,6 +517,9 @@ class LpSolver {
    * The result of the computation will be stored in @ref solution_ and @ref dual_solution_ if the problem is feasible.
    * If `store_solution` is false, the solution will not be stored, but the LpResult will still be returned.
    * The actual precision will be returned in the `precision` parameter.
+   * If @ref Config::cache_dir is set, a previous result for an equivalent problem is returned without solving it.
+   * Depending on @ref Config::dualize, the dual of the problem may be solved instead,
+   * with the results mapped back to the problem itself.
    * @param[in,out] precision desired precision for the optimisation that becomes the actual precision achieved
    * @param store_solution whether the solution and dual solution should be stored
    * @return OPTIMAL if an optimal solution has been found and the return value of `precision` is @f$ = 0 @f$
@@ -409,6 +529,129 @@ class LpSolver {
    * @return ERROR if an error occurred
    */
   LpResult Solve(mpq_class& precision, bool store_solution = true);
+  /**
+   * Optimise the LP problem with the given `precision`, after splitting it into independent blocks.
+   *
+   * The blocks are the connected components of the row-column graph, found with a @ref Decomposition.
+   * Each block with both rows and columns is loaded into an LP solver of its own,
+   * and the blocks are optimised in parallel on up to @ref Config::number_of_jobs threads.
+   * A column that appears in no row is set to the bound its objective coefficient points to,
+   * while a row whose coefficients are all zero only needs its bounds to contain zero.
+   * The solutions, dual solutions, bases and objective bounds of the blocks are then merged exactly.
+   * If the problem is made of a single block, it is optimised with @ref Solve instead.
+   * If a block is infeasible and `store_solution` is true, @ref dual_solution_ has an entry for each row,
+   * but all of them are zero: no Farkas certificate is produced for the whole problem.
+   * The @ref solve_cb_ is invoked once, for the whole problem.
+   * @param[in,out] precision desired precision for each block that becomes the worst actual precision achieved
+   * @param store_solution whether the solution and dual solution should be stored
+   * @return OPTIMAL if all the blocks are optimal and the return value of `precision` is @f$ = 0 @f$
+   * @return DELTA_OPTIMAL if all the blocks are optimal and the return value of `precision` @f$\ge 0 @f$
+   * @return INFEASIBLE if at least one block is infeasible
+   * @return ERROR if no block is infeasible, but an error occurred in at least one of them
+   * @return UNBOUNDED if at least one block is unbounded and all the others are optimal
+   */
+  LpResult SolveDecomposed(mpq_class& precision, bool store_solution = true);
+  /**
+   * Optimise each of the `scenarios` with the given `precision`, loading the constraint matrix only once.
+   *
+   * The scenarios are split into contiguous chains, one for each of the @ref Config::number_of_jobs.
+   * The first chain is solved by this LP solver, the others by a @ref Clone each, in parallel.
+   * Inside a chain, each scenario is applied in its own scope and solved starting from the basis
+   * left by the previous one, which usually takes only a few pivots if the scenarios are similar.
+   * The @ref solve_cb_ is not invoked, and the LP problem is left unchanged at the end.
+   * @param scenarios scenarios to solve
+   * @param precision desired precision for the optimisation
+   * @param store_solution whether the solution of each scenario should be stored in its result
+   * @return result of each scenario, in the same order as `scenarios`
+   */
+  std::vector<ScenarioResult> SolveScenarios(std::span<const Scenario> scenarios, const mpq_class& precision,
+                                             bool store_solution = false);
+  /**
+   * Compute the ranges over which the objective coefficient of each column and the right-hand side of each row
+   * can move while the final @ref basis_ of the last solve stays optimal.
+   *
+   * The ranges are computed exactly from a factorisation of the basis.
+   * They refer to the objective as minimised internally.
+   * @pre The last solve stored an optimal basis
+   * @return sensitivity ranges of the columns and rows
+   * @throw DelpiException if there is no basis, or it is not optimal
+   * @see SensitivityAnalysis
+   */
+  [[nodiscard]] SensitivityReport Sensitivity() const;
+  /**
+   * Solve the LP problem with the parametric objective @f$ c + t d @f$ for each @f$ t \in [t_lb, t_ub] @f$,
+   * where @f$ c @f$ is the current objective and @f$ d @f$ is the `direction`.
+   *
+   * The problem is solved exactly once, for @f$ t = t_lb @f$.
+   * Then, starting from its final basis, the breakpoints where the basis stops being optimal are found
+   * with a ratio test, and the next optimal basis is reached with a few exact simplex pivots,
+   * without solving the problem from scratch again.
+   * The sweep stops at @f$ t_ub @f$, or as soon as the problem becomes unbounded.
+   * If the problem is not optimal for @f$ t = t_lb @f$, a single segment with the result is returned.
+   * The objective is restored at the end, while @ref solution_ and @ref basis_ refer to @f$ t = t_lb @f$.
+   * @param direction direction of the objective, with a value for each column
+   * @param t_lb initial value of the parameter
+   * @param t_ub final value of the parameter
+   * @return consecutive intervals of the parameter, each with its own optimal solution
+   * @throw DelpiInvalidArgumentException if `t_lb` is greater than `t_ub`
+   * @throw DelpiException if the underlying solver does not provide an optimal basis
+   * @see SensitivityAnalysis
+   */
+  std::vector<ParametricSegment> SolveParametric(std::span<const mpq_class> direction, const mpq_class& t_lb,
+                                                 const mpq_class& t_ub);
+  /**
+   * Minimise the `objectives` in lexicographic order.
+   *
+   * Each objective is minimised over the set of solutions that are optimal for all the previous ones.
+   * Instead of adding a row to fix the optimal value of each objective, the problem is restricted to its optimal face
+   * by complementary slackness: every column with a non-zero reduced cost is fixed to its value,
+   * and every row with a non-zero dual becomes an equality.
+   * The restrictions only change bounds, so each stage is hot-started from the basis of the previous one.
+   * With a positive `precision`, the duals are approximate, and so is the optimal face.
+   * The constant term of the objectives is ignored.
+   * The original objective and bounds are restored at the end, while the solution of the last stage is kept.
+   * The final basis is not stored, since it refers to the restricted problem.
+   * The @ref solve_cb_ is invoked only once, at the end.
+   * @param objectives objectives to minimise, from the most to the least important
+   * @param[in,out] precision desired precision for each stage that becomes the worst actual precision achieved
+   * @param store_solution whether the solution and dual solution of the last stage should be stored
+   * @return OPTIMAL if all the stages have been solved optimally
+   * @return DELTA_OPTIMAL if all the stages have been solved, at least one of them with a positive precision
+   * @return the result of the first stage that could not be solved otherwise
+   */
+  LpResult SolveLexicographic(std::span<const Expression> objectives, mpq_class& precision,
+                              bool store_solution = true);
+
+  /**
+   * Create a new LP solver with the same configuration, columns, rows and information as this one.
+   *
+   * The basis of the underlying solver is copied as well, so that the clone can be hot-started.
+   * The scopes, the scenarios and the solution are not copied.
+   * @return copy of the LP problem
+   */
+  [[nodiscard]] std::unique_ptr<LpSolver> Clone() const;
+  /**
+   * Create a new LP solver with the given `config` and the same columns, rows and information as this one.
+   *
+   * The basis of the underlying solver is copied as well, so that the clone can be hot-started.
+   * The scopes, the scenarios and the solution are not copied.
+   * @param config configuration of the clone
+   * @return copy of the LP problem
+   */
+  [[nodiscard]] std::unique_ptr<LpSolver> Clone(const Config& config) const;
+  /**
+   * Pick the LP solver and the LP mode best suited for the LP problem, if the configured LP solver is AUTO.
+   *
+   * The @ref Features of the problem are matched against the rules in the `lp_solver_rules` file, if any,
+   * or against the default ones of the @ref BackendSelector.
+   * An LP mode other than AUTO in the configuration is always kept.
+   * The problem is then moved to a new LP solver with the chosen configuration,
+   * alongside its scenarios and callbacks.
+   * @return new LP solver with the chosen LP solver and LP mode
+   * @return nullptr if the configured LP solver is not AUTO
+   * @throw DelpiException if the file with the rules cannot be read or is malformed
+   */
+  [[nodiscard]] std::unique_ptr<LpSolver> SelectBackend() const;
 
   /**
    * Set the `objective_function` to maximise while being subject to all the constraints.
@@ -474,6 +717,198 @@ class LpSolver {
    * @return ERROR if an error occurred
    */
   virtual LpResult SolveCore(mpq_class& precision, bool store_solution) = 0;
+  /**
+   * Look up the result of the LP problem in the cache at @ref Config::cache_dir.
+   * On a miss, the problem is solved with @ref SolveCore and the result is added to the cache.
+   * @param precision desired precision for the optimisation
+   * @param store_solution whether the solution and dual solution should be stored
+   * @return result of the LP problem
+   */
+  LpResult SolveCached(mpq_class& precision, bool store_solution);
+  /**
+   * Optimise the LP problem with @ref SolveCore, racing against differently seeded copies if @ref Config::restarts
+   * is greater than 1.
+   *
+   * Each copy gets its own @ref Config::random_seed, and its columns and rows are shuffled with it,
+   * so the pivoting rules break ties in a different way.
+   * All the copies start from the current basis, if any, and run in parallel alongside this LP solver,
+   * at most @ref Config::number_of_jobs at a time.
+   * If the copies cannot run in parallel, e.g. with QSopt_ex, they run one after the other,
+   * and each one only starts if all the previous ones have failed.
+   * The result of the first one to finish without errors is kept and mapped back to the LP problem,
+   * while the others are interrupted, if the underlying solver supports it, or left to finish.
+   * The basis of the winner is then loaded, so that later solves start from it.
+   * @param precision desired precision for the optimisation
+   * @param store_solution whether the solution and dual solution should be stored
+   * @return result of the first copy to finish without errors
+   * @return ERROR if all the copies failed
+   */
+  LpResult SolvePortfolio(mpq_class& precision, bool store_solution);
+  /**
+   * Build the dual of the LP problem with a @ref Dualization, solve it with the LP solver in @ref dual_solver_
+   * and map its solution, dual solution, basis and objective bounds back to the LP problem.
+   *
+   * The dual LP solver is kept across solves.
+   * If only the bounds or the objective of the LP problem have changed since the previous dualized solve,
+   * it is updated in place, so that it starts from its last basis, otherwise it is built again.
+   * The @ref partial_solve_cb_ receives the partial solutions mapped back to the LP problem,
+   * and the phases of the dual LP solver are reported inside the `dualize` one.
+   * @param precision desired precision for the optimisation
+   * @param store_solution whether the solution and dual solution should be stored
+   * @return result of the LP problem.
+   * If it is INFEASIBLE and `store_solution` is true, @ref dual_solution_ has an entry for each row,
+   * but all of them are zero: no Farkas certificate is produced
+   * @return UNSOLVED if the dual problem is infeasible, so the LP problem must be solved directly to tell
+   * whether it is infeasible or unbounded
+   */
+  LpResult SolveDualized(mpq_class& precision, bool store_solution);
+  /**
+   * Scale the LP problem by powers of two with a @ref Scaling, solve it with a new LP solver
+   * and map its solution, dual solution, basis and objective bounds back to the LP problem.
+   *
+   * The new LP solver starts from the current basis, if any, and its final basis is loaded back,
+   * since scaling does not change the status of the rows and columns.
+   * @param precision desired precision for the optimisation
+   * @param store_solution whether the solution and dual solution should be stored
+   * @return result of the LP problem
+   * @return UNSOLVED if the problem is already well scaled, so it must be solved directly
+   */
+  LpResult SolveScaled(mpq_class& precision, bool store_solution);
+  /**
+   * Compute a starting basis for the underlying solver as configured by @ref Config::warm_start.
+   *
+   * With PDHG, an approximate solution of the problem is found in double precision by @ref Pdhg
+   * and turned into a basis with @ref Pdhg::CrashBasis.
+   * With CRASH, the basis is built from the sparsity pattern of the matrix by @ref TriangularCrash.
+   * Nothing is done if the underlying solver already has a basis, e.g., from a previous solve.
+   */
+  void WarmStart();
+  /**
+   * Tighten the column bounds in the underlying solver with the ones implied by the rows,
+   * as configured by @ref Config::propagation_rounds.
+   *
+   * The bounds are computed by @ref BoundPropagation from the ones set by the user.
+   * Since the new bounds are implied by the rows, the feasible region does not change.
+   * If neither the bounds nor the structure of the problem have changed since the last solve,
+   * the bounds found back then are used again.
+   * If the propagation proves the problem infeasible, nothing is tightened,
+   * leaving the underlying solver to certify it.
+   * @return columns tightened, with the bounds set by the user, to restore after the solve
+   */
+  std::vector<Column> Propagate();
+  /**
+   * Check whether the result of a solve over the tightened bounds also holds for the bounds set by the user.
+   *
+   * An optimal basis still is one if each tightened column is basic or sits on a bound set by the user,
+   * and a Farkas ray still is a certificate if it does not combine any tightened column.
+   * @param result result of the solve over the tightened bounds
+   * @param original columns tightened by @ref Propagate, with the bounds set by the user
+   * @return true if @ref basis_ and @ref dual_solution_ are valid for the bounds set by the user
+   * @return false if the problem has to be solved again
+   */
+  [[nodiscard]] bool HoldsWithoutPropagation(LpResult result, const std::vector<Column>& original) const;
+  /**
+   * Solve the LP problem with @ref SolvePortfolio after tightening its bounds with @ref Propagate.
+   *
+   * The bounds set by the user are restored in the underlying solver right after the solve,
+   * so @ref column, @ref Sensitivity and the following solves only ever see them.
+   * The solution is feasible for them as well, but the dual solution may rely on an implied bound,
+   * whose reduced cost belongs to the rows that implied it.
+   * In that case, checked by @ref HoldsWithoutPropagation, the problem is solved again from the final basis.
+   * @param precision desired precision for the optimisation
+   * @param store_solution whether the solution and dual solution should be stored
+   * @return result of the solve
+   */
+  LpResult SolvePropagated(mpq_class& precision, bool store_solution);
+  /**
+   * Simplex algorithm the underlying solver should use in the next solve, as configured by @ref Config::simplex.
+   *
+   * With AUTO, the choice depends on the changes to the problem since the last solve.
+   * The dual simplex is picked if only bounds have changed, since the previous optimal basis is still dual feasible,
+   * while the primal simplex is picked if only the objective has changed,
+   * since the previous optimal basis is still primal feasible.
+   * @return the simplex algorithm to use
+   * @return AUTO if the underlying solver should use its own default
+   */
+  [[nodiscard]] Config::SimplexAlgorithm NextSimplexAlgorithm() const;
+  /**
+   * Internal method that removes the `rows` from the underlying solver.
+   * @param rows indices of the rows to remove, sorted in increasing order and without duplicates
+   */
+  virtual void RemoveRowsCore(std::span<const RowIndex> rows) = 0;
+  /**
+   * Internal method that removes the `columns` from the underlying solver.
+   * @param columns indices of the columns to remove, sorted in increasing order and without duplicates
+   */
+  virtual void RemoveColumnsCore(std::span<const ColumnIndex> columns) = 0;
+  /**
+   * Internal method that sets the bounds of `var` in the underlying solver.
+   * @param var variable to be bounded
+   * @param lb lower bound
+   * @param ub upper bound
+   */
+  virtual void SetBoundCore(Variable var, const mpq_class& lb, const mpq_class& ub) = 0;
+  /**
+   * Internal method that sets the objective coefficient of `column` in the underlying solver.
+   * @param column column to set the objective for
+   * @param value new objective coefficient for the column
+   */
+  virtual void SetObjectiveCore(ColumnIndex column, const mpq_class& value) = 0;
+  /**
+   * Internal method that sets the bounds of `row` in the underlying solver.
+   * @param row row to be bounded
+   * @param lb lower bound. Equal to @ref ninfinity_ if unbounded
+   * @param ub upper bound. Equal to @ref infinity_ if unbounded
+   */
+  virtual void SetRowBoundCore(RowIndex row, const mpq_class& lb, const mpq_class& ub) = 0;
+  /**
+   * Get the current basis of the underlying solver.
+   * @return current basis, or an empty one if the underlying solver does not have a basis
+   */
+  [[nodiscard]] virtual Basis CurrentBasis() const = 0;
+  /**
+   * Load the `basis` into the underlying solver, so that the next solve starts from it.
+   * @param basis basis to load. It must have a status for each column and row of the problem
+   */
+  virtual void LoadBasis(const Basis& basis) = 0;
+  /**
+   * Ask the underlying solver to stop the solve in progress as soon as possible.
+   * The interrupted solve returns ERROR. It can be called from another thread.
+   * An interrupt that arrives before the solve starts is not lost: it holds until @ref ResetInterrupt.
+   * By default, nothing happens, since not every underlying solver can be interrupted.
+   */
+  virtual void Interrupt();
+  /**
+   * Clear any previous @ref Interrupt, so that the next solve runs to completion.
+   * It must not be called while a solve is in progress.
+   */
+  virtual void ResetInterrupt();
+  /**
+   * Certify in rational arithmetic that the `basis`, usually produced by a floating point simplex, is optimal.
+   * On success, the objective bounds are set to the exact objective value and,
+   * if `store_solution` is true, @ref solution_, @ref dual_solution_ and @ref basis_ are updated.
+   * @param basis basis to certify
+   * @param store_solution whether the solution and dual solution should be stored
+   * @return true if the basis is optimal
+   * @return false if the basis is singular, not primal feasible or not dual feasible
+   */
+  bool CertifyBasis(const Basis& basis, bool store_solution);
+  /**
+   * Accept an approximate primal-dual pair, usually produced by a floating point simplex, as a solution of the problem.
+   *
+   * The pair is accepted if the primal `solution` violates no constraint by more than `precision`
+   * and its objective value differs by at most `precision` from the safe lower bound derived from the `dual`.
+   * On success, `precision` is set to the largest of the two, the objective bounds enclose both values and,
+   * if `store_solution` is true, @ref solution_ and @ref dual_solution_ are updated.
+   * @param solution approximate value of each column
+   * @param dual approximate dual value of each row
+   * @param[in,out] precision maximum violation and objective gap allowed. Set to the actual one on success
+   * @param store_solution whether the solution and dual solution should be stored
+   * @return true if the pair has been accepted
+   * @return false if the rational solve is needed
+   */
+  bool AcceptApproximateSolution(std::span<const double> solution, std::span<const double> dual,
+                                 mpq_class& precision, bool store_solution);
 
   /**
    * Check whether the row that is about to be added is a simple bound.
@@ -492,7 +927,9 @@ class LpSolver {
 
   Config config_;                                      ///< Configuration to use
   IterationStats stats_;                               ///< Statistics of the solver
+  Profiler profiler_;                                  ///< Phases and counters, recorded if timings are enabled
   std::unordered_map<std::string, std::string> info_;  ///< Generic information map. Generally collected from the file
+  std::vector<Scenario> scenarios_;                    ///< Variants of the LP problem, e.g., from the file
 
   std::unordered_map<Variable, int> var_to_col_;  ///< Theory column ⇔ Variable.
                                                   ///< The column is the one used by the lp solver.
@@ -502,6 +939,7 @@ class LpSolver {
                                                   ///< The row is the constraint used by the lp solver.
   std::vector<mpq_class> solution_;               ///< Solution vector
   std::vector<mpq_class> dual_solution_;          ///< Dual solution vector
+  Basis basis_;                                   ///< Final basis, if provided by the underlying solver
   mpq_class obj_lb_;                              ///< Lower bound on the objective value, if any
   mpq_class obj_ub_;                              ///< Upper bound on the objective value, if any
 
@@ -510,6 +948,100 @@ class LpSolver {
 
   mpq_class ninfinity_;  ///< Negative infinity threshold value
   mpq_class infinity_;   ///< Infinity threshold value
+
+ private:
+  /** Bounds of a column before they were changed inside a scope. */
+  struct BoundChange {
+    ColumnIndex column;  ///< Column whose bounds have been changed
+    mpq_class lb;        ///< Previous lower bound
+    mpq_class ub;        ///< Previous upper bound
+  };
+  /** Bounds of a row before they were changed inside a scope. */
+  struct RowBoundChange {
+    RowIndex row;  ///< Row whose bounds have been changed
+    mpq_class lb;  ///< Previous lower bound
+    mpq_class ub;  ///< Previous upper bound
+  };
+  /** Objective coefficient of a column before it was changed inside a scope. */
+  struct ObjectiveChange {
+    ColumnIndex column;  ///< Column whose objective coefficient has been changed
+    mpq_class obj;       ///< Previous objective coefficient
+  };
+  /** Changes to the LP problem since the last solve, used to pick the simplex algorithm. */
+  struct Changes {
+    bool bounds{false};     ///< Whether the bounds of a column or row have changed
+    bool objective{false};  ///< Whether the objective has changed
+    bool structure{true};   ///< Whether the rows, the columns or the basis have changed in any other way
+    int num_columns{-1};    ///< Number of columns at the last solve
+    int num_rows{-1};       ///< Number of rows at the last solve
+  };
+  /** Copy of the LP problem racing against the others in @ref SolvePortfolio. */
+  struct PortfolioCopy {
+    std::unique_ptr<LpSolver> solver;  ///< LP solver with the shuffled problem
+    std::vector<ColumnIndex> columns;  ///< Column of the LP problem for each column of the copy
+    std::vector<RowIndex> rows;        ///< Row of the LP problem for each row of the copy
+  };
+  /** State of the LP problem when a scope was opened. */
+  struct Scope {
+    int num_columns;                    ///< Number of columns
+    int num_rows;                       ///< Number of rows
+    std::size_t num_bound_changes;      ///< Size of @ref bound_trail_
+    std::size_t num_row_bound_changes;  ///< Size of @ref row_bound_trail_
+    std::size_t num_objective_changes;  ///< Size of @ref objective_trail_
+    Basis basis;                        ///< Basis of the underlying solver
+  };
+
+  /** Outcome of the optimisation of an independent block of the LP problem. */
+  struct BlockSolution {
+    LpResult result{LpResult::UNSOLVED};   ///< Result of the block
+    mpq_class precision;                   ///< Actual precision achieved
+    mpq_class obj_lb;                      ///< Lower bound on the objective value of the block
+    mpq_class obj_ub;                      ///< Upper bound on the objective value of the block
+    std::vector<mpq_class> solution;       ///< Value of each column of the block, in order
+    std::vector<mpq_class> dual_solution;  ///< Dual value of each row of the block, in order
+    Basis basis;                           ///< Final basis of the block, if provided by the underlying solver
+  };
+
+  /**
+   * Optimise the `scenarios` one after the other, each in its own scope.
+   * @param scenarios scenarios to solve
+   * @param precision desired precision for the optimisation
+   * @param store_solution whether the solution of each scenario should be stored in its result
+   * @param[out] results result of each scenario, in the same order as `scenarios`
+   */
+  void SolveScenarioChain(std::span<const Scenario> scenarios, const mpq_class& precision, bool store_solution,
+                          std::span<ScenarioResult> results);
+  /**
+   * Create a new LP solver with the same configuration for the `block` of the problem.
+   * @param block block of the problem, with both rows and columns
+   * @param problem_columns columns of the problem
+   * @param problem_rows rows of the problem
+   * @return LP solver for the block
+   */
+  [[nodiscard]] std::unique_ptr<LpSolver> BlockSolver(const Decomposition::Block& block,
+                                                      const std::vector<Column>& problem_columns,
+                                                      const std::vector<Row>& problem_rows) const;
+  /**
+   * Optimise the `block` of the problem directly,
+   * since it is either a single column that appears in no row or a single row whose coefficients are all zero.
+   * @param block block of the problem, without rows or without columns
+   * @param problem_columns columns of the problem
+   * @param problem_rows rows of the problem
+   * @return exact solution of the block
+   */
+  [[nodiscard]] BlockSolution SolveTrivialBlock(const Decomposition::Block& block,
+                                                const std::vector<Column>& problem_columns,
+                                                const std::vector<Row>& problem_rows) const;
+
+  std::vector<Scope> scopes_;                     ///< Open scopes, from the outermost to the innermost
+  std::vector<BoundChange> bound_trail_;          ///< Bound changes to undo when closing the scopes
+  std::vector<RowBoundChange> row_bound_trail_;   ///< Row bound changes to undo when closing the scopes
+  std::vector<ObjectiveChange> objective_trail_;  ///< Objective changes to undo when closing the scopes
+  Changes changes_;                               ///< Changes to the LP problem since the last solve
+  std::vector<Column> propagated_;                ///< Columns tightened by the last propagation, with their new bounds
+  Dualization::Variables dual_variables_;         ///< Variables of the columns of the dual problem, reused
+  std::unique_ptr<LpSolver> dual_solver_;         ///< LP solver of the dual problem, kept across dualized solves
+  std::optional<Dualization> dualization_;        ///< Dual problem held by @ref dual_solver_
 };
 
 std::ostream& operator<<(std::ostream& os, const LpSolver& solver);
@@ -0,0 +1,188 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/solver/ModelFeatures.h"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <ostream>
+
+#include "delpi/util/logging.h"
+
+namespace delpi {
+
+namespace {
+
+/** Arithmetic profile of the non-zero numbers of an LP problem. */
+struct NumberStats {
+  std::size_t count{0};             ///< Number of non-zero numbers
+  std::size_t total_complexity{0};  ///< Sum of the complexity of the numbers
+  std::size_t max_complexity{0};    ///< Largest complexity of a number
+  std::size_t exact_doubles{0};     ///< Number of numbers that are exact doubles
+
+  /**
+   * Add the `value` to the profile, unless it is zero.
+   * @param value number of the LP problem
+   */
+  void Add(const mpq_class& value);
+};
+
+/**
+ * Check whether the non-zero `value` can be represented exactly by a double.
+ *
+ * The denominator must be a power of two, the significant bits of the numerator must fit the mantissa
+ * and the magnitude must be within the range of the exponent.
+ * @param value non-zero value to check
+ * @return true if the value is a double
+ * @return false if the value would be rounded
+ */
+bool IsExactDouble(const mpq_class& value) {
+  const mpz_srcptr num = value.get_num_mpz_t();
+  const mpz_srcptr den = value.get_den_mpz_t();
+  if (mpz_popcount(den) != 1) return false;
+  const auto num_bits = static_cast<std::ptrdiff_t>(mpz_sizeinbase(num, 2));
+  const auto significant_bits = num_bits - static_cast<std::ptrdiff_t>(mpz_scan1(num, 0));
+  const auto exponent = num_bits - static_cast<std::ptrdiff_t>(mpz_sizeinbase(den, 2));
+  return significant_bits <= std::numeric_limits<double>::digits &&
+         exponent < std::numeric_limits<double>::max_exponent &&
+         exponent >= std::numeric_limits<double>::min_exponent - std::numeric_limits<double>::digits;
+}
+
+/**
+ * Approximate the log2 of the absolute value of the non-zero `value` from the size of its numerator and denominator.
+ * @param value non-zero value
+ * @return log2 of the absolute value of `value`, within one unit
+ */
+double Log2Abs(const mpq_class& value) {
+  return static_cast<double>(mpz_sizeinbase(value.get_num_mpz_t(), 2)) -
+         static_cast<double>(mpz_sizeinbase(value.get_den_mpz_t(), 2));
+}
+
+void NumberStats::Add(const mpq_class& value) {
+  if (value == 0) return;
+  const std::size_t complexity = gmp::complexity(value);
+  ++count;
+  total_complexity += complexity;
+  max_complexity = std::max(max_complexity, complexity);
+  if (IsExactDouble(value)) ++exact_doubles;
+}
+
+/**
+ * Classify a row or column by its bounds.
+ * @param lb lower bound, if any
+ * @param ub upper bound, if any
+ * @return 0 if the bounds coincide, 1 if they are different, 2 if there is only one of them and 3 if there is none
+ */
+std::size_t BoundType(const std::optional<mpq_class>& lb, const std::optional<mpq_class>& ub) {
+  if (lb.has_value() && ub.has_value()) return *lb == *ub ? 0 : 1;
+  return lb.has_value() || ub.has_value() ? 2 : 3;
+}
+
+/**
+ * Compute `part / total`, or zero if `total` is zero.
+ * @param part numerator
+ * @param total denominator
+ * @return ratio between `part` and `total`
+ */
+double Ratio(const double part, const double total) { return total == 0 ? 0 : part / total; }
+
+}  // namespace
+
+ModelFeatures::ModelFeatures(const std::vector<Column>& columns, const std::vector<Row>& rows) {
+  NumberStats numbers;
+  std::size_t nonzeros = 0;
+  double min_log2 = std::numeric_limits<double>::infinity();
+  double max_log2 = -std::numeric_limits<double>::infinity();
+  std::array<std::size_t, 4> row_types{}, column_types{};
+  std::size_t row_bounds = 0, zero_row_bounds = 0, objective_columns = 0;
+  const auto add_row_bound = [&](const mpq_class& bound) {
+    ++row_bounds;
+    if (bound == 0) ++zero_row_bounds;
+    numbers.Add(bound);
+  };
+
+  for (const Column& column : columns) {
+    ++column_types[BoundType(column.lb, column.ub)];
+    if (column.lb.has_value()) numbers.Add(*column.lb);
+    if (column.ub.has_value() && column.ub != column.lb) numbers.Add(*column.ub);
+    if (column.obj.has_value() && *column.obj != 0) {
+      ++objective_columns;
+      numbers.Add(*column.obj);
+    }
+  }
+  for (const Row& row : rows) {
+    ++row_types[BoundType(row.lb, row.ub)];
+    // An equality row has a single right-hand side
+    if (row.lb.has_value()) add_row_bound(*row.lb);
+    if (row.ub.has_value() && row.ub != row.lb) add_row_bound(*row.ub);
+    for (const auto& [var, coeff] : row.addends) {
+      if (coeff == 0) continue;
+      ++nonzeros;
+      numbers.Add(coeff);
+      const double log2 = Log2Abs(coeff);
+      min_log2 = std::min(min_log2, log2);
+      max_log2 = std::max(max_log2, log2);
+    }
+  }
+
+  const auto num_columns = static_cast<double>(columns.size());
+  const auto num_rows = static_cast<double>(rows.size());
+  const auto set = [this](const Feature feature, const double value) {
+    values_[static_cast<std::size_t>(feature)] = value;
+  };
+  set(Feature::NUM_COLUMNS, num_columns);
+  set(Feature::NUM_ROWS, num_rows);
+  set(Feature::NUM_NONZEROS, static_cast<double>(nonzeros));
+  set(Feature::DENSITY, Ratio(static_cast<double>(nonzeros), num_columns * num_rows));
+  set(Feature::ROW_COLUMN_RATIO, Ratio(num_rows, num_columns));
+  set(Feature::MAX_COMPLEXITY, static_cast<double>(numbers.max_complexity));
+  set(Feature::MEAN_COMPLEXITY,
+      Ratio(static_cast<double>(numbers.total_complexity), static_cast<double>(numbers.count)));
+  set(Feature::LOG2_DYNAMIC_RANGE, nonzeros == 0 ? 0 : max_log2 - min_log2);
+  set(Feature::DOUBLE_EXACT_RATIO,
+      numbers.count == 0 ? 1 : Ratio(static_cast<double>(numbers.exact_doubles), static_cast<double>(numbers.count)));
+  set(Feature::EQUALITY_ROW_RATIO, Ratio(static_cast<double>(row_types[0]), num_rows));
+  set(Feature::RANGED_ROW_RATIO, Ratio(static_cast<double>(row_types[1]), num_rows));
+  set(Feature::INEQUALITY_ROW_RATIO, Ratio(static_cast<double>(row_types[2]), num_rows));
+  set(Feature::FREE_ROW_RATIO, Ratio(static_cast<double>(row_types[3]), num_rows));
+  set(Feature::FIXED_COLUMN_RATIO, Ratio(static_cast<double>(column_types[0]), num_columns));
+  set(Feature::BOXED_COLUMN_RATIO, Ratio(static_cast<double>(column_types[1]), num_columns));
+  set(Feature::BOUNDED_COLUMN_RATIO, Ratio(static_cast<double>(column_types[2]), num_columns));
+  set(Feature::FREE_COLUMN_RATIO, Ratio(static_cast<double>(column_types[3]), num_columns));
+  set(Feature::ZERO_RHS_RATIO, Ratio(static_cast<double>(zero_row_bounds), static_cast<double>(row_bounds)));
+  set(Feature::OBJECTIVE_DENSITY, Ratio(static_cast<double>(objective_columns), num_columns));
+  DELPI_DEBUG_FMT("ModelFeatures::ModelFeatures: {}", *this);
+}
+
+std::optional<ModelFeatures::Feature> ModelFeatures::FromName(const std::string_view name) {
+  const auto it = std::ranges::find(names, name);
+  if (it == names.end()) return std::nullopt;
+  return static_cast<Feature>(it - names.begin());
+}
+
+void ModelFeatures::WriteCsvHeader(std::ostream& os) {
+  for (std::size_t i = 0; i < num_features; ++i) os << (i == 0 ? "" : ",") << names[i];
+}
+
+void ModelFeatures::WriteCsv(std::ostream& os) const {
+  for (std::size_t i = 0; i < num_features; ++i) os << (i == 0 ? "" : ",") << fmt::format("{}", values_[i]);
+}
+
+std::ostream& operator<<(std::ostream& os, const ModelFeatures::Feature& feature) {
+  return os << ModelFeatures::names[static_cast<std::size_t>(feature)];
+}
+
+std::ostream& operator<<(std::ostream& os, const ModelFeatures& features) {
+  os << "ModelFeatures{ ";
+  for (std::size_t i = 0; i < ModelFeatures::num_features; ++i) {
+    os << (i == 0 ? "" : ", ") << ModelFeatures::names[i] << ": " << fmt::format("{}", features.values()[i]);
+  }
+  return os << " }";
+}
+
+}  // namespace delpi
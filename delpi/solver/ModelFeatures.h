@@ -0,0 +1,114 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * ModelFeatures class.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <iosfwd>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "delpi/solver/Column.h"
+#include "delpi/solver/Row.h"
+
+namespace delpi {
+
+/**
+ * Numeric profile of an LP problem, cheap enough to be computed before each solve.
+ *
+ * All the features are collected in a single pass over the columns and the rows of the problem.
+ * They describe its size, the arithmetic cost of its numbers, their dynamic range
+ * and how many of them would survive a round trip through a double,
+ * the types of its rows and columns and a couple of hints of degeneracy.
+ * Ratios are used in place of counts wherever possible, so that problems of different sizes can be compared.
+ * @code
+ * const ModelFeatures features{columns, rows};
+ * features[ModelFeatures::Feature::DENSITY];  // fraction of the constraint matrix that is not zero
+ * @endcode
+ */
+class ModelFeatures {
+ public:
+  /** Feature of the LP problem. */
+  enum class Feature {
+    NUM_COLUMNS,           ///< Number of columns
+    NUM_ROWS,              ///< Number of rows
+    NUM_NONZEROS,          ///< Number of non-zero coefficients in the constraint matrix
+    DENSITY,               ///< Fraction of the coefficients of the constraint matrix that are not zero
+    ROW_COLUMN_RATIO,      ///< Number of rows divided by the number of columns
+    MAX_COMPLEXITY,        ///< Largest number of limbs of a number in the problem, as in gmp::complexity
+    MEAN_COMPLEXITY,       ///< Average number of limbs of a non-zero number in the problem
+    LOG2_DYNAMIC_RANGE,    ///< Approximate log2 of the ratio between the largest and smallest non-zero coefficient
+    DOUBLE_EXACT_RATIO,    ///< Fraction of the non-zero numbers in the problem that are exact doubles
+    EQUALITY_ROW_RATIO,    ///< Fraction of the rows whose bounds coincide
+    RANGED_ROW_RATIO,      ///< Fraction of the rows with two different bounds
+    INEQUALITY_ROW_RATIO,  ///< Fraction of the rows with a single bound
+    FREE_ROW_RATIO,        ///< Fraction of the rows without bounds
+    FIXED_COLUMN_RATIO,    ///< Fraction of the columns whose bounds coincide
+    BOXED_COLUMN_RATIO,    ///< Fraction of the columns with two different bounds
+    BOUNDED_COLUMN_RATIO,  ///< Fraction of the columns with a single bound
+    FREE_COLUMN_RATIO,     ///< Fraction of the columns without bounds
+    ZERO_RHS_RATIO,        ///< Fraction of the finite row bounds that are zero, a hint of primal degeneracy
+    OBJECTIVE_DENSITY,     ///< Fraction of the columns in the objective. A sparse objective hints at dual degeneracy
+  };
+  static constexpr std::size_t num_features = static_cast<std::size_t>(Feature::OBJECTIVE_DENSITY) + 1;
+  /** Name of each feature, in the same order as the @ref Feature values. */
+  static constexpr std::array<std::string_view, num_features> names{
+      "num_columns",          "num_rows",           "num_nonzeros",       "density",
+      "row_column_ratio",     "max_complexity",     "mean_complexity",    "log2_dynamic_range",
+      "double_exact_ratio",   "equality_row_ratio", "ranged_row_ratio",   "inequality_row_ratio",
+      "free_row_ratio",       "fixed_column_ratio", "boxed_column_ratio", "bounded_column_ratio",
+      "free_column_ratio",    "zero_rhs_ratio",     "objective_density"};
+
+  /**
+   * Compute the features of the LP problem with the given `columns` and `rows`.
+   * @param columns columns of the problem
+   * @param rows rows of the problem
+   */
+  ModelFeatures(const std::vector<Column>& columns, const std::vector<Row>& rows);
+
+  /**
+   * Find the feature with the given `name`.
+   * @param name name of the feature, as in @ref names
+   * @return feature with the given `name`
+   * @return std::nullopt if no feature has that name
+   */
+  [[nodiscard]] static std::optional<Feature> FromName(std::string_view name);
+
+  /**
+   * Write the names of the features as the header of a CSV file, without a trailing newline.
+   * @param os output stream
+   */
+  static void WriteCsvHeader(std::ostream& os);
+  /**
+   * Write the values of the features as a line of a CSV file, in the same order as @ref WriteCsvHeader.
+   * @param os output stream
+   */
+  void WriteCsv(std::ostream& os) const;
+
+  /** @getter{value of the `feature`, model features} */
+  [[nodiscard]] double operator[](Feature feature) const { return values_[static_cast<std::size_t>(feature)]; }
+  /** @getter{values of all the features, model features} */
+  [[nodiscard]] const std::array<double, num_features>& values() const { return values_; }
+
+ private:
+  std::array<double, num_features> values_{};  ///< Value of each feature
+};
+
+std::ostream& operator<<(std::ostream& os, const ModelFeatures::Feature& feature);
+std::ostream& operator<<(std::ostream& os, const ModelFeatures& features);
+
+}  // namespace delpi
+
+#ifdef DELPI_INCLUDE_FMT
+
+#include "delpi/util/logging.h"
+
+OSTREAM_FORMATTER(delpi::ModelFeatures::Feature)
+OSTREAM_FORMATTER(delpi::ModelFeatures)
+
+#endif
@@ -0,0 +1,389 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/solver/Pdhg.h"
+
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <ostream>
+#include <utility>
+
+#include "delpi/util/ThreadPool.h"
+#include "delpi/util/error.h"
+#include "delpi/util/logging.h"
+
+namespace delpi {
+
+namespace {
+
+constexpr double inf = std::numeric_limits<double>::infinity();
+constexpr int ruiz_iterations = 10;        ///< Rounds of Ruiz equilibration of the matrix
+constexpr int power_iterations = 20;       ///< Rounds of power iteration used to estimate the norm of the matrix
+constexpr int check_frequency = 64;        ///< Iterations between two evaluations of the KKT error
+constexpr double step_fraction = 0.9;      ///< Fraction of the largest step size ensuring convergence
+constexpr double sufficient_decay = 0.2;   ///< Decay of the KKT error since the last restart that triggers a restart
+constexpr double artificial_decay = 0.36;  ///< Fraction of the iterations since the last restart that triggers one
+constexpr std::size_t min_chunk_nonzeros = 1 << 16;  ///< Fewest non-zeros worth handing to another thread
+
+/**
+ * Project `value` onto the interval between `lb` and `ub`.
+ *
+ * Unlike std::clamp, crossed bounds are allowed, in which case the result is `ub`.
+ * @param value value to project
+ * @param lb lower bound, possibly -infinity
+ * @param ub upper bound, possibly infinity
+ * @return closest value to `value` within the bounds
+ */
+double Project(const double value, const double lb, const double ub) { return std::min(std::max(value, lb), ub); }
+
+/**
+ * Compute the Euclidean norm of `v`.
+ * @param v vector
+ * @return Euclidean norm of `v`
+ */
+double Norm(const std::vector<double>& v) {
+  return std::sqrt(std::transform_reduce(v.begin(), v.end(), 0.0, std::plus<>{}, [](double e) { return e * e; }));
+}
+
+/**
+ * Compute the Euclidean distance between `u` and `v`.
+ * @param u first vector
+ * @param v second vector
+ * @return Euclidean norm of `u - v`
+ */
+double Distance(const std::vector<double>& u, const std::vector<double>& v) {
+  return std::sqrt(std::transform_reduce(u.begin(), u.end(), v.begin(), 0.0, std::plus<>{}, [](double a, double b) {
+    return (a - b) * (a - b);
+  }));
+}
+
+/**
+ * Project the reduced cost `r` of a column or row onto the values its dual multiplier can take.
+ *
+ * A multiplier can be positive only with a lower bound, and negative only with an upper bound.
+ * @param r reduced cost
+ * @param lb lower bound, possibly -infinity
+ * @param ub upper bound, possibly infinity
+ * @return closest multiplier to `r` that is compatible with the bounds
+ */
+double ProjectMultiplier(const double r, const double lb, const double ub) {
+  if (lb == -inf && r > 0) return 0;
+  if (ub == inf && r < 0) return 0;
+  return r;
+}
+
+/**
+ * Contribution of a multiplier to the dual objective, which is zero if the multiplier is zero.
+ * @param multiplier dual multiplier of the bounds
+ * @param lb lower bound, possibly -infinity
+ * @param ub upper bound, possibly infinity
+ * @return value of the bound the multiplier refers to, times the multiplier
+ */
+double DualTerm(const double multiplier, const double lb, const double ub) {
+  if (multiplier > 0) return multiplier * lb;
+  if (multiplier < 0) return multiplier * ub;
+  return 0;
+}
+
+/**
+ * Relative distance of `value` from the bound closest to it.
+ * @param value value of the column or row
+ * @param lb lower bound, possibly -infinity
+ * @param ub upper bound, possibly infinity
+ * @return distance from the closest bound, relative to the size of the bound, or infinity if there are no bounds
+ */
+double BoundDistance(const double value, const double lb, const double ub) {
+  return std::min(lb == -inf ? inf : std::abs(value - lb) / (1 + std::abs(lb)),
+                  ub == inf ? inf : std::abs(ub - value) / (1 + std::abs(ub)));
+}
+
+/**
+ * Non-basic status of a column or row with the given `value` and bounds.
+ * @param value value of the column or row
+ * @param lb lower bound, possibly -infinity
+ * @param ub upper bound, possibly infinity
+ * @return status at the closest bound, or FREE if there are no bounds
+ */
+BasisStatus NonBasicStatus(const double value, const double lb, const double ub) {
+  if (lb == ub) return BasisStatus::FIXED;
+  if (lb == -inf && ub == inf) return BasisStatus::FREE;
+  if (ub == inf) return BasisStatus::AT_LOWER;
+  if (lb == -inf) return BasisStatus::AT_UPPER;
+  return value - lb <= ub - value ? BasisStatus::AT_LOWER : BasisStatus::AT_UPPER;
+}
+
+}  // namespace
+
+Pdhg::Pdhg(const std::vector<Column>& columns, const std::vector<Row>& rows,
+           const std::unordered_map<Variable, int>& var_to_col, const unsigned int num_threads)
+    : column_scale_(columns.size(), 1.0),
+      row_scale_(rows.size(), 1.0),
+      obj_(columns.size()),
+      lb_(columns.size()),
+      ub_(columns.size()),
+      row_lb_(rows.size()),
+      row_ub_(rows.size()),
+      obj_norm_{0},
+      bound_norm_{0},
+      num_threads_{std::max(num_threads, 1u)} {
+  const std::size_t n = columns.size(), m = rows.size();
+  a_.begin.reserve(m + 1);
+  a_.begin.push_back(0);
+  for (const Row& row : rows) {
+    for (const auto& [var, coeff] : row.addends) {
+      if (coeff == 0) continue;
+      a_.index.push_back(var_to_col.at(var));
+      a_.value.push_back(coeff.get_d());
+    }
+    a_.begin.push_back(a_.index.size());
+  }
+
+  // Ruiz equilibration: divide each row and column by the square root of its largest entry, until they are all ~1
+  for (int round = 0; round < ruiz_iterations; ++round) {
+    std::vector<double> row_max(m, 0.0), column_max(n, 0.0);
+    for (std::size_t i = 0; i < m; ++i) {
+      for (std::size_t k = a_.begin[i]; k < a_.begin[i + 1]; ++k) {
+        const double e = std::abs(a_.value[k]);
+        row_max[i] = std::max(row_max[i], e);
+        column_max[a_.index[k]] = std::max(column_max[a_.index[k]], e);
+      }
+    }
+    for (double& e : row_max) e = e == 0 ? 1 : 1 / std::sqrt(e);
+    for (double& e : column_max) e = e == 0 ? 1 : 1 / std::sqrt(e);
+    for (std::size_t i = 0; i < m; ++i) {
+      row_scale_[i] *= row_max[i];
+      for (std::size_t k = a_.begin[i]; k < a_.begin[i + 1]; ++k) a_.value[k] *= row_max[i] * column_max[a_.index[k]];
+    }
+    for (std::size_t j = 0; j < n; ++j) column_scale_[j] *= column_max[j];
+  }
+
+  // Transpose
+  at_.begin.assign(n + 1, 0);
+  for (const int j : a_.index) ++at_.begin[j + 1];
+  std::partial_sum(at_.begin.begin(), at_.begin.end(), at_.begin.begin());
+  at_.index.resize(a_.index.size());
+  at_.value.resize(a_.value.size());
+  std::vector<std::size_t> next{at_.begin.begin(), at_.begin.end() - 1};
+  for (std::size_t i = 0; i < m; ++i) {
+    for (std::size_t k = a_.begin[i]; k < a_.begin[i + 1]; ++k) {
+      const std::size_t pos = next[a_.index[k]]++;
+      at_.index[pos] = static_cast<int>(i);
+      at_.value[pos] = a_.value[k];
+    }
+  }
+
+  // With x = D_c x' and y = D_r y', the scaled problem has objective D_c c and row bounds D_r l_r, D_r u_r
+  for (std::size_t j = 0; j < n; ++j) {
+    const Column& column = columns[j];
+    obj_[j] = column.obj.has_value() ? column.obj->get_d() * column_scale_[j] : 0;
+    lb_[j] = column.lb.has_value() ? column.lb->get_d() / column_scale_[j] : -inf;
+    ub_[j] = column.ub.has_value() ? column.ub->get_d() / column_scale_[j] : inf;
+  }
+  for (std::size_t i = 0; i < m; ++i) {
+    row_lb_[i] = rows[i].lb.has_value() ? rows[i].lb->get_d() * row_scale_[i] : -inf;
+    row_ub_[i] = rows[i].ub.has_value() ? rows[i].ub->get_d() * row_scale_[i] : inf;
+    const double bound = std::max(std::isfinite(row_lb_[i]) ? std::abs(row_lb_[i]) : 0.0,
+                                  std::isfinite(row_ub_[i]) ? std::abs(row_ub_[i]) : 0.0);
+    bound_norm_ += bound * bound;
+  }
+  bound_norm_ = std::sqrt(bound_norm_);
+  obj_norm_ = Norm(obj_);
+  DELPI_DEBUG_FMT("Pdhg::Pdhg: {}x{} matrix with {} non-zeros", m, n, a_.value.size());
+}
+
+void Pdhg::Multiply(const Csr& matrix, const std::vector<double>& v, std::vector<double>& out, ThreadPool* pool) {
+  const std::size_t num_rows = matrix.begin.size() - 1;
+  const auto multiply_rows = [&](const std::size_t first, const std::size_t last) {
+    for (std::size_t i = first; i < last; ++i) {
+      double sum = 0;
+      for (std::size_t k = matrix.begin[i]; k < matrix.begin[i + 1]; ++k) sum += matrix.value[k] * v[matrix.index[k]];
+      out[i] = sum;
+    }
+  };
+  const std::size_t nnz = matrix.value.size();
+  const std::size_t num_chunks =
+      pool == nullptr ? 1 : std::clamp<std::size_t>(nnz / min_chunk_nonzeros, 1, std::min(pool->size() + 1, num_rows));
+  if (num_chunks == 1) return multiply_rows(0, num_rows);
+
+  // Split the rows so that each chunk has about the same number of non-zeros
+  std::vector<std::size_t> chunk_begin(num_chunks + 1, num_rows);
+  chunk_begin[0] = 0;
+  for (std::size_t chunk = 1; chunk < num_chunks; ++chunk) {
+    const auto it = std::lower_bound(matrix.begin.begin(), matrix.begin.end(), chunk * nnz / num_chunks);
+    chunk_begin[chunk] = std::max(chunk_begin[chunk - 1], static_cast<std::size_t>(it - matrix.begin.begin()));
+    chunk_begin[chunk] = std::min(chunk_begin[chunk], num_rows);
+  }
+  std::vector<std::future<void>> futures;
+  futures.reserve(num_chunks - 1);
+  for (std::size_t chunk = 1; chunk < num_chunks; ++chunk) {
+    futures.emplace_back(pool->Submit([&, chunk]() { multiply_rows(chunk_begin[chunk], chunk_begin[chunk + 1]); }));
+  }
+  multiply_rows(chunk_begin[0], chunk_begin[1]);
+  for (std::future<void>& future : futures) future.get();
+}
+
+double Pdhg::EstimateNorm(ThreadPool* pool) const {
+  std::vector<double> v(num_columns(), 1.0), av(num_rows());
+  double norm = 0;
+  for (int round = 0; round < power_iterations; ++round) {
+    const double v_norm = Norm(v);
+    if (v_norm == 0) return 0;
+    for (double& e : v) e /= v_norm;
+    Multiply(a_, v, av, pool);
+    Multiply(at_, av, v, pool);
+    norm = std::sqrt(Norm(v));
+  }
+  return norm;
+}
+
+double Pdhg::Error(const Iterate& iterate) const {
+  double primal_residual = 0, dual_residual = 0, primal_obj = 0, dual_obj = 0;
+  for (int i = 0; i < num_rows(); ++i) {
+    const double violation = iterate.ax[i] - Project(iterate.ax[i], row_lb_[i], row_ub_[i]);
+    primal_residual += violation * violation;
+    dual_obj += DualTerm(iterate.y[i], row_lb_[i], row_ub_[i]);
+  }
+  for (int j = 0; j < num_columns(); ++j) {
+    const double reduced_cost = obj_[j] - iterate.aty[j];
+    const double multiplier = ProjectMultiplier(reduced_cost, lb_[j], ub_[j]);
+    dual_residual += (reduced_cost - multiplier) * (reduced_cost - multiplier);
+    dual_obj += DualTerm(multiplier, lb_[j], ub_[j]);
+    primal_obj += obj_[j] * iterate.x[j];
+  }
+  return std::max({std::sqrt(primal_residual) / (1 + bound_norm_), std::sqrt(dual_residual) / (1 + obj_norm_),
+                   std::abs(primal_obj - dual_obj) / (1 + std::abs(primal_obj) + std::abs(dual_obj))});
+}
+
+Pdhg::Result Pdhg::Solve(const int max_iterations, const double tolerance) const {
+  const std::size_t n = column_scale_.size(), m = row_scale_.size();
+  std::unique_ptr<ThreadPool> pool;
+  if (num_threads_ > 1 && m > 1) pool = std::make_unique<ThreadPool>(std::min<std::size_t>(num_threads_, m) - 1);
+
+  const double norm = EstimateNorm(pool.get());
+  const double step = norm == 0 ? 1 : step_fraction / norm;
+  double primal_weight = obj_norm_ > 0 && bound_norm_ > 0 ? obj_norm_ / bound_norm_ : 1;
+
+  Iterate current{std::vector<double>(n), std::vector<double>(m), std::vector<double>(m), std::vector<double>(n)};
+  for (std::size_t j = 0; j < n; ++j) current.x[j] = Project(0.0, lb_[j], ub_[j]);
+  Multiply(a_, current.x, current.ax, pool.get());
+  Iterate average{current}, last_restart{current};
+  double last_restart_error = Error(current);
+  int iterations_since_restart = 0, restarts = 0, iteration = 0;
+  double best_error = last_restart_error;
+  Iterate best{current};
+
+  std::vector<double> x_next(n), ax_next(m);
+  while (iteration < max_iterations && best_error > tolerance) {
+    const double tau = step / primal_weight, sigma = step * primal_weight;
+    // x+ = proj_X(x - tau (c - A^T y))
+    for (std::size_t j = 0; j < n; ++j) {
+      x_next[j] = Project(current.x[j] - tau * (obj_[j] - current.aty[j]), lb_[j], ub_[j]);
+    }
+    Multiply(a_, x_next, ax_next, pool.get());
+    // y+ = w + sigma proj_[l,u](-w / sigma), with w = y - sigma A (2 x+ - x)
+    for (std::size_t i = 0; i < m; ++i) {
+      const double w = current.y[i] - sigma * (2 * ax_next[i] - current.ax[i]);
+      current.y[i] = w + sigma * Project(-w / sigma, row_lb_[i], row_ub_[i]);
+    }
+    std::swap(current.x, x_next);
+    std::swap(current.ax, ax_next);
+    Multiply(at_, current.y, current.aty, pool.get());
+    ++iteration;
+    ++iterations_since_restart;
+
+    // Running average since the last restart. Its products follow by linearity
+    const double weight = 1.0 / iterations_since_restart;
+    for (std::size_t j = 0; j < n; ++j) {
+      average.x[j] += weight * (current.x[j] - average.x[j]);
+      average.aty[j] += weight * (current.aty[j] - average.aty[j]);
+    }
+    for (std::size_t i = 0; i < m; ++i) {
+      average.y[i] += weight * (current.y[i] - average.y[i]);
+      average.ax[i] += weight * (current.ax[i] - average.ax[i]);
+    }
+    if (iteration % check_frequency != 0 && iteration != max_iterations) continue;
+
+    const double current_error = Error(current), average_error = Error(average);
+    const bool use_average = average_error < current_error;
+    const double candidate_error = use_average ? average_error : current_error;
+    if (candidate_error < best_error) {
+      best_error = candidate_error;
+      best = use_average ? average : current;
+    }
+    if (candidate_error > sufficient_decay * last_restart_error &&
+        iterations_since_restart < artificial_decay * iteration)
+      continue;
+
+    // Restart from the candidate, and rebalance the steps with the movement since the last restart
+    if (use_average) current = average;
+    const double delta_x = Distance(current.x, last_restart.x), delta_y = Distance(current.y, last_restart.y);
+    if (delta_x > 1e-10 && delta_y > 1e-10) primal_weight = std::sqrt(primal_weight * delta_y / delta_x);
+    last_restart = current;
+    last_restart_error = candidate_error;
+    average = current;
+    iterations_since_restart = 0;
+    ++restarts;
+  }
+
+  Result result{best_error <= tolerance, iteration, restarts, best_error, std::move(best.x), std::move(best.y)};
+  for (std::size_t j = 0; j < n; ++j) result.solution[j] *= column_scale_[j];
+  for (std::size_t i = 0; i < m; ++i) result.dual_solution[i] *= row_scale_[i];
+  DELPI_DEBUG_FMT("Pdhg::Solve: {}", result);
+  return result;
+}
+
+Basis Pdhg::CrashBasis(const Result& result, const double tolerance) const {
+  DELPI_ASSERT(static_cast<int>(result.solution.size()) == num_columns(), "Wrong number of columns in the result");
+  DELPI_ASSERT(static_cast<int>(result.dual_solution.size()) == num_rows(), "Wrong number of rows in the result");
+  const int n = num_columns(), m = num_rows();
+
+  // Work in the scaled problem, where the values of the rows and the columns are comparable
+  std::vector<double> x(n), y(m), ax(m), aty(n);
+  for (int j = 0; j < n; ++j) x[j] = result.solution[j] / column_scale_[j];
+  for (int i = 0; i < m; ++i) y[i] = result.dual_solution[i] / row_scale_[i];
+  Multiply(a_, x, ax, nullptr);
+  Multiply(at_, y, aty, nullptr);
+
+  // Index k < n is column k, while index k >= n is the slack of row k - n
+  const auto value = [&](const int k) { return k < n ? x[k] : ax[k - n]; };
+  const auto lb = [&](const int k) { return k < n ? lb_[k] : row_lb_[k - n]; };
+  const auto ub = [&](const int k) { return k < n ? ub_[k] : row_ub_[k - n]; };
+  const auto dual = [&](const int k) { return std::abs(k < n ? obj_[k] - aty[k] : y[k - n]); };
+  const auto distance = [&](const int k) { return BoundDistance(value(k), lb(k), ub(k)); };
+
+  std::vector<int> basic, non_basic;
+  for (int k = 0; k < n + m; ++k) (distance(k) > tolerance ? basic : non_basic).push_back(k);
+  if (static_cast<int>(basic.size()) > m) {
+    // Keep the ones farthest from their bounds
+    std::ranges::stable_sort(basic, [&](const int k1, const int k2) { return distance(k1) > distance(k2); });
+    non_basic.insert(non_basic.end(), basic.begin() + m, basic.end());
+    basic.resize(m);
+  } else if (static_cast<int>(basic.size()) < m) {
+    // Add the ones whose bound is the least binding, slacks first
+    std::ranges::stable_sort(non_basic, [&](const int k1, const int k2) {
+      return std::pair{dual(k1), k1 < n} < std::pair{dual(k2), k2 < n};
+    });
+    const auto missing = static_cast<std::ptrdiff_t>(m - basic.size());
+    basic.insert(basic.end(), non_basic.begin(), non_basic.begin() + missing);
+    non_basic.erase(non_basic.begin(), non_basic.begin() + missing);
+  }
+
+  Basis basis{std::vector<BasisStatus>(n), std::vector<BasisStatus>(m)};
+  const auto status = [&](const int k) -> BasisStatus& { return k < n ? basis.columns[k] : basis.rows[k - n]; };
+  for (const int k : basic) status(k) = BasisStatus::BASIC;
+  for (const int k : non_basic) status(k) = NonBasicStatus(value(k), lb(k), ub(k));
+  return basis;
+}
+
+std::ostream& operator<<(std::ostream& os, const Pdhg::Result& result) {
+  return os << "Pdhg::Result{ converged: " << result.converged << ", iterations: " << result.iterations
+            << ", restarts: " << result.restarts << ", error: " << result.error << " }";
+}
+
+}  // namespace delpi
@@ -0,0 +1,154 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * Pdhg class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <unordered_map>
+#include <vector>
+
+#include "delpi/solver/Basis.h"
+#include "delpi/solver/Column.h"
+#include "delpi/solver/Row.h"
+#include "delpi/symbolic/Variable.h"
+
+namespace delpi {
+
+class ThreadPool;
+
+/**
+ * Primal-dual hybrid gradient method for LP problems, in double precision.
+ *
+ * It finds an approximate primal and dual solution of the problem
+ * @f$ \min c^T x @f$ s.t. @f$ l_r \le A x \le u_r @f$, @f$ l_c \le x \le u_c @f$
+ * using only products with @f$ A @f$ and @f$ A^T @f$, so each iteration costs a couple of passes over the matrix.
+ * It follows PDLP: the matrix is equilibrated with a few rounds of Ruiz scaling,
+ * the iterates are restarted to their average when the KKT error has decayed enough,
+ * and the primal weight balancing the primal and the dual steps is updated at each restart.
+ * The products are split among the threads by rows, with the matrix and its transpose stored in CSR format.
+ *
+ * The solution is not exact, and is meant to be turned into a starting basis with @ref CrashBasis.
+ * @code
+ * const Pdhg pdhg{columns, rows, var_to_col, 4};
+ * const Pdhg::Result result{pdhg.Solve(10000, 1e-4)};
+ * lp_solver.SetBasis(pdhg.CrashBasis(result));
+ * @endcode
+ */
+class Pdhg {
+ public:
+  /** Approximate solution found by the PDHG method. */
+  struct Result {
+    bool converged;                    ///< Whether the relative KKT error is within the tolerance
+    int iterations;                    ///< Number of iterations performed
+    int restarts;                      ///< Number of restarts performed
+    double error;                      ///< Relative KKT error of the solution
+    std::vector<double> solution;      ///< Approximate value of each column
+    std::vector<double> dual_solution; ///< Approximate dual value of each row
+  };
+
+  /**
+   * Prepare the PDHG method for the LP problem with the given `columns` and `rows`.
+   * @param columns columns of the problem
+   * @param rows rows of the problem
+   * @param var_to_col map from the variables to the index of their column
+   * @param num_threads maximum number of threads used for the products with the matrix
+   */
+  Pdhg(const std::vector<Column>& columns, const std::vector<Row>& rows,
+       const std::unordered_map<Variable, int>& var_to_col, unsigned int num_threads = 1);
+
+  /**
+   * Run the PDHG method until the relative KKT error is at most `tolerance` or `max_iterations` are performed.
+   *
+   * The relative KKT error is the largest among the primal residual, the dual residual and the duality gap,
+   * each relative to the size of the data it depends on.
+   * @param max_iterations maximum number of iterations
+   * @param tolerance relative KKT error to reach
+   * @return best solution found
+   */
+  [[nodiscard]] Result Solve(int max_iterations, double tolerance) const;
+
+  /**
+   * Build a basis of the problem from the approximate solution in `result`.
+   *
+   * Columns and rows at one of their bounds, up to `tolerance` relative to the bound, are non-basic at that bound.
+   * All the others are basic, from the farthest from their bounds.
+   * The number of basic columns and rows is then brought to the number of rows:
+   * the closest to their bounds among the extra ones become non-basic,
+   * while the missing ones are taken among the non-basic ones with the smallest dual value, slacks first.
+   * The basis may still be singular, in which case the LP solver will replace some of its columns with slacks.
+   * @param result approximate solution of the problem
+   * @param tolerance relative distance from a bound under which the bound is considered active
+   * @return basis with a status for each column and row, exactly as many basic ones as the rows
+   */
+  [[nodiscard]] Basis CrashBasis(const Result& result, double tolerance) const;
+
+  /** @getter{number of columns, PDHG problem} */
+  [[nodiscard]] int num_columns() const { return static_cast<int>(column_scale_.size()); }
+  /** @getter{number of rows, PDHG problem} */
+  [[nodiscard]] int num_rows() const { return static_cast<int>(row_scale_.size()); }
+
+ private:
+  /** Sparse matrix in compressed sparse row format. */
+  struct Csr {
+    std::vector<std::size_t> begin;  ///< Index of the first entry of each row, plus one past the last entry
+    std::vector<int> index;          ///< Column of each entry
+    std::vector<double> value;       ///< Value of each entry
+  };
+  /** Iterate of the PDHG method, with the products with the matrix it is involved in. */
+  struct Iterate {
+    std::vector<double> x;    ///< Primal solution
+    std::vector<double> y;    ///< Dual solution
+    std::vector<double> ax;   ///< Product @f$ A x @f$
+    std::vector<double> aty;  ///< Product @f$ A^T y @f$
+  };
+
+  /**
+   * Compute @f$ M v @f$, splitting the rows of `matrix` among the threads of the `pool`, if any.
+   * @param matrix matrix to multiply
+   * @param v vector to multiply
+   * @param[out] out result of the product
+   * @param pool threads to use, if any
+   */
+  static void Multiply(const Csr& matrix, const std::vector<double>& v, std::vector<double>& out, ThreadPool* pool);
+  /**
+   * Estimate the largest singular value of the scaled matrix with a few rounds of power iteration.
+   * @param pool threads to use, if any
+   * @return estimate of @f$ \|A\|_2 @f$
+   */
+  [[nodiscard]] double EstimateNorm(ThreadPool* pool) const;
+  /**
+   * Compute the relative KKT error of the `iterate` in the scaled problem.
+   * @param iterate iterate to evaluate, with its products
+   * @return largest among the relative primal residual, dual residual and duality gap
+   */
+  [[nodiscard]] double Error(const Iterate& iterate) const;
+
+  Csr a_;                             ///< Scaled constraint matrix
+  Csr at_;                            ///< Transpose of the scaled constraint matrix
+  std::vector<double> column_scale_;  ///< Scaling factor of each column
+  std::vector<double> row_scale_;     ///< Scaling factor of each row
+  std::vector<double> obj_;           ///< Scaled objective coefficients
+  std::vector<double> lb_;            ///< Scaled lower bound of each column, possibly -infinity
+  std::vector<double> ub_;            ///< Scaled upper bound of each column, possibly infinity
+  std::vector<double> row_lb_;        ///< Scaled lower bound of each row, possibly -infinity
+  std::vector<double> row_ub_;        ///< Scaled upper bound of each row, possibly infinity
+  double obj_norm_;                   ///< Euclidean norm of the scaled objective
+  double bound_norm_;                 ///< Euclidean norm of the finite scaled row bounds
+  unsigned int num_threads_;          ///< Maximum number of threads used for the products
+};
+
+std::ostream& operator<<(std::ostream& os, const Pdhg::Result& result);
+
+}  // namespace delpi
+
+#ifdef DELPI_INCLUDE_FMT
+
+#include "delpi/util/logging.h"
+
+OSTREAM_FORMATTER(delpi::Pdhg::Result)
+
+#endif
@@ -9,15 +9,87 @@
 #include <map>
 #include <set>
 #include <span>  // NOLINT(build/include_order): c++20 header
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "delpi/util/error.h"
 #include "delpi/util/logging.h"
 
 namespace delpi {
 
-namespace {}  // namespace
+namespace {
+BasisStatus ToBasisStatus(const char status) {
+  switch (status) {
+    case QS_COL_BSTAT_BASIC:
+      return BasisStatus::BASIC;
+    case QS_COL_BSTAT_LOWER:
+      return BasisStatus::AT_LOWER;
+    case QS_COL_BSTAT_UPPER:
+      return BasisStatus::AT_UPPER;
+    case QS_COL_BSTAT_FREE:
+      return BasisStatus::FREE;
+    default:
+      return BasisStatus::UNDEFINED;
+  }
+}
+/**
+ * Convert the status of the logical variable of a row with the given `sense` to the status of the row.
+ *
+ * The logical variable of a row is always at zero when it is non-basic, where the activity equals the right hand side.
+ * For a 'L' row the right hand side is the upper bound, for a 'G' row the lower bound, and for an 'E' row both.
+ * @param status QSopt_ex status of the logical variable
+ * @param sense sense of the row
+ * @return status of the row, where AT_LOWER means that its activity equals its lower bound
+ */
+BasisStatus ToRowBasisStatus(const char status, const char sense) {
+  switch (status) {
+    case QS_ROW_BSTAT_BASIC:
+      return BasisStatus::BASIC;
+    case QS_ROW_BSTAT_LOWER:
+    case QS_ROW_BSTAT_UPPER:
+      // Rows are never ranged, so the only bound of the logical variable is zero
+      return sense == 'E' ? BasisStatus::FIXED : (sense == 'L' ? BasisStatus::AT_UPPER : BasisStatus::AT_LOWER);
+    default:
+      return BasisStatus::UNDEFINED;
+  }
+}
+char ToQsoptexStatus(const BasisStatus status) {
+  switch (status) {
+    case BasisStatus::BASIC:
+      return QS_COL_BSTAT_BASIC;
+    case BasisStatus::AT_UPPER:
+      return QS_COL_BSTAT_UPPER;
+    case BasisStatus::FREE:
+      return QS_COL_BSTAT_FREE;
+    default:
+      return QS_COL_BSTAT_LOWER;
+  }
+}
+/**
+ * Convert the status of a row to the status of its logical variable.
+ * Whatever side of the row is tight, its logical variable is at its only bound, zero.
+ * @param status status of the row
+ * @return QSopt_ex status of the logical variable
+ */
+char ToQsoptexRowStatus(const BasisStatus status) {
+  return status == BasisStatus::BASIC ? QS_ROW_BSTAT_BASIC : QS_ROW_BSTAT_LOWER;
+}
+std::pair<int, int> QsoptexPricing(const Config::Pricing pricing) {
+  switch (pricing) {
+    case Config::Pricing::DANTZIG:
+      return {QS_PRICE_PDANTZIG, QS_PRICE_DDANTZIG};
+    case Config::Pricing::DEVEX:
+      return {QS_PRICE_PDEVEX, QS_PRICE_DDEVEX};
+    case Config::Pricing::STEEPEST:
+      return {QS_PRICE_PSTEEP, QS_PRICE_DSTEEP};
+    default:
+      DELPI_UNREACHABLE();
+  }
+}
+}  // namespace
 
 extern "C" void QsoptexPartialSolutionCb(mpq_QSdata const* /*prob*/, const mpq_t* x, const mpq_t* const y,
                                          const mpq_t obj_lb, const mpq_t obj_up, const mpq_t diff, const mpq_t delta,
@@ -32,7 +104,7 @@ extern "C" void QsoptexPartialSolutionCb(mpq_QSdata const* /*prob*/, const mpq_t
 }
 
 QsoptexLpSolver::QsoptexLpSolver(Config config, const std::string& class_name)
-    : LpSolver{0, 0, std::move(config), class_name}, qsx_{nullptr}, ray_{0}, x_{0} {
+    : LpSolver{0, 0, std::move(config), class_name}, qsx_{nullptr}, has_basis_{false}, ray_{0}, x_{0} {
   qsopt_ex::QSXStart();
   ninfinity_ = mpq_class{mpq_NINFTY};
   infinity_ = mpq_class{mpq_INFTY};
@@ -42,8 +114,16 @@ QsoptexLpSolver::QsoptexLpSolver(Config config, const std::string& class_name)
   if (config_.verbose_simplex() > 3) {
     DELPI_RUNTIME_ERROR("With --lp-solver qsoptex, maximum value for --verbose-simplex is 3");
   }
-  [[maybe_unused]] const int status = mpq_QSset_param(qsx_, QS_PARAM_SIMPLEX_DISPLAY, config_.verbose_simplex());
+  [[maybe_unused]] int status = mpq_QSset_param(qsx_, QS_PARAM_SIMPLEX_DISPLAY, config_.verbose_simplex());
   DELPI_ASSERT(!status, "Invalid status");
+  // With auto, keep the default pricing of QSopt_ex
+  if (config_.pricing() != Config::Pricing::AUTO) {
+    const auto [primal_pricing, dual_pricing] = QsoptexPricing(config_.pricing());
+    status = mpq_QSset_param(qsx_, QS_PARAM_PRIMAL_PRICING, primal_pricing);
+    DELPI_ASSERT(!status, "Invalid status");
+    status = mpq_QSset_param(qsx_, QS_PARAM_DUAL_PRICING, dual_pricing);
+    DELPI_ASSERT(!status, "Invalid status");
+  }
   DELPI_DEBUG_FMT("QsoptexTheorySolver::QsoptexTheorySolver: precision = {}", config_.precision());
 }
 
@@ -167,7 +247,7 @@ LpSolver::RowIndex QsoptexLpSolver::AddRow(const Expression::Addends& lhs, const
   SetRowCoeff(row_idx, lhs);
   return row_idx;
 }
-void QsoptexLpSolver::SetBound(const Variable var, const mpq_class& lb, const mpq_class& ub) {
+void QsoptexLpSolver::SetBoundCore(const Variable var, const mpq_class& lb, const mpq_class& ub) {
   if (lb == ub) {
     [[maybe_unused]] const int status = mpq_QSchange_bound(qsx_, var_to_col_.at(var), 'B', lb.get_mpq_t());
     DELPI_ASSERT(!status, "Invalid status");
@@ -179,11 +259,44 @@ void QsoptexLpSolver::SetBound(const Variable var, const mpq_class& lb, const mp
   DELPI_ASSERT(!status2, "Invalid status");
 }
 
-void QsoptexLpSolver::SetObjective(int column, const mpq_class& value) {
+void QsoptexLpSolver::SetObjectiveCore(const int column, const mpq_class& value) {
   DELPI_ASSERT_FMT(column < num_columns(), "Column index out of bounds: {} >= {}", column, num_columns());
   [[maybe_unused]] const int status = mpq_QSchange_objcoef(qsx_, column, mpq_class{value}.get_mpq_t());
   DELPI_ASSERT(!status, "Invalid status");
 }
+void QsoptexLpSolver::SetRowBoundCore(const RowIndex row, const mpq_class& lb, const mpq_class& ub) {
+  DELPI_ASSERT(row < num_rows(), "Row index out of bounds");
+  // Each row only has one side in QSopt_ex. Ranged rows are stored as two separate rows
+  const bool has_lb = !mpq_equal(lb.get_mpq_t(), mpq_NINFTY), has_ub = !mpq_equal(ub.get_mpq_t(), mpq_INFTY);
+  char sense;
+  if (has_lb && has_ub && lb == ub) {
+    sense = 'E';
+  } else if (has_lb && !has_ub) {
+    sense = 'G';
+  } else if (has_ub && !has_lb) {
+    sense = 'L';
+  } else {
+    DELPI_RUNTIME_ERROR_FMT("QsoptexLpSolver: row {} can only have one bound, or two equal ones. Got [{}, {}]", row,
+                            lb, ub);
+  }
+  [[maybe_unused]] const int status1 = mpq_QSchange_sense(qsx_, row, sense);
+  DELPI_ASSERT(!status1, "Invalid status");
+  mpq_class rhs{sense == 'L' ? ub : lb};
+  [[maybe_unused]] const int status2 = mpq_QSchange_rhscoef(qsx_, row, rhs.get_mpq_t());
+  DELPI_ASSERT(!status2, "Invalid status");
+}
+
+void QsoptexLpSolver::RemoveRowsCore(const std::span<const RowIndex> rows) {
+  // QSopt_ex keeps the current basis if all the deleted rows have a basic slack
+  std::vector<int> indices{rows.begin(), rows.end()};
+  [[maybe_unused]] const int status = mpq_QSdelete_rows(qsx_, static_cast<int>(indices.size()), indices.data());
+  DELPI_ASSERT(!status, "Invalid status");
+}
+void QsoptexLpSolver::RemoveColumnsCore(const std::span<const ColumnIndex> columns) {
+  std::vector<int> indices{columns.begin(), columns.end()};
+  [[maybe_unused]] const int status = mpq_QSdelete_cols(qsx_, static_cast<int>(indices.size()), indices.data());
+  DELPI_ASSERT(!status, "Invalid status");
+}
 
 LpResult QsoptexLpSolver::SolveCore(mpq_class& precision, const bool store_solution) {
   // x: must be allocated/deallocated using QSopt_ex.
@@ -191,14 +304,32 @@ LpResult QsoptexLpSolver::SolveCore(mpq_class& precision, const bool store_solut
   x_.Resize(num_columns());
   ray_.Resize(num_rows());
 
+  // The primal simplex is the default algorithm, unless the dual one is preferred
+  const int algorithm = NextSimplexAlgorithm() == Config::SimplexAlgorithm::DUAL ? DUAL_SIMPLEX : PRIMAL_SIMPLEX;
+  DELPI_DEBUG_FMT("QsoptexLpSolver::SolveCore: using the {} simplex", algorithm == DUAL_SIMPLEX ? "dual" : "primal");
+
+  // The double and multiple precision stages only start from the basis they are handed.
+  // Pass the current one, so that the warm starts and the basis of the previous solve are not lost
+  QSbasis* const basis = has_basis_ ? mpq_QSget_basis(qsx_) : nullptr;
   int lp_status = -1;
+  profiler_.Enter("simplex");
   const int status = QSdelta_full_solver(qsx_, precision.get_mpq_t(), x_, ray_, obj_lb_.get_mpq_t(),
-                                         obj_ub_.get_mpq_t(), nullptr, PRIMAL_SIMPLEX, &lp_status,
+                                         obj_ub_.get_mpq_t(), basis, algorithm, &lp_status,
                                          config_.continuous_output() ? QsoptexPartialSolutionCb : nullptr, this);
+  if (basis != nullptr) mpq_QSfree_basis(basis);
+  if (profiler_.enabled()) {
+    int primal_phase_1, primal_phase_2, dual_phase_1, dual_phase_2, iterations;
+    if (!mpq_QSget_itcnt(qsx_, &primal_phase_1, &primal_phase_2, &dual_phase_1, &dual_phase_2, &iterations)) {
+      profiler_.Count("iterations", iterations);
+      profiler_.Count("phase_1_iterations", primal_phase_1 + dual_phase_1);
+    }
+  }
+  profiler_.Exit();
   if (status) {
     DELPI_RUNTIME_ERROR_FMT("QSopt_ex returned {}", status);
     return LpResult::ERROR;
   }
+  has_basis_ = true;
 
   DELPI_DEBUG_FMT("DeltaQsoptexTheorySolver::CheckSat: QSopt_ex has returned with precision = {}", precision);
 
@@ -227,6 +358,7 @@ LpResult QsoptexLpSolver::SolveCore(mpq_class& precision, const bool store_solut
 }
 
 void QsoptexLpSolver::UpdateFeasible() {
+  const ProfilerGuard profiler_guard{profiler_, "extract"};
   DELPI_ASSERT(solution_.empty(), "Solution must be empty");
   DELPI_ASSERT(dual_solution_.empty(), "Dual solution must be empty");
   // Set the feasible information
@@ -237,6 +369,34 @@ void QsoptexLpSolver::UpdateFeasible() {
 
   for (int i = 0; i < colcount; i++) solution_.emplace_back(x_[i]);
   for (int i = 0; i < rowcount; i++) dual_solution_.emplace_back(ray_[i]);
+
+  basis_ = CurrentBasis();
+}
+
+Basis QsoptexLpSolver::CurrentBasis() const {
+  Basis basis;
+  // QSopt_ex reports the status of the logical variable of each row, which depends on the sense of the row
+  std::string column_status(num_columns(), '\0'), row_status(num_rows(), '\0'), senses(num_rows(), '\0');
+  if (mpq_QSget_basis_array(qsx_, column_status.data(), row_status.data())) return basis;
+  [[maybe_unused]] const int status = mpq_QSget_senses(qsx_, senses.data());
+  DELPI_ASSERT(!status, "Invalid status");
+  basis.columns.reserve(column_status.size());
+  basis.rows.reserve(row_status.size());
+  for (const char column : column_status) basis.columns.push_back(ToBasisStatus(column));
+  for (std::size_t i = 0; i < row_status.size(); ++i) basis.rows.push_back(ToRowBasisStatus(row_status[i], senses[i]));
+  return basis;
+}
+void QsoptexLpSolver::LoadBasis(const Basis& basis) {
+  DELPI_ASSERT(static_cast<int>(basis.columns.size()) == num_columns(), "The basis must have a status for each column");
+  DELPI_ASSERT(static_cast<int>(basis.rows.size()) == num_rows(), "The basis must have a status for each row");
+  std::string column_status, row_status;
+  column_status.reserve(basis.columns.size());
+  row_status.reserve(basis.rows.size());
+  for (const BasisStatus status : basis.columns) column_status.push_back(ToQsoptexStatus(status));
+  for (const BasisStatus status : basis.rows) row_status.push_back(ToQsoptexRowStatus(status));
+  [[maybe_unused]] const int status = mpq_QSload_basis_array(qsx_, column_status.data(), row_status.data());
+  DELPI_ASSERT(!status, "Invalid status");
+  has_basis_ = true;
 }
 #if 0
 void QsoptexLpSolver::UpdateInfeasible() {
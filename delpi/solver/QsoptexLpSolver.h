@@ -10,6 +10,7 @@
 #error QSopt_ex is not enabled. Please enable it by adding "--//tools:enable_qsoptex" to the bazel command.
 #endif
 
+#include <span>  // NOLINT(build/include_order): c++20 header
 #include <string>
 #include <utility>
 #include <vector>
@@ -39,9 +40,7 @@ class QsoptexLpSolver final : public LpSolver {
   ColumnIndex AddColumn(const Variable& var, const mpq_class& obj, const mpq_class& lb, const mpq_class& ub) override;
   RowIndex AddRow(const std::vector<Expression::Addend>& addends, const mpq_class& lb, const mpq_class& ub) override;
   RowIndex AddRow(const Expression::Addends& lhs, FormulaKind sense, const mpq_class& rhs) override;
-  void SetBound(Variable var, const mpq_class& lb, const mpq_class& ub) override;
   void SetCoefficient(RowIndex row, ColumnIndex column, const mpq_class& value) override;
-  void SetObjective(int column, const mpq_class& value) override;
 
 #ifndef NDEBUG
   void Dump() final;
@@ -49,6 +48,13 @@ class QsoptexLpSolver final : public LpSolver {
 
  private:
   LpResult SolveCore(mpq_class& precision, bool store_solution) override;
+  void RemoveRowsCore(std::span<const RowIndex> rows) override;
+  void RemoveColumnsCore(std::span<const ColumnIndex> columns) override;
+  void SetBoundCore(Variable var, const mpq_class& lb, const mpq_class& ub) override;
+  void SetObjectiveCore(ColumnIndex column, const mpq_class& value) override;
+  void SetRowBoundCore(RowIndex row, const mpq_class& lb, const mpq_class& ub) override;
+  [[nodiscard]] Basis CurrentBasis() const override;
+  void LoadBasis(const Basis& basis) override;
 
   /**
    * Parse a sequence of `literal_monomials` and set the coefficient for each decisional variable appearing in it.
@@ -91,6 +97,7 @@ class QsoptexLpSolver final : public LpSolver {
 
  private:
   mpq_QSprob qsx_;  ///< QSopt_ex LP solver
+  bool has_basis_;  ///< Whether @ref qsx_ holds a basis, loaded with @ref LoadBasis or left by the last solve
 
   qsopt_ex::MpqArray ray_;  ///< Ray of the last infeasible solution
   qsopt_ex::MpqArray x_;    ///< Solution vector
@@ -0,0 +1,344 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/solver/ResultCache.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <ostream>
+#include <sstream>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include "delpi/util/logging.h"
+
+namespace delpi {
+
+namespace {
+
+constexpr std::string_view entry_extension{".delpi"};
+constexpr std::string_view entry_header{"delpi-cache 1"};
+
+/**
+ * 128-bit hash built from two independent 64-bit lanes.
+ * A collision would silently return the result of another model, so a single 64-bit hash is not enough.
+ * The keys are stored on disk, so they only rely on functions with a fixed definition, and never on std::hash,
+ * whose values may change across standard libraries and even across runs.
+ */
+struct Hash128 {
+  std::uint64_t high{0x243f6a8885a308d3};
+  std::uint64_t low{0x13198a2e03707344};
+
+  /**
+   * Mix the value `v` into both lanes.
+   * The value is passed through a finaliser first, so that close values end up far apart.
+   * @param v value to add to the hash
+   */
+  void Add(const std::uint64_t v) {
+    high = Combine(high, Avalanche(v));
+    low = Combine(low, Avalanche(v ^ 0x9e3779b97f4a7c15));
+  }
+  void Add(const Hash128 &o) {
+    Add(o.high);
+    Add(o.low);
+  }
+  void Add(const std::string &s) {
+    Add(s.size());
+    Add(Fnv1a(s));
+  }
+  void Add(const mpz_srcptr z) {
+    Add(static_cast<std::uint64_t>(z->_mp_size));
+    const std::size_t size = mpz_size(z);
+    for (std::size_t i = 0; i < size; ++i) Add(static_cast<std::uint64_t>(mpz_getlimbn(z, i)));
+  }
+  void Add(const mpq_class &q) {
+    Add(q.get_num_mpz_t());
+    Add(q.get_den_mpz_t());
+  }
+  void Add(const std::optional<mpq_class> &q) {
+    Add(static_cast<std::uint64_t>(q.has_value()));
+    if (q.has_value()) Add(*q);
+  }
+
+  [[nodiscard]] std::string ToString() const {
+    std::ostringstream oss;
+    oss << std::hex;
+    oss.width(16);
+    oss.fill('0');
+    oss << high;
+    oss.width(16);
+    oss << low;
+    return oss.str();
+  }
+  auto operator<=>(const Hash128 &) const = default;
+
+ private:
+  /** Same mixing as boost::hash_combine, without going through std::hash. */
+  static std::uint64_t Combine(const std::uint64_t seed, const std::uint64_t v) {
+    return seed ^ (v + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+  }
+  /** 64-bit FNV-1a hash of the bytes of `s`. */
+  static std::uint64_t Fnv1a(const std::string &s) {
+    std::uint64_t h = 0xcbf29ce484222325;
+    for (const char c : s) {
+      h ^= static_cast<unsigned char>(c);
+      h *= 0x100000001b3;
+    }
+    return h;
+  }
+  /** SplitMix64 finaliser. */
+  static std::uint64_t Avalanche(std::uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+    return x ^ (x >> 31);
+  }
+};
+
+void WriteVector(std::ostream &os, const char *const name, const std::vector<mpq_class> &values,
+                 const std::vector<int> &order) {
+  os << name << " " << (values.empty() ? 0 : order.size());
+  if (!values.empty())
+    for (const int idx : order) os << " " << values.at(idx);
+  os << "\n";
+}
+
+void WriteBasis(std::ostream &os, const char *const name, const std::vector<BasisStatus> &values,
+                const std::vector<int> &order) {
+  os << name << " ";
+  if (values.empty()) {
+    os << "-\n";
+    return;
+  }
+  for (const int idx : order) os << toChar(values.at(idx));
+  os << "\n";
+}
+
+/**
+ * Read a rational number from the stream.
+ * Unlike the stream operator of mpq_class, a malformed token or a zero denominator is reported instead of aborting.
+ * @param is stream to read from
+ * @param[out] value number read
+ * @return true if a valid number has been read
+ */
+bool ReadRational(std::istream &is, mpq_class &value) {
+  std::string token;
+  if (!(is >> token) || mpq_set_str(value.get_mpq_t(), token.c_str(), 10) != 0) return false;
+  if (mpz_sgn(value.get_den_mpz_t()) == 0) return false;
+  value.canonicalize();
+  return true;
+}
+
+bool ReadVector(std::istream &is, const char *const name, std::vector<mpq_class> &values,
+                const std::vector<int> &order) {
+  std::string token;
+  std::size_t size;
+  if (!(is >> token >> size) || token != name || (size != 0 && size != order.size())) return false;
+  if (size == 0) return true;
+  values.resize(size);
+  for (const int idx : order) {
+    if (!ReadRational(is, values[idx])) return false;
+  }
+  return true;
+}
+
+bool ReadBasis(std::istream &is, const char *const name, std::vector<BasisStatus> &values,
+               const std::vector<int> &order) {
+  std::string token, statuses;
+  if (!(is >> token >> statuses) || token != name) return false;
+  if (statuses == "-") return true;
+  if (statuses.size() != order.size()) return false;
+  // Only the characters produced by toChar are valid
+  if (statuses.find_first_not_of("?BLUXF") != std::string::npos) return false;
+  values.resize(order.size());
+  for (std::size_t i = 0; i < order.size(); ++i) values[order[i]] = parseBasisStatus(statuses[i]);
+  return true;
+}
+
+}  // namespace
+
+ResultCache::ResultCache(std::filesystem::path directory, const std::uintmax_t max_size)
+    : directory_{std::move(directory)}, max_size_{max_size} {
+  std::error_code ec;
+  std::filesystem::create_directories(directory_, ec);
+  if (ec) DELPI_WARN_FMT("ResultCache: cannot create the directory {}: {}", directory_.string(), ec.message());
+}
+ResultCache::ResultCache(const Config &config)
+    : ResultCache{config.cache_dir(), static_cast<std::uintmax_t>(config.cache_size()) * 1024 * 1024} {}
+
+std::optional<ResultCache::CanonicalModel> ResultCache::Canonicalise(const std::vector<Column> &columns,
+                                                                     const std::vector<Row> &rows,
+                                                                     const Config &config,
+                                                                     const mpq_class &precision) {
+  // Columns are sorted by name, so that the same model with shuffled columns has the same key
+  std::vector<int> column_order(columns.size());
+  std::iota(column_order.begin(), column_order.end(), 0);
+  std::ranges::sort(column_order, [&columns](const int lhs, const int rhs) {
+    return columns[lhs].var.name() < columns[rhs].var.name();
+  });
+  for (std::size_t i = 1; i < column_order.size(); ++i) {
+    if (columns[column_order[i - 1]].var.name() == columns[column_order[i]].var.name()) {
+      DELPI_DEBUG_FMT("ResultCache::Canonicalise: duplicate variable name {}", columns[column_order[i]].var);
+      return std::nullopt;
+    }
+  }
+
+  Hash128 key;
+  key.Add(columns.size());
+  key.Add(rows.size());
+  for (const int idx : column_order) {
+    const Column &column = columns[idx];
+    key.Add(column.var.name());
+    key.Add(column.lb);
+    key.Add(column.ub);
+    key.Add(column.obj);
+  }
+
+  // Rows are sorted by their own hash, which only depends on their content
+  std::vector<std::pair<Hash128, int>> row_hashes;
+  row_hashes.reserve(rows.size());
+  std::vector<const std::pair<Variable, mpq_class> *> addends;
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    const Row &row = rows[i];
+    addends.clear();
+    for (const auto &addend : row.addends) addends.push_back(&addend);
+    std::ranges::sort(addends, [](const auto *lhs, const auto *rhs) { return lhs->first.name() < rhs->first.name(); });
+    Hash128 row_hash;
+    row_hash.Add(row.lb);
+    row_hash.Add(row.ub);
+    row_hash.Add(addends.size());
+    for (const auto *addend : addends) {
+      row_hash.Add(addend->first.name());
+      row_hash.Add(addend->second);
+    }
+    row_hashes.emplace_back(row_hash, static_cast<int>(i));
+  }
+  std::ranges::sort(row_hashes);
+
+  // Options that may change the outcome of the solve
+  key.Add(static_cast<std::size_t>(config.lp_solver()));
+  key.Add(static_cast<std::size_t>(config.actual_lp_mode()));
+  key.Add(precision);
+
+  CanonicalModel model;
+  model.columns = std::move(column_order);
+  model.rows.reserve(row_hashes.size());
+  for (const auto &[row_hash, idx] : row_hashes) {
+    key.Add(row_hash);
+    model.rows.push_back(idx);
+  }
+  model.key = key.ToString();
+  return model;
+}
+
+std::optional<ResultCache::Entry> ResultCache::Load(const CanonicalModel &model) const {
+  const std::filesystem::path path{EntryPath(model.key)};
+  std::ifstream in{path};
+  if (!in.good()) return std::nullopt;
+
+  Entry entry;
+  std::string line, token;
+  std::size_t num_columns, num_rows;
+  int result;
+  std::getline(in, line);
+  const bool valid = line == entry_header && (in >> token >> num_columns >> num_rows) && token == "size" &&
+                     num_columns == model.columns.size() && num_rows == model.rows.size() &&
+                     (in >> token >> result) && token == "result" && (in >> token) && token == "precision" &&
+                     ReadRational(in, entry.precision) && (in >> token) && token == "objective" &&
+                     ReadRational(in, entry.obj_lb) && ReadRational(in, entry.obj_ub) &&
+                     ReadVector(in, "primal", entry.solution, model.columns) &&
+                     ReadVector(in, "dual", entry.dual_solution, model.rows) &&
+                     ReadBasis(in, "basis-columns", entry.basis.columns, model.columns) &&
+                     ReadBasis(in, "basis-rows", entry.basis.rows, model.rows);
+  if (!valid || result < static_cast<int>(LpResult::UNSOLVED) || result > static_cast<int>(LpResult::ERROR)) {
+    DELPI_WARN_FMT("ResultCache: ignoring corrupted entry {}", path.string());
+    return std::nullopt;
+  }
+  entry.result = static_cast<LpResult>(result);
+
+  // Mark the entry as recently used
+  std::error_code ec;
+  std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+  DELPI_DEBUG_FMT("ResultCache::Load: hit {}", model.key);
+  return entry;
+}
+
+bool ResultCache::Store(const CanonicalModel &model, const Entry &entry) const {
+  if (!entry.solution.empty() && entry.solution.size() != model.columns.size()) return false;
+  if (!entry.dual_solution.empty() && entry.dual_solution.size() != model.rows.size()) return false;
+  if (!entry.basis.columns.empty() && entry.basis.columns.size() != model.columns.size()) return false;
+  if (!entry.basis.rows.empty() && entry.basis.rows.size() != model.rows.size()) return false;
+
+  const std::filesystem::path path{EntryPath(model.key)};
+  // Write to a temporary file first, so that concurrent readers never see a partial entry
+  std::filesystem::path tmp_path{path};
+  tmp_path += fmt::format(".{}.tmp", std::hash<std::thread::id>{}(std::this_thread::get_id()));
+  {
+    std::ofstream out{tmp_path};
+    if (!out.good()) {
+      DELPI_WARN_FMT("ResultCache: cannot write {}", tmp_path.string());
+      return false;
+    }
+    out << entry_header << "\n"
+        << "size " << model.columns.size() << " " << model.rows.size() << "\n"
+        << "result " << static_cast<int>(entry.result) << "\n"
+        << "precision " << entry.precision << "\n"
+        << "objective " << entry.obj_lb << " " << entry.obj_ub << "\n";
+    WriteVector(out, "primal", entry.solution, model.columns);
+    WriteVector(out, "dual", entry.dual_solution, model.rows);
+    WriteBasis(out, "basis-columns", entry.basis.columns, model.columns);
+    WriteBasis(out, "basis-rows", entry.basis.rows, model.rows);
+  }
+  std::error_code ec;
+  std::filesystem::rename(tmp_path, path, ec);
+  if (ec) {
+    DELPI_WARN_FMT("ResultCache: cannot store {}: {}", path.string(), ec.message());
+    std::filesystem::remove(tmp_path, ec);
+    return false;
+  }
+  DELPI_DEBUG_FMT("ResultCache::Store: stored {}", model.key);
+  Evict();
+  return true;
+}
+
+void ResultCache::Evict() const {
+  if (max_size_ == 0) return;
+  std::error_code ec;
+  std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::directory_entry>> entries;
+  std::uintmax_t total_size = 0;
+  for (const std::filesystem::directory_entry &file : std::filesystem::directory_iterator{directory_, ec}) {
+    if (!file.is_regular_file(ec) || file.path().extension() != entry_extension) continue;
+    total_size += file.file_size(ec);
+    entries.emplace_back(file.last_write_time(ec), file);
+  }
+  if (total_size <= max_size_) return;
+
+  // Least recently used first
+  std::ranges::sort(entries, [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+  for (const auto &[time, file] : entries) {
+    if (total_size <= max_size_) break;
+    const std::uintmax_t size = file.file_size(ec);
+    if (std::filesystem::remove(file.path(), ec)) {
+      total_size -= std::min(size, total_size);
+      DELPI_DEBUG_FMT("ResultCache::Evict: removed {}", file.path().string());
+    }
+  }
+}
+
+std::filesystem::path ResultCache::EntryPath(const std::string &key) const {
+  std::filesystem::path path{directory_ / key};
+  path += entry_extension;
+  return path;
+}
+
+std::ostream &operator<<(std::ostream &os, const ResultCache &cache) {
+  return os << "ResultCache{directory: " << cache.directory().string() << ", max_size: " << cache.max_size() << "}";
+}
+
+}  // namespace delpi
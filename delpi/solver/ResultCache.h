@@ -0,0 +1,126 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * ResultCache class.
+ */
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "delpi/libs/gmp.h"
+#include "delpi/solver/Basis.h"
+#include "delpi/solver/Column.h"
+#include "delpi/solver/LpResult.h"
+#include "delpi/solver/Row.h"
+#include "delpi/util/Config.h"
+
+namespace delpi {
+
+/**
+ * On-disk, content-addressed cache of LP results.
+ *
+ * Each model is reduced to a canonical form that does not depend on the order of its rows and columns,
+ * which is hashed alongside the solver options that may influence the result.
+ * The hash is the name of the file containing the result, the objective bounds, the primal and dual solutions
+ * and the basis, all stored in canonical order.
+ * When the total size of the cache exceeds the limit, the least recently used entries are evicted.
+ * @note Columns are identified by the name of their variable, so models with duplicate names are never cached.
+ */
+class ResultCache {
+ public:
+  /** Outcome of a solve, as stored in the cache. */
+  struct Entry {
+    LpResult result{LpResult::UNSOLVED};   ///< Result of the LP solver
+    mpq_class precision;                   ///< Precision actually achieved by the LP solver
+    mpq_class obj_lb;                      ///< Lower bound on the objective value
+    mpq_class obj_ub;                      ///< Upper bound on the objective value
+    std::vector<mpq_class> solution;       ///< Primal solution, indexed by column
+    std::vector<mpq_class> dual_solution;  ///< Dual solution, indexed by row
+    Basis basis;                           ///< Final basis, if the LP solver produced one
+  };
+  /** Model reduced to its canonical form. */
+  struct CanonicalModel {
+    std::string key;           ///< Hexadecimal hash of the model and the solver options
+    std::vector<int> columns;  ///< Column index in the model of each canonical column
+    std::vector<int> rows;     ///< Row index in the model of each canonical row
+  };
+
+  /**
+   * Construct a new ResultCache object storing the entries in `directory`.
+   * @param directory directory containing the cache entries. It is created if it does not exist
+   * @param max_size maximum size of the cache in bytes. 0 means unbounded
+   */
+  ResultCache(std::filesystem::path directory, std::uintmax_t max_size);
+  /**
+   * Construct a new ResultCache object using the @ref Config::cache_dir and @ref Config::cache_size parameters.
+   * @param config configuration to use
+   */
+  explicit ResultCache(const Config &config);
+
+  /**
+   * Reduce the model to its canonical form.
+   * @param columns all the columns of the model
+   * @param rows all the rows of the model
+   * @param config configuration of the LP solver. The options affecting the result are part of the key
+   * @param precision precision requested to the LP solver
+   * @return canonical form of the model
+   * @return std::nullopt if the model cannot be cached
+   */
+  [[nodiscard]] static std::optional<CanonicalModel> Canonicalise(const std::vector<Column> &columns,
+                                                                  const std::vector<Row> &rows, const Config &config,
+                                                                  const mpq_class &precision);
+
+  /**
+   * Look up the entry corresponding to the `model`.
+   *
+   * A hit marks the entry as recently used.
+   * @param model canonical form of the model
+   * @return cached entry, with the vectors indexed by the columns and rows of the model
+   * @return std::nullopt if the entry is missing or unreadable
+   */
+  [[nodiscard]] std::optional<Entry> Load(const CanonicalModel &model) const;
+  /**
+   * Store the `entry` corresponding to the `model`, evicting older entries if the cache becomes too large.
+   * @param model canonical form of the model
+   * @param entry entry to store, with the vectors indexed by the columns and rows of the model
+   * @return true if the entry has been stored
+   * @return false if the entry could not be stored
+   */
+  bool Store(const CanonicalModel &model, const Entry &entry) const;
+  /** Remove the least recently used entries until the size of the cache is below the limit. */
+  void Evict() const;
+
+  /** @getter{directory containing the entries, cache} */
+  [[nodiscard]] const std::filesystem::path &directory() const { return directory_; }
+  /** @getter{maximum size in bytes, cache} */
+  [[nodiscard]] std::uintmax_t max_size() const { return max_size_; }
+
+ private:
+  /**
+   * Path of the file containing the entry with the given `key`.
+   * @param key key of the entry
+   * @return path of the entry
+   */
+  [[nodiscard]] std::filesystem::path EntryPath(const std::string &key) const;
+
+  std::filesystem::path directory_;  ///< Directory containing the cache entries
+  std::uintmax_t max_size_;          ///< Maximum size of the cache in bytes. 0 means unbounded
+};
+
+std::ostream &operator<<(std::ostream &os, const ResultCache &cache);
+
+}  // namespace delpi
+
+#ifdef DELPI_INCLUDE_FMT
+
+#include "delpi/util/logging.h"
+
+OSTREAM_FORMATTER(delpi::ResultCache)
+
+#endif
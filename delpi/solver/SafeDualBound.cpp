@@ -0,0 +1,115 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/solver/SafeDualBound.h"
+
+#include <cmath>
+#include <limits>
+
+#include "delpi/util/error.h"
+#include "delpi/util/logging.h"
+
+namespace delpi {
+
+namespace {
+
+/**
+ * Compute @f$ \min d x @f$ over @f$ d_{lb} \le d \le d_{ub} @f$ and @f$ lb \le x \le ub @f$.
+ *
+ * The minimum of a bilinear function over a box is attained at one of its corners.
+ * @param d_lb lower bound on the coefficient
+ * @param d_ub upper bound on the coefficient
+ * @param lb lower bound on the variable, if any
+ * @param ub upper bound on the variable, if any
+ * @return minimum of the product
+ * @return std::nullopt if the product is unbounded from below
+ */
+std::optional<mpq_class> MinProduct(const mpq_class& d_lb, const mpq_class& d_ub, const std::optional<mpq_class>& lb,
+                                    const std::optional<mpq_class>& ub) {
+  if ((d_lb < 0 && !ub.has_value()) || (d_ub > 0 && !lb.has_value())) return std::nullopt;
+  std::optional<mpq_class> min;
+  for (const std::optional<mpq_class>* const bound : {&lb, &ub}) {
+    if (!bound->has_value()) continue;
+    for (const mpq_class* const d : {&d_lb, &d_ub}) {
+      mpq_class product{*d * **bound};
+      if (!min.has_value() || product < *min) min = std::move(product);
+    }
+  }
+  // A free variable can only get here if its reduced cost is exactly zero
+  return min.has_value() ? std::move(min) : mpq_class{0};
+}
+
+}  // namespace
+
+SafeDualBound::SafeDualBound(const std::vector<Column>& columns, const std::vector<Row>& rows,
+                             const std::unordered_map<Variable, int>& var_to_col)
+    : columns_{columns}, rows_{rows}, column_start_(columns.size() + 1, 0), finite_{true} {
+  for (const Row& row : rows_) {
+    for (const auto& [var, coeff] : row.addends) ++column_start_[var_to_col.at(var) + 1];
+  }
+  for (std::size_t j = 0; j < columns_.size(); ++j) column_start_[j + 1] += column_start_[j];
+  row_index_.resize(column_start_.back());
+  values_.resize(column_start_.back());
+  std::vector<int> next{column_start_.begin(), column_start_.end() - 1};
+  for (int i = 0; i < static_cast<int>(rows_.size()); ++i) {
+    for (const auto& [var, coeff] : rows_[i].addends) {
+      const int k = next[var_to_col.at(var)]++;
+      row_index_[k] = i;
+      values_[k] = coeff.get_d();
+      finite_ = finite_ && std::isfinite(values_[k]);
+    }
+  }
+  objective_.reserve(columns_.size());
+  for (const Column& column : columns_) {
+    objective_.push_back(column.obj.has_value() ? column.obj->get_d() : 0.0);
+    finite_ = finite_ && std::isfinite(objective_.back());
+  }
+}
+
+std::optional<mpq_class> SafeDualBound::LowerBound(const std::span<const double> dual) const {
+  DELPI_ASSERT(dual.size() == rows_.size(), "The dual solution must have a value for each row");
+  if (!finite_) return std::nullopt;
+
+  // Project the duals onto the signs allowed by the row bounds and add their contribution
+  std::vector<double> y{dual.begin(), dual.end()};
+  mpq_class bound{0};
+  for (std::size_t i = 0; i < y.size(); ++i) {
+    if (!std::isfinite(y[i])) return std::nullopt;
+    if ((y[i] > 0 && !rows_[i].lb.has_value()) || (y[i] < 0 && !rows_[i].ub.has_value())) y[i] = 0;
+    if (y[i] != 0) bound += mpq_class{y[i]} * (y[i] > 0 ? *rows_[i].lb : *rows_[i].ub);
+  }
+
+  // Reduced costs d = c - A^T y. The loop over each column is branch-free, so that it can be vectorised.
+  // Each coefficient has a relative error of at most eps once converted to double, and the dot product of k terms
+  // adds at most k * eps / 2 times the sum of the absolute values of the terms, plus the underflow of each product.
+  // The bound used below more than covers both, including the rounding in the computation of the bound itself
+  constexpr double eps = std::numeric_limits<double>::epsilon();
+  constexpr double tiny = std::numeric_limits<double>::denorm_min();
+  for (std::size_t j = 0; j < columns_.size(); ++j) {
+    double d = objective_[j], magnitude = std::abs(objective_[j]), nonzero_terms = objective_[j] != 0;
+    for (int k = column_start_[j]; k < column_start_[j + 1]; ++k) {
+      const double y_i = y[row_index_[k]];
+      const double term = values_[k] * y_i;
+      d -= term;
+      magnitude += std::abs(term);
+      nonzero_terms += y_i != 0;
+    }
+    const double length = column_start_[j + 1] - column_start_[j] + 2;
+    const double error = 2 * length * eps * magnitude + nonzero_terms * tiny;
+    if (!std::isfinite(d) || !std::isfinite(error)) return std::nullopt;
+
+    const mpq_class d_mid{d}, d_error{error};
+    const std::optional<mpq_class> contribution{
+        MinProduct(d_mid - d_error, d_mid + d_error, columns_[j].lb, columns_[j].ub)};
+    if (!contribution.has_value()) {
+      DELPI_TRACE_FMT("SafeDualBound::LowerBound: column {} makes the bound unbounded", j);
+      return std::nullopt;
+    }
+    bound += *contribution;
+  }
+  return bound;
+}
+
+}  // namespace delpi
@@ -0,0 +1,67 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * SafeDualBound class.
+ */
+#pragma once
+
+#include <optional>
+#include <span>  // NOLINT(build/include_order): c++20 header
+#include <unordered_map>
+#include <vector>
+
+#include "delpi/libs/gmp.h"
+#include "delpi/solver/Column.h"
+#include "delpi/solver/Row.h"
+#include "delpi/symbolic/Variable.h"
+
+namespace delpi {
+
+/**
+ * Rigorous lower bound on the optimal objective value from an approximate dual solution,
+ * in the style of Neumaier and Shcherbina.
+ *
+ * By weak duality, for any dual vector @f$ y @f$ the optimum of @f$ \min c^T x @f$
+ * s.t. @f$ l_r \le A x \le u_r @f$, @f$ l_c \le x \le u_c @f$ is at least
+ * @f[
+ * \sum_i \min(y_i l_{r,i}, y_i u_{r,i}) + \sum_j \min_{l_{c,j} \le x_j \le u_{c,j}} d_j x_j,
+ * \quad d = c - A^T y.
+ * @f]
+ * The reduced costs @f$ d @f$ are computed in floating point over the matrix stored in CSC format,
+ * then enclosed in an interval using an a priori bound on the rounding error of the dot products.
+ * The final sum is carried out in rational arithmetic, so the bound is valid no matter how inaccurate the duals are.
+ * It is finite only if each column whose reduced cost may be negative (positive) has a finite upper (lower) bound.
+ */
+class SafeDualBound {
+ public:
+  /**
+   * Construct a new SafeDualBound object for the given problem.
+   * @param columns columns of the problem
+   * @param rows rows of the problem
+   * @param var_to_col map from the variables to the index of their column
+   */
+  SafeDualBound(const std::vector<Column>& columns, const std::vector<Row>& rows,
+                const std::unordered_map<Variable, int>& var_to_col);
+
+  /**
+   * Compute a lower bound on the optimal objective value using the approximate `dual` solution.
+   *
+   * Dual values whose sign is not compatible with the bounds of their row are treated as zero.
+   * @param dual approximate dual value of each row
+   * @return lower bound on the optimal objective value
+   * @return std::nullopt if the bound is @f$ -\infty @f$ or cannot be computed in floating point
+   */
+  [[nodiscard]] std::optional<mpq_class> LowerBound(std::span<const double> dual) const;
+
+ private:
+  const std::vector<Column>& columns_;  ///< Columns of the problem
+  const std::vector<Row>& rows_;        ///< Rows of the problem
+  std::vector<int> column_start_;       ///< Index of the first coefficient of each column. Has one extra element
+  std::vector<int> row_index_;          ///< Row of each coefficient
+  std::vector<double> values_;          ///< Coefficients of the matrix, converted to double
+  std::vector<double> objective_;       ///< Objective coefficients, converted to double
+  bool finite_;                         ///< Whether all the coefficients are finite when converted to double
+};
+
+}  // namespace delpi
@@ -0,0 +1,187 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/solver/Scaling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <utility>
+
+#include "delpi/util/error.h"
+#include "delpi/util/logging.h"
+
+namespace delpi {
+
+namespace {
+
+constexpr int max_passes = 8;                 ///< Maximum number of geometric mean passes
+constexpr double min_spread_decrease = 0.95;  ///< The passes stop when the spread decreases by less than 5%
+constexpr double inf = std::numeric_limits<double>::infinity();  ///< Infinity
+
+/**
+ * Base 2 logarithm of the magnitude of a non-zero rational number.
+ * Numerator and denominator are converted separately, so the result is finite even when the number is not
+ * representable as a double.
+ * @param value non-zero rational number
+ * @return @f$ \log_2 |value| @f$
+ */
+double Log2(const mpq_class& value) {
+  long num_exp, den_exp;  // NOLINT(runtime/int): GMP API
+  const double num = mpz_get_d_2exp(&num_exp, value.get_num_mpz_t());
+  const double den = mpz_get_d_2exp(&den_exp, value.get_den_mpz_t());
+  return std::log2(std::abs(num)) - std::log2(den) + static_cast<double>(num_exp - den_exp);
+}
+
+/**
+ * Multiply `value` by @f$ 2^{exp} @f$, only shifting its numerator or denominator.
+ * @param value rational number
+ * @param exp exponent of the power of two
+ * @return scaled number
+ */
+mpq_class Shift(const mpq_class& value, const int exp) {
+  mpq_class result;
+  if (exp >= 0) {
+    mpq_mul_2exp(result.get_mpq_t(), value.get_mpq_t(), static_cast<mp_bitcnt_t>(exp));
+  } else {
+    mpq_div_2exp(result.get_mpq_t(), value.get_mpq_t(), static_cast<mp_bitcnt_t>(-exp));
+  }
+  return result;
+}
+
+/**
+ * Multiply the bound, if any, by @f$ 2^{exp} @f$.
+ * @param bound bound of a row or column
+ * @param exp exponent of the power of two
+ * @return scaled bound
+ */
+std::optional<mpq_class> Shift(const std::optional<mpq_class>& bound, const int exp) {
+  if (!bound.has_value()) return std::nullopt;
+  return Shift(*bound, exp);
+}
+
+}  // namespace
+
+Scaling::Scaling(const std::vector<Column>& columns, const std::vector<Row>& rows,
+                 const std::unordered_map<Variable, int>& var_to_col)
+    : column_exponents_(columns.size(), 0), row_exponents_(rows.size(), 0), passes_{0}, precision_exponent_{0} {
+  ComputeExponents(columns, rows, var_to_col);
+
+  columns_.reserve(columns.size());
+  for (std::size_t j = 0; j < columns.size(); ++j) {
+    const Column& column = columns[j];
+    const int exp = column_exponents_[j];
+    columns_.push_back(Column{column.var, Shift(column.lb, -exp), Shift(column.ub, -exp), Shift(column.obj, exp)});
+    precision_exponent_ = std::max(precision_exponent_, exp);
+  }
+  rows_.reserve(rows.size());
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    const Row& row = rows[i];
+    const int exp = row_exponents_[i];
+    Row& scaled = rows_.emplace_back(Row{{}, Shift(row.lb, exp), Shift(row.ub, exp)});
+    scaled.addends.reserve(row.addends.size());
+    for (const auto& [var, coeff] : row.addends) {
+      scaled.addends.emplace_back(var, Shift(coeff, exp + column_exponents_[var_to_col.at(var)]));
+    }
+    precision_exponent_ = std::max(precision_exponent_, -exp);
+  }
+  DELPI_DEBUG_FMT("Scaling::Scaling: {}x{} problem scaled in {} passes, precision exponent {}", rows.size(),
+                  columns.size(), passes_, precision_exponent_);
+}
+
+void Scaling::ComputeExponents(const std::vector<Column>& columns, const std::vector<Row>& rows,
+                               const std::unordered_map<Variable, int>& var_to_col) {
+  // Work with the base 2 logarithm of the magnitude of each non-zero entry
+  struct Entry {
+    int row;     ///< Row of the entry
+    int column;  ///< Column of the entry
+    double log;  ///< Base 2 logarithm of the magnitude of the entry
+  };
+  std::vector<Entry> entries;
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    for (const auto& [var, coeff] : rows[i].addends) {
+      if (coeff != 0) entries.push_back({static_cast<int>(i), var_to_col.at(var), Log2(coeff)});
+    }
+  }
+  if (entries.empty()) return;
+
+  std::vector<double> row_exp(rows.size(), 0), col_exp(columns.size(), 0);
+  // Spread of the magnitudes of the scaled entries, as the difference between the largest and smallest logarithm
+  const auto spread = [&]() {
+    double min = inf, max = -inf;
+    for (const auto& [i, j, log] : entries) {
+      min = std::min(min, log + row_exp[i] + col_exp[j]);
+      max = std::max(max, log + row_exp[i] + col_exp[j]);
+    }
+    return max - min;
+  };
+  // Set each exponent so that the geometric mean of the largest and smallest entry of the row or column becomes 1
+  const auto geometric_pass = [&entries](std::vector<double>& exps, const std::vector<double>& other_exps,
+                                         const bool by_row) {
+    std::vector<double> min(exps.size(), inf), max(exps.size(), -inf);
+    for (const auto& [i, j, log] : entries) {
+      const int k = by_row ? i : j;
+      const double value = log + other_exps[by_row ? j : i];
+      min[k] = std::min(min[k], value);
+      max[k] = std::max(max[k], value);
+    }
+    for (std::size_t k = 0; k < exps.size(); ++k) {
+      if (min[k] != inf) exps[k] = -(min[k] + max[k]) / 2;
+    }
+  };
+
+  double current_spread = spread();
+  while (passes_ < max_passes) {
+    const std::vector<double> previous_row_exp{row_exp}, previous_col_exp{col_exp};
+    geometric_pass(row_exp, col_exp, true);
+    geometric_pass(col_exp, row_exp, false);
+    ++passes_;
+    const double new_spread = spread();
+    if (new_spread > current_spread) {
+      row_exp = previous_row_exp;
+      col_exp = previous_col_exp;
+      break;
+    }
+    if (new_spread > min_spread_decrease * current_spread) break;
+    current_spread = new_spread;
+  }
+
+  // Round the row exponents, then equilibrate the columns so that their largest entry lies in [1, 2)
+  for (std::size_t i = 0; i < rows.size(); ++i) row_exponents_[i] = static_cast<int>(std::lround(row_exp[i]));
+  std::vector<double> col_max(columns.size(), -inf);
+  for (const auto& [i, j, log] : entries) col_max[j] = std::max(col_max[j], log + row_exponents_[i]);
+  for (std::size_t j = 0; j < columns.size(); ++j) {
+    if (col_max[j] != -inf) column_exponents_[j] = -static_cast<int>(std::floor(col_max[j]));
+  }
+}
+
+std::vector<mpq_class> Scaling::PrimalSolution(const std::span<const mpq_class> solution) const {
+  DELPI_ASSERT(solution.size() == column_exponents_.size(), "The solution must have a value for each column");
+  std::vector<mpq_class> primal_solution;
+  primal_solution.reserve(solution.size());
+  for (std::size_t j = 0; j < solution.size(); ++j) primal_solution.push_back(Shift(solution[j], column_exponents_[j]));
+  return primal_solution;
+}
+
+std::vector<mpq_class> Scaling::DualSolution(const std::span<const mpq_class> dual_solution) const {
+  DELPI_ASSERT(dual_solution.size() == row_exponents_.size(), "The dual solution must have a value for each row");
+  std::vector<mpq_class> original_dual_solution;
+  original_dual_solution.reserve(dual_solution.size());
+  for (std::size_t i = 0; i < dual_solution.size(); ++i) {
+    original_dual_solution.push_back(Shift(dual_solution[i], row_exponents_[i]));
+  }
+  return original_dual_solution;
+}
+
+mpq_class Scaling::ScaledPrecision(const mpq_class& precision) const { return Shift(precision, -precision_exponent_); }
+mpq_class Scaling::OriginalPrecision(const mpq_class& precision) const { return Shift(precision, precision_exponent_); }
+
+bool Scaling::identity() const {
+  return std::ranges::all_of(column_exponents_, [](const int exp) { return exp == 0; }) &&
+         std::ranges::all_of(row_exponents_, [](const int exp) { return exp == 0; });
+}
+
+}  // namespace delpi
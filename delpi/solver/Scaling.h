@@ -0,0 +1,113 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * Scaling class.
+ */
+#pragma once
+
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "delpi/libs/gmp.h"
+#include "delpi/solver/Column.h"
+#include "delpi/solver/Row.h"
+#include "delpi/symbolic/Variable.h"
+
+namespace delpi {
+
+/**
+ * Exact scaling of an LP problem by powers of two, with the maps to bring its solutions back to the original problem.
+ *
+ * Each row @f$ i @f$ is multiplied by @f$ 2^{\rho_i} @f$ and each column @f$ j @f$ by @f$ 2^{\gamma_j} @f$,
+ * so that @f$ a'_{ij} = 2^{\rho_i + \gamma_j} a_{ij} @f$.
+ * The exponents are first set by a few passes of geometric mean scaling,
+ * which bring the largest and smallest entry of each row, then of each column, around 1,
+ * and are then rounded so that the largest entry of each column lies in @f$ [1, 2) @f$.
+ * The bounds of the rows are multiplied by @f$ 2^{\rho_i} @f$, while the ones of the columns are divided by
+ * @f$ 2^{\gamma_j} @f$ and their objective coefficients are multiplied by it,
+ * so the objective value of corresponding solutions is the same.
+ *
+ * Since multiplying a rational number by a power of two only shifts its numerator or denominator,
+ * the scaled problem is exactly equivalent to the original one and its numbers do not grow in size.
+ * The primal solution of the original problem is @f$ x_j = 2^{\gamma_j} x'_j @f$,
+ * while its dual solution is @f$ y_i = 2^{\rho_i} y'_i @f$. The basis is the same.
+ */
+class Scaling {
+ public:
+  /**
+   * Compute the scaling of the problem with the given `columns` and `rows`.
+   * @param columns columns of the problem
+   * @param rows rows of the problem
+   * @param var_to_col map from the variables to the index of their column
+   */
+  Scaling(const std::vector<Column>& columns, const std::vector<Row>& rows,
+          const std::unordered_map<Variable, int>& var_to_col);
+
+  /**
+   * Map the solution of the scaled problem to the solution of the original problem.
+   * @param solution value of each column of the scaled problem
+   * @return value of each column of the original problem
+   */
+  [[nodiscard]] std::vector<mpq_class> PrimalSolution(std::span<const mpq_class> solution) const;
+  /**
+   * Map the dual solution of the scaled problem to the dual solution of the original problem.
+   * @param dual_solution dual value of each row of the scaled problem
+   * @return dual value of each row of the original problem
+   */
+  [[nodiscard]] std::vector<mpq_class> DualSolution(std::span<const mpq_class> dual_solution) const;
+  /**
+   * Map the `precision` requested for the original problem to the one to request for the scaled problem.
+   *
+   * A violation of @f$ \delta @f$ in the scaled problem is a violation of at most @f$ 2^e \delta @f$
+   * in the original one, where @f$ e @f$ is @ref precision_exponent.
+   * @param precision precision for the original problem
+   * @return precision for the scaled problem
+   */
+  [[nodiscard]] mpq_class ScaledPrecision(const mpq_class& precision) const;
+  /**
+   * Map the `precision` achieved on the scaled problem to the one guaranteed on the original problem.
+   * @param precision precision achieved on the scaled problem
+   * @return precision guaranteed on the original problem
+   */
+  [[nodiscard]] mpq_class OriginalPrecision(const mpq_class& precision) const;
+
+  /** @getter{columns, scaled problem} */
+  [[nodiscard]] const std::vector<Column>& columns() const { return columns_; }
+  /** @getter{rows, scaled problem} */
+  [[nodiscard]] const std::vector<Row>& rows() const { return rows_; }
+  /** @getter{exponent of the power of two each column is multiplied by, scaling} */
+  [[nodiscard]] const std::vector<int>& column_exponents() const { return column_exponents_; }
+  /** @getter{exponent of the power of two each row is multiplied by, scaling} */
+  [[nodiscard]] const std::vector<int>& row_exponents() const { return row_exponents_; }
+  /** @getter{number of geometric mean passes performed, scaling} */
+  [[nodiscard]] int passes() const { return passes_; }
+  /** @getter{exponent of the largest ratio between the violations of the two problems, scaling} */
+  [[nodiscard]] int precision_exponent() const { return precision_exponent_; }
+  /**
+   * Whether all the scale factors are 1, so the scaled problem is the original one.
+   * @return true if nothing is scaled
+   * @return false if at least one row or column is scaled
+   */
+  [[nodiscard]] bool identity() const;
+
+ private:
+  /**
+   * Compute the exponents of the scale factors from the magnitude of the non-zero entries of the matrix.
+   * @param columns columns of the problem
+   * @param rows rows of the problem
+   * @param var_to_col map from the variables to the index of their column
+   */
+  void ComputeExponents(const std::vector<Column>& columns, const std::vector<Row>& rows,
+                        const std::unordered_map<Variable, int>& var_to_col);
+
+  std::vector<Column> columns_;        ///< Columns of the scaled problem
+  std::vector<Row> rows_;              ///< Rows of the scaled problem
+  std::vector<int> column_exponents_;  ///< Exponent of the scale factor of each column
+  std::vector<int> row_exponents_;     ///< Exponent of the scale factor of each row
+  int passes_;                         ///< Number of geometric mean passes
+  int precision_exponent_;             ///< Exponent of the largest ratio between the violations
+};
+
+}  // namespace delpi
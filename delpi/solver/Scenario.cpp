@@ -0,0 +1,41 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/solver/Scenario.h"
+
+#include <ostream>
+
+namespace delpi {
+
+std::ostream& operator<<(std::ostream& os, const Scenario::Bounds& bounds) {
+  os << bounds.index << " in [ ";
+  if (bounds.lb.has_value()) {
+    os << bounds.lb.value();
+  } else {
+    os << "-inf";
+  }
+  os << " , ";
+  if (bounds.ub.has_value()) {
+    os << bounds.ub.value();
+  } else {
+    os << "inf";
+  }
+  return os << " ]";
+}
+
+std::ostream& operator<<(std::ostream& os, const Scenario& scenario) {
+  os << "Scenario{ " << scenario.name << ", rows: [ ";
+  for (const Scenario::Bounds& bounds : scenario.rows) os << bounds << ", ";
+  os << "], columns: [ ";
+  for (const Scenario::Bounds& bounds : scenario.columns) os << bounds << ", ";
+  return os << "] }";
+}
+
+std::ostream& operator<<(std::ostream& os, const ScenarioResult& result) {
+  return os << "ScenarioResult{ " << result.name << ", " << result.result << ", precision: " << result.precision
+            << ", objective in [ " << result.obj_lb << " , " << result.obj_ub << " ] }";
+}
+
+}  // namespace delpi
@@ -0,0 +1,60 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * Scenario and ScenarioResult structs.
+ */
+#pragma once
+
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "delpi/libs/gmp.h"
+#include "delpi/solver/LpResult.h"
+
+namespace delpi {
+
+/**
+ * Variant of an LP problem that shares its constraint matrix and objective,
+ * but changes the bounds of some of its rows and columns.
+ */
+struct Scenario {
+  /** New bounds of a row or column. */
+  struct Bounds {
+    int index;                    ///< Index of the row or column
+    std::optional<mpq_class> lb;  ///< Lower bound. If `std::nullopt`, indicates unboundedness
+    std::optional<mpq_class> ub;  ///< Upper bound. If `std::nullopt`, indicates unboundedness
+  };
+
+  std::string name;             ///< Name of the scenario
+  std::vector<Bounds> rows;     ///< Rows whose bounds differ from the ones of the base problem
+  std::vector<Bounds> columns;  ///< Columns whose bounds differ from the ones of the base problem
+};
+
+/** Outcome of the optimisation of a Scenario. */
+struct ScenarioResult {
+  std::string name;                 ///< Name of the scenario
+  LpResult result;                  ///< Result of the LP solver
+  mpq_class precision;              ///< Actual precision achieved
+  mpq_class obj_lb;                 ///< Lower bound on the objective value
+  mpq_class obj_ub;                 ///< Upper bound on the objective value
+  std::vector<mpq_class> solution;  ///< Primal solution, if requested and the scenario is feasible
+};
+
+std::ostream& operator<<(std::ostream& os, const Scenario::Bounds& bounds);
+std::ostream& operator<<(std::ostream& os, const Scenario& scenario);
+std::ostream& operator<<(std::ostream& os, const ScenarioResult& result);
+
+}  // namespace delpi
+
+#ifdef DELPI_INCLUDE_FMT
+
+#include "delpi/util/logging.h"
+
+OSTREAM_FORMATTER(delpi::Scenario::Bounds)
+OSTREAM_FORMATTER(delpi::Scenario)
+OSTREAM_FORMATTER(delpi::ScenarioResult)
+
+#endif
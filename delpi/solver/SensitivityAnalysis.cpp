@@ -0,0 +1,340 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/solver/SensitivityAnalysis.h"
+
+#include <ostream>
+
+#include "delpi/util/error.h"
+#include "delpi/util/logging.h"
+
+namespace delpi {
+
+namespace {
+
+/**
+ * Restrict the `range` to the values of @f$ t @f$ for which @f$ value + t \cdot derivative \ge 0 @f$.
+ * @pre The inequality holds for @f$ t = 0 @f$
+ * @param range range to restrict
+ * @param value value of the expression for @f$ t = 0 @f$
+ * @param derivative derivative of the expression with respect to @f$ t @f$
+ */
+void Restrict(SensitivityRange& range, const mpq_class& value, const mpq_class& derivative) {
+  if (derivative == 0) return;
+  mpq_class bound{-value / derivative};
+  if (derivative > 0) {
+    if (!range.lb.has_value() || bound > *range.lb) range.lb = std::move(bound);
+  } else {
+    if (!range.ub.has_value() || bound < *range.ub) range.ub = std::move(bound);
+  }
+}
+/**
+ * Restrict the `range` to the values of @f$ t @f$ for which the dual or reduced cost
+ * @f$ value + t \cdot derivative @f$ of a non-basic variable keeps the sign required by its `status`.
+ * @param range range to restrict
+ * @param status status of the variable in the basis
+ * @param value dual or reduced cost for @f$ t = 0 @f$
+ * @param derivative derivative of the dual or reduced cost with respect to @f$ t @f$
+ * @param lb lower bound of the variable, if any
+ * @param ub upper bound of the variable, if any
+ */
+void RestrictSign(SensitivityRange& range, const BasisStatus status, const mpq_class& value,
+                  const mpq_class& derivative, const std::optional<mpq_class>& lb, const std::optional<mpq_class>& ub) {
+  if (BasisSolution::FixedBounds(lb, ub)) return;
+  switch (status) {
+    case BasisStatus::AT_LOWER:
+      Restrict(range, value, derivative);
+      break;
+    case BasisStatus::AT_UPPER:
+      Restrict(range, -value, -derivative);
+      break;
+    case BasisStatus::FREE:
+      Restrict(range, value, derivative);
+      Restrict(range, -value, -derivative);
+      break;
+    default:
+      break;
+  }
+}
+/**
+ * Restrict the `range` to the values of @f$ t @f$ for which the basic variable @f$ value + t \cdot derivative @f$
+ * lies within its bounds.
+ * @param range range to restrict
+ * @param value value of the variable for @f$ t = 0 @f$
+ * @param derivative derivative of the variable with respect to @f$ t @f$
+ * @param lb lower bound of the variable, if any
+ * @param ub upper bound of the variable, if any
+ */
+void RestrictBounds(SensitivityRange& range, const mpq_class& value, const mpq_class& derivative,
+                    const std::optional<mpq_class>& lb, const std::optional<mpq_class>& ub) {
+  if (lb.has_value()) Restrict(range, value - *lb, derivative);
+  if (ub.has_value()) Restrict(range, *ub - value, -derivative);
+}
+/**
+ * Shift both ends of the `range` by `offset`.
+ * @param range range to shift
+ * @param offset value to add to the ends
+ * @return shifted range
+ */
+SensitivityRange Shift(SensitivityRange range, const mpq_class& offset) {
+  if (range.lb.has_value()) *range.lb += offset;
+  if (range.ub.has_value()) *range.ub += offset;
+  return range;
+}
+
+}  // namespace
+
+SensitivityAnalysis::SensitivityAnalysis(const std::vector<Column>& columns, const std::vector<Row>& rows,
+                                         const std::unordered_map<Variable, int>& var_to_col, Basis basis,
+                                         const unsigned int num_threads)
+    : columns_{columns}, rows_{rows}, basis_solution_{columns, rows, var_to_col, std::move(basis), num_threads} {}
+
+std::pair<std::vector<mpq_class>, std::vector<mpq_class>> SensitivityAnalysis::DualDirection(
+    const std::span<const mpq_class> direction) const {
+  DELPI_ASSERT(direction.size() == columns_.size(), "The direction must have a value for each column");
+  const std::vector<BasisSolution::SparseVector>& matrix = basis_solution_.matrix();
+  const std::vector<int>& basic_columns = basis_solution_.basic_columns();
+  const std::vector<int>& column_position = basis_solution_.column_position();
+  const std::vector<int>& tight_rows = basis_solution_.tight_rows();
+  const SparseLu& lu = basis_solution_.lu();
+  std::vector<mpq_class> d_b(basic_columns.size());
+  for (std::size_t p = 0; p < basic_columns.size(); ++p) d_b[p] = direction[basic_columns[p]];
+  std::vector<mpq_class> w{lu.SolveTranspose(std::move(d_b))};
+
+  std::vector<mpq_class> row_derivatives(rows_.size());
+  for (std::size_t e = 0; e < tight_rows.size(); ++e) row_derivatives[tight_rows[e]] = std::move(w[e]);
+  std::vector<mpq_class> column_derivatives(columns_.size());
+  for (std::size_t j = 0; j < columns_.size(); ++j) {
+    if (column_position[j] != -1) continue;
+    column_derivatives[j] = direction[j];
+    for (const auto& [i, coeff] : matrix[j]) column_derivatives[j] -= coeff * row_derivatives[i];
+  }
+  return {std::move(column_derivatives), std::move(row_derivatives)};
+}
+
+SensitivityRange SensitivityAnalysis::ParametricRange(const std::span<const mpq_class> direction) const {
+  DELPI_ASSERT(basis_solution_.optimal(), "The basis must be optimal");
+  const Basis& basis = basis_solution_.basis();
+  const std::vector<int>& column_position = basis_solution_.column_position();
+  const std::vector<int>& tight_rows = basis_solution_.tight_rows();
+  const std::vector<mpq_class>& dual_solution = basis_solution_.dual_solution();
+  const std::vector<mpq_class>& reduced_costs = basis_solution_.reduced_costs();
+  const auto [column_derivatives, row_derivatives] = DualDirection(direction);
+  SensitivityRange range;
+  for (const int i : tight_rows) {
+    RestrictSign(range, basis.rows[i], dual_solution[i], row_derivatives[i], rows_[i].lb, rows_[i].ub);
+  }
+  for (std::size_t j = 0; j < columns_.size(); ++j) {
+    if (column_position[j] != -1) continue;
+    RestrictSign(range, basis.columns[j], reduced_costs[j], column_derivatives[j], columns_[j].lb, columns_[j].ub);
+  }
+  return range;
+}
+
+SensitivityRange SensitivityAnalysis::ObjectiveRange(const int column) const {
+  DELPI_ASSERT(basis_solution_.optimal(), "The basis must be optimal");
+  DELPI_ASSERT(column >= 0 && column < static_cast<int>(columns_.size()), "Column index out of bounds");
+  const Basis& basis = basis_solution_.basis();
+  const std::vector<int>& column_position = basis_solution_.column_position();
+  const std::vector<mpq_class>& reduced_costs = basis_solution_.reduced_costs();
+  const Column& col = columns_[column];
+  const mpq_class obj{col.obj.value_or(0)};
+  // Only the reduced cost of a non-basic column depends on its objective coefficient
+  if (column_position[column] == -1) {
+    SensitivityRange range;
+    RestrictSign(range, basis.columns[column], reduced_costs[column], 1, col.lb, col.ub);
+    return Shift(std::move(range), obj);
+  }
+  std::vector<mpq_class> direction(columns_.size());
+  direction[column] = 1;
+  return Shift(ParametricRange(direction), obj);
+}
+
+SensitivityRange SensitivityAnalysis::RhsRange(const int row) const {
+  DELPI_ASSERT(basis_solution_.optimal(), "The basis must be optimal");
+  DELPI_ASSERT(row >= 0 && row < static_cast<int>(rows_.size()), "Row index out of bounds");
+  const Basis& basis = basis_solution_.basis();
+  const std::vector<BasisSolution::SparseVector>& matrix = basis_solution_.matrix();
+  const std::vector<int>& basic_columns = basis_solution_.basic_columns();
+  const std::vector<int>& row_position = basis_solution_.row_position();
+  const SparseLu& lu = basis_solution_.lu();
+  const std::vector<mpq_class>& solution = basis_solution_.solution();
+  const std::vector<mpq_class>& activity = basis_solution_.activity();
+  const Row& r = rows_[row];
+  // The bound of a row with a basic slack can move freely until it reaches the activity of the row
+  if (row_position[row] == -1) {
+    if (BasisSolution::FixedBounds(r.lb, r.ub)) return {activity[row], activity[row]};
+    if (r.lb.has_value()) return {std::nullopt, activity[row]};
+    if (r.ub.has_value()) return {activity[row], std::nullopt};
+    return {};
+  }
+
+  // Moving the right-hand side of a tight row by delta moves the basic columns by delta B^{-1} e_row
+  std::vector<mpq_class> e(basic_columns.size());
+  e[row_position[row]] = 1;
+  const std::vector<mpq_class> v{lu.Solve(std::move(e))};
+  SensitivityRange range;
+  std::vector<mpq_class> row_derivatives(rows_.size());
+  for (std::size_t p = 0; p < basic_columns.size(); ++p) {
+    if (v[p] == 0) continue;
+    const int j = basic_columns[p];
+    RestrictBounds(range, solution[j], v[p], columns_[j].lb, columns_[j].ub);
+    for (const auto& [i, coeff] : matrix[j]) {
+      if (row_position[i] == -1) row_derivatives[i] += coeff * v[p];
+    }
+  }
+  for (std::size_t i = 0; i < rows_.size(); ++i) {
+    if (row_position[i] == -1) RestrictBounds(range, activity[i], row_derivatives[i], rows_[i].lb, rows_[i].ub);
+  }
+  // A single bound cannot cross the other one
+  if (!BasisSolution::FixedBounds(r.lb, r.ub)) {
+    if (basis.rows[row] == BasisStatus::AT_LOWER && r.ub.has_value()) Restrict(range, *r.ub - activity[row], -1);
+    if (basis.rows[row] == BasisStatus::AT_UPPER && r.lb.has_value()) Restrict(range, activity[row] - *r.lb, 1);
+  }
+  return Shift(std::move(range), activity[row]);
+}
+
+SensitivityReport SensitivityAnalysis::Report() const {
+  SensitivityReport report;
+  report.objective.reserve(columns_.size());
+  report.rhs.reserve(rows_.size());
+  for (int j = 0; j < static_cast<int>(columns_.size()); ++j) report.objective.push_back(ObjectiveRange(j));
+  for (int i = 0; i < static_cast<int>(rows_.size()); ++i) report.rhs.push_back(RhsRange(i));
+  return report;
+}
+
+std::optional<Basis> SensitivityAnalysis::NextBasis(const std::span<const mpq_class> direction,
+                                                    const mpq_class& t) const {
+  DELPI_ASSERT(basis_solution_.optimal(), "The basis must be optimal");
+  const Basis& basis = basis_solution_.basis();
+  const std::vector<BasisSolution::SparseVector>& matrix = basis_solution_.matrix();
+  const std::vector<int>& basic_columns = basis_solution_.basic_columns();
+  const std::vector<int>& column_position = basis_solution_.column_position();
+  const std::vector<int>& row_position = basis_solution_.row_position();
+  const SparseLu& lu = basis_solution_.lu();
+  const std::vector<mpq_class>& solution = basis_solution_.solution();
+  const std::vector<mpq_class>& activity = basis_solution_.activity();
+  const std::vector<mpq_class>& dual_solution = basis_solution_.dual_solution();
+  const std::vector<mpq_class>& reduced_costs = basis_solution_.reduced_costs();
+  const int num_columns = static_cast<int>(columns_.size());
+  const int num_rows = static_cast<int>(rows_.size());
+  const auto [column_derivatives, row_derivatives] = DualDirection(direction);
+
+  // Direction in which the variable should move from its bound to decrease the objective beyond the breakpoint,
+  // or 0 if it should not move
+  const auto improving_sign = [&t](const BasisStatus status, const mpq_class& value, const mpq_class& derivative) {
+    if (value + t * derivative != 0) return 0;
+    switch (status) {
+      case BasisStatus::AT_LOWER:
+        return derivative < 0 ? 1 : 0;
+      case BasisStatus::AT_UPPER:
+        return derivative > 0 ? -1 : 0;
+      case BasisStatus::FREE:
+        return derivative < 0 ? 1 : derivative > 0 ? -1 : 0;
+      default:
+        return 0;
+    }
+  };
+  int entering = -1, sign = 0;
+  for (int j = 0; j < num_columns && sign == 0; ++j) {
+    if (column_position[j] != -1 || BasisSolution::FixedBounds(columns_[j].lb, columns_[j].ub)) continue;
+    sign = improving_sign(basis.columns[j], reduced_costs[j], column_derivatives[j]);
+    if (sign != 0) entering = j;
+  }
+  for (int i = 0; i < num_rows && sign == 0; ++i) {
+    if (row_position[i] == -1 || BasisSolution::FixedBounds(rows_[i].lb, rows_[i].ub)) continue;
+    sign = improving_sign(basis.rows[i], dual_solution[i], row_derivatives[i]);
+    if (sign != 0) entering = num_columns + i;
+  }
+  if (sign == 0) {
+    DELPI_DEBUG("SensitivityAnalysis::NextBasis: no entering variable");
+    return basis;
+  }
+
+  // Change of the basic columns and rows for a unit step of the entering variable
+  std::vector<mpq_class> rhs(basic_columns.size());
+  std::vector<mpq_class> row_deltas(num_rows);
+  if (entering < num_columns) {
+    for (const auto& [i, coeff] : matrix[entering]) {
+      if (row_position[i] != -1) rhs[row_position[i]] -= sign * coeff;
+      row_deltas[i] += sign * coeff;
+    }
+  } else {
+    rhs[row_position[entering - num_columns]] = sign;
+  }
+  const std::vector<mpq_class> column_deltas{lu.Solve(std::move(rhs))};
+  for (std::size_t p = 0; p < basic_columns.size(); ++p) {
+    if (column_deltas[p] == 0) continue;
+    for (const auto& [i, coeff] : matrix[basic_columns[p]]) row_deltas[i] += coeff * column_deltas[p];
+  }
+
+  // Primal ratio test. The entering variable may reach its other bound first
+  std::optional<mpq_class> step;
+  int leaving = -1;
+  BasisStatus leaving_status = BasisStatus::UNDEFINED;
+  const auto ratio = [&](const int index, const mpq_class& value, const mpq_class& delta,
+                         const std::optional<mpq_class>& lb, const std::optional<mpq_class>& ub) {
+    const std::optional<mpq_class>& bound = delta < 0 ? lb : ub;
+    if (delta == 0 || !bound.has_value()) return;
+    mpq_class candidate{(*bound - value) / delta};
+    if (step.has_value() && candidate >= *step) return;
+    step = std::move(candidate);
+    leaving = index;
+    if (BasisSolution::FixedBounds(lb, ub)) {
+      leaving_status = BasisStatus::FIXED;
+    } else {
+      leaving_status = delta < 0 ? BasisStatus::AT_LOWER : BasisStatus::AT_UPPER;
+    }
+  };
+  for (int j = 0; j < num_columns; ++j) {
+    if (column_position[j] != -1) {
+      ratio(j, solution[j], column_deltas[column_position[j]], columns_[j].lb, columns_[j].ub);
+    } else if (j == entering) {
+      ratio(j, solution[j], sign, columns_[j].lb, columns_[j].ub);
+    }
+  }
+  for (int i = 0; i < num_rows; ++i) {
+    if (row_position[i] == -1 || num_columns + i == entering) {
+      ratio(num_columns + i, activity[i], row_position[i] == -1 ? row_deltas[i] : sign, rows_[i].lb, rows_[i].ub);
+    }
+  }
+  if (!step.has_value()) {
+    DELPI_DEBUG("SensitivityAnalysis::NextBasis: the problem is unbounded beyond the breakpoint");
+    return std::nullopt;
+  }
+
+  Basis next{basis};
+  const auto status = [&next, num_columns](const int index) -> BasisStatus& {
+    return index < num_columns ? next.columns[index] : next.rows[index - num_columns];
+  };
+  // If the entering variable reaches its other bound first, it only switches bound
+  if (leaving != entering) status(entering) = BasisStatus::BASIC;
+  status(leaving) = leaving_status;
+  DELPI_TRACE_FMT("SensitivityAnalysis::NextBasis: {} enters, {} leaves with a step of {}", entering, leaving, *step);
+  return next;
+}
+
+std::ostream& operator<<(std::ostream& os, const SensitivityRange& range) {
+  os << "[ ";
+  if (range.lb.has_value()) {
+    os << range.lb.value();
+  } else {
+    os << "-inf";
+  }
+  os << " , ";
+  if (range.ub.has_value()) {
+    os << range.ub.value();
+  } else {
+    os << "inf";
+  }
+  return os << " ]";
+}
+
+std::ostream& operator<<(std::ostream& os, const ParametricSegment& segment) {
+  return os << "ParametricSegment{ t in [ " << segment.t_lb << " , " << segment.t_ub << " ], " << segment.result
+            << ", objective: " << segment.objective << " + t * " << segment.slope << " }";
+}
+
+}  // namespace delpi
@@ -0,0 +1,164 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * SensitivityAnalysis class.
+ */
+#pragma once
+
+#include <iosfwd>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "delpi/libs/gmp.h"
+#include "delpi/solver/Basis.h"
+#include "delpi/solver/BasisSolution.h"
+#include "delpi/solver/Column.h"
+#include "delpi/solver/LpResult.h"
+#include "delpi/solver/Row.h"
+#include "delpi/symbolic/Variable.h"
+
+namespace delpi {
+
+/** Closed interval of values over which a basis stays optimal. */
+struct SensitivityRange {
+  std::optional<mpq_class> lb;  ///< Lower bound. If `std::nullopt`, indicates unboundedness
+  std::optional<mpq_class> ub;  ///< Upper bound. If `std::nullopt`, indicates unboundedness
+};
+
+/** Sensitivity ranges of an optimal basis. */
+struct SensitivityReport {
+  std::vector<SensitivityRange> objective;  ///< Range of the objective coefficient of each column
+  std::vector<SensitivityRange> rhs;        ///< Range of the right-hand side of each row
+};
+
+/**
+ * Interval of the parameter @f$ t @f$ of the objective @f$ c + t d @f$ over which the same solution stays optimal.
+ *
+ * Since the solution does not depend on @f$ t @f$ inside the interval,
+ * the optimal objective value is the linear function @f$ objective + t \cdot slope @f$.
+ */
+struct ParametricSegment {
+  mpq_class t_lb;                   ///< Lower bound of the interval
+  mpq_class t_ub;                   ///< Upper bound of the interval
+  LpResult result;                  ///< Result of the LP problem over the interval
+  mpq_class objective;              ///< Value of @f$ c^T x @f$
+  mpq_class slope;                  ///< Value of @f$ d^T x @f$
+  std::vector<mpq_class> solution;  ///< Optimal solution over the interval, if the result is optimal
+};
+
+/**
+ * Exact sensitivity analysis of an optimal simplex basis.
+ *
+ * Given the problem @f$ \min c^T x @f$ s.t. @f$ l_r \le A x \le u_r @f$, @f$ l_c \le x \le u_c @f$ and a basis,
+ * the @ref BasisSolution provides the factorisation of the basis matrix @f$ B @f$,
+ * together with the primal solution, the dual solution and the reduced costs computed in rational arithmetic.
+ * Each range is then obtained with a ratio test, after solving a single system with the factorisation:
+ * - when the objective moves along the direction @f$ d @f$, the duals move along @f$ B^{-T} d_B @f$,
+ *   and the basis stays optimal as long as the duals and reduced costs keep their sign;
+ * - when the right-hand side of a tight row moves, the basic columns move along a column of @f$ B^{-1} @f$,
+ *   and the basis stays optimal as long as the basic columns and rows are within their bounds.
+ *
+ * The objective is always minimised.
+ * The columns and rows must outlive the analysis.
+ */
+class SensitivityAnalysis {
+ public:
+  /**
+   * Construct a new SensitivityAnalysis object for the given problem and basis.
+   * @param columns columns of the problem
+   * @param rows rows of the problem
+   * @param var_to_col map from the variables to the index of their column
+   * @param basis basis to analyse
+   * @param num_threads maximum number of threads used to factorise the basis matrix
+   */
+  SensitivityAnalysis(const std::vector<Column>& columns, const std::vector<Row>& rows,
+                      const std::unordered_map<Variable, int>& var_to_col, Basis basis, unsigned int num_threads = 1);
+
+  /**
+   * Range of values the objective coefficient of `column` can take while the basis stays optimal.
+   * @pre The basis is optimal
+   * @param column index of the column
+   * @return range of the objective coefficient
+   */
+  [[nodiscard]] SensitivityRange ObjectiveRange(int column) const;
+  /**
+   * Range of values the right-hand side of `row` can take while the basis stays optimal.
+   *
+   * The right-hand side is the bound the row is tight at, or both bounds if they coincide.
+   * For a row with a basic slack, it is the lower bound, or the upper bound if the row has no lower bound.
+   * @pre The basis is optimal
+   * @param row index of the row
+   * @return range of the right-hand side
+   */
+  [[nodiscard]] SensitivityRange RhsRange(int row) const;
+  /**
+   * Range of values of @f$ t @f$ for which the basis is optimal with the objective @f$ c + t d @f$,
+   * where @f$ c @f$ is the current objective and @f$ d @f$ is the `direction`.
+   * @pre The basis is optimal, hence the range contains 0
+   * @param direction direction of the objective, with a value for each column
+   * @return range of @f$ t @f$
+   */
+  [[nodiscard]] SensitivityRange ParametricRange(std::span<const mpq_class> direction) const;
+  /**
+   * Sensitivity ranges of the objective coefficient of each column and of the right-hand side of each row.
+   * @pre The basis is optimal
+   * @return sensitivity ranges
+   */
+  [[nodiscard]] SensitivityReport Report() const;
+  /**
+   * Pivot towards a basis that stays optimal when @f$ t @f$ grows beyond the breakpoint `t`
+   * of the objective @f$ c + t d @f$, where @f$ c @f$ is the current objective and @f$ d @f$ is the `direction`.
+   *
+   * The entering variable is a non-basic column or tight row whose reduced cost or dual is zero at the breakpoint
+   * and would take the wrong sign beyond it, while the leaving one comes from a primal ratio test.
+   * Ties are broken in favour of the lowest index, columns first, which prevents cycling (Bland's rule).
+   * If there is no entering variable, the basis is returned unchanged.
+   * @pre The basis is optimal and `t` is the upper bound of the @ref ParametricRange of the `direction`
+   * @param direction direction of the objective, with a value for each column
+   * @param t breakpoint of the parameter
+   * @return next basis, which may need further pivots before @f$ t @f$ can grow
+   * @return std::nullopt if the problem is unbounded beyond the breakpoint
+   */
+  [[nodiscard]] std::optional<Basis> NextBasis(std::span<const mpq_class> direction, const mpq_class& t) const;
+
+  /** @checker{optimal, basis} */
+  [[nodiscard]] bool optimal() const { return basis_solution_.optimal(); }
+  /** @getter{basis, analysis} */
+  [[nodiscard]] const Basis& basis() const { return basis_solution_.basis(); }
+  /** @getter{primal solution associated with the basis, analysis} */
+  [[nodiscard]] const std::vector<mpq_class>& solution() const { return basis_solution_.solution(); }
+  /** @getter{dual solution associated with the basis, analysis} */
+  [[nodiscard]] const std::vector<mpq_class>& dual_solution() const { return basis_solution_.dual_solution(); }
+
+ private:
+  /**
+   * Compute the derivative of the dual of each tight row and of the reduced cost of each non-basic column
+   * when the objective moves along the `direction`.
+   * @param direction direction of the objective, with a value for each column
+   * @return derivatives of the reduced costs of the columns and of the duals of the rows, in this order
+   */
+  [[nodiscard]] std::pair<std::vector<mpq_class>, std::vector<mpq_class>> DualDirection(
+      std::span<const mpq_class> direction) const;
+
+  const std::vector<Column>& columns_;  ///< Columns of the problem
+  const std::vector<Row>& rows_;        ///< Rows of the problem
+  BasisSolution basis_solution_;        ///< Exact solution associated with the basis being analysed
+};
+
+std::ostream& operator<<(std::ostream& os, const SensitivityRange& range);
+std::ostream& operator<<(std::ostream& os, const ParametricSegment& segment);
+
+}  // namespace delpi
+
+#ifdef DELPI_INCLUDE_FMT
+
+#include "delpi/util/logging.h"
+
+OSTREAM_FORMATTER(delpi::SensitivityRange)
+OSTREAM_FORMATTER(delpi::ParametricSegment)
+
+#endif
@@ -10,6 +10,7 @@
 #include <span>  // NOLINT(build/include_order): c++20 header
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "delpi/util/error.h"
 #include "delpi/util/logging.h"
@@ -17,10 +18,58 @@
 namespace delpi {
 
 using SoplexStatus = soplex::SPxSolver::Status;
+using SoplexVarStatus = soplex::SPxSolver::VarStatus;
+
+namespace {
+BasisStatus ToBasisStatus(const SoplexVarStatus status) {
+  switch (status) {
+    case SoplexVarStatus::BASIC:
+      return BasisStatus::BASIC;
+    case SoplexVarStatus::ON_LOWER:
+      return BasisStatus::AT_LOWER;
+    case SoplexVarStatus::ON_UPPER:
+      return BasisStatus::AT_UPPER;
+    case SoplexVarStatus::FIXED:
+      return BasisStatus::FIXED;
+    case SoplexVarStatus::ZERO:
+      return BasisStatus::FREE;
+    default:
+      return BasisStatus::UNDEFINED;
+  }
+}
+SoplexVarStatus ToSoplexVarStatus(const BasisStatus status) {
+  switch (status) {
+    case BasisStatus::BASIC:
+      return SoplexVarStatus::BASIC;
+    case BasisStatus::AT_UPPER:
+      return SoplexVarStatus::ON_UPPER;
+    case BasisStatus::FIXED:
+      return SoplexVarStatus::FIXED;
+    case BasisStatus::FREE:
+      return SoplexVarStatus::ZERO;
+    default:
+      return SoplexVarStatus::ON_LOWER;
+  }
+}
+soplex::SoPlex::PricerValue ToSoplexPricer(const Config::Pricing pricing) {
+  switch (pricing) {
+    case Config::Pricing::DANTZIG:
+      return soplex::SoPlex::PRICER_DANTZIG;
+    case Config::Pricing::DEVEX:
+      return soplex::SoPlex::PRICER_DEVEX;
+    case Config::Pricing::STEEPEST:
+      return soplex::SoPlex::PRICER_STEEP;
+    default:
+      return soplex::SoPlex::PRICER_AUTO;
+  }
+}
+}  // namespace
 
 SoplexLpSolver::SoplexLpSolver(Config config, const std::string& class_name)
     : LpSolver{-soplex::infinity, soplex::infinity, std::move(config), class_name},
-      consolidated_{false},
+      consolidated_{config_.memory_lean()},
+      interrupt_{false},
+      soplex_interrupt_{false},
       spx_{},
       rninfinity_{-soplex::infinity},
       rinfinity_{soplex::infinity} {
@@ -33,6 +82,8 @@ SoplexLpSolver::SoplexLpSolver(Config config, const std::string& class_name)
   spx_.setIntParam(soplex::SoPlex::SYNCMODE, soplex::SoPlex::SYNCMODE_AUTO);
   spx_.setIntParam(soplex::SoPlex::SIMPLIFIER, soplex::SoPlex::SIMPLIFIER_INTERNAL);
   spx_.setIntParam(soplex::SoPlex::VERBOSITY, config_.verbose_simplex());
+  spx_.setIntParam(soplex::SoPlex::PRICER, ToSoplexPricer(config_.pricing()));
+  if (config_.random_seed() != 0) spx_.setRandomSeed(config_.random_seed());
   // Default is maximise.
   spx_.setIntParam(soplex::SoPlex::OBJSENSE, soplex::SoPlex::OBJSENSE_MINIMIZE);
   // Enable precision boosting
@@ -44,8 +95,9 @@ SoplexLpSolver::SoplexLpSolver(Config config, const std::string& class_name)
   bool enable_iterative_refinement = config_.lp_mode() != Config::LpMode::PURE_PRECISION_BOOSTING;
   spx_.setBoolParam(soplex::SoPlex::ITERATIVE_REFINEMENT, enable_iterative_refinement);
   DELPI_DEBUG_FMT(
-      "SoplexTheorySolver::SoplexTheorySolver: precision = {}, precision_boosting = {}, iterative_refinement = {}",
-      config_.precision(), enable_precision_boosting, enable_iterative_refinement);
+      "SoplexTheorySolver::SoplexTheorySolver: precision = {}, precision_boosting = {}, iterative_refinement = {}, "
+      "memory_lean = {}",
+      config_.precision(), enable_precision_boosting, enable_iterative_refinement, config_.memory_lean());
 }
 
 int SoplexLpSolver::num_columns() const { return consolidated_ ? spx_.numColsRational() : spx_cols_.num(); }
@@ -84,11 +136,12 @@ Row SoplexLpSolver::row(const RowIndex row_idx) const {
 
 void SoplexLpSolver::ReserveColumns(const int num_columns) {
   LpSolver::ReserveColumns(num_columns);
-  spx_cols_ = soplex::LPColSetRational(num_columns, num_columns);
+  // Once consolidated, the columns go straight to SoPlex, so there is nothing to stage
+  if (!consolidated_) spx_cols_ = soplex::LPColSetRational(num_columns, num_columns);
 }
 void SoplexLpSolver::ReserveRows(const int num_rows) {
   LpSolver::ReserveRows(num_rows);
-  spx_rows_ = soplex::LPRowSetRational(num_rows, num_rows);
+  if (!consolidated_) spx_rows_ = soplex::LPRowSetRational(num_rows, num_rows);
 }
 
 LpSolver::ColumnIndex SoplexLpSolver::AddColumn(const Variable& var, const mpq_class& obj, const mpq_class& lb,
@@ -127,7 +180,7 @@ LpSolver::RowIndex SoplexLpSolver::AddRow(const Expression::Addends& lhs, const
     spx_rows_.add(row_rational);
   return num_rows() - 1;
 }
-void SoplexLpSolver::SetBound(const Variable var, const mpq_class& lb, const mpq_class& ub) {
+void SoplexLpSolver::SetBoundCore(const Variable var, const mpq_class& lb, const mpq_class& ub) {
   if (consolidated_) {
     spx_.changeBoundsRational(var_to_col_.at(var), lb.get_mpq_t(), ub.get_mpq_t());
   } else {
@@ -153,25 +206,68 @@ void SoplexLpSolver::SetCoefficient(const int row, const int column, const mpq_c
       DELPI_TRACE_FMT("SoplexLpSolver::SetCoefficient: row {}: {}", row, spx_rows_.rowVector(row));
   }
 }
-void SoplexLpSolver::SetObjective(const int column, const mpq_class& value) {
+void SoplexLpSolver::SetObjectiveCore(const int column, const mpq_class& value) {
   DELPI_ASSERT(column < num_columns(), "Column index out of bounds");
   if (consolidated_)
     spx_.changeObjRational(column, value.get_mpq_t());
   else
     spx_cols_.maxObj_w(column) = value.get_mpq_t();
 }
+void SoplexLpSolver::SetRowBoundCore(const RowIndex row, const mpq_class& lb, const mpq_class& ub) {
+  DELPI_ASSERT(row < num_rows(), "Row index out of bounds");
+  if (consolidated_) {
+    spx_.changeRangeRational(row, lb.get_mpq_t(), ub.get_mpq_t());
+  } else {
+    spx_rows_.lhs_w(row) = lb.get_mpq_t();
+    spx_rows_.rhs_w(row) = ub.get_mpq_t();
+  }
+}
+
+void SoplexLpSolver::RemoveRowsCore(const std::span<const RowIndex> rows) {
+  // Working on the consolidated problem lets SoPlex keep its basis and renumber the rows on its own
+  Consolidate();
+  std::vector<int> indices{rows.begin(), rows.end()};
+  spx_.removeRowsRational(indices.data(), static_cast<int>(indices.size()));
+}
+void SoplexLpSolver::RemoveColumnsCore(const std::span<const ColumnIndex> columns) {
+  Consolidate();
+  std::vector<int> indices{columns.begin(), columns.end()};
+  spx_.removeColsRational(indices.data(), static_cast<int>(indices.size()));
+}
+
+void SoplexLpSolver::Consolidate() {
+  if (consolidated_) return;
+  const ProfilerGuard profiler_guard{profiler_, "consolidate"};
+  spx_.addColsRational(spx_cols_);
+  spx_.addRowsRational(spx_rows_);
+  consolidated_ = true;
+  // Clearing the sets would keep their memory around, while the staging area is never used again
+  spx_cols_ = soplex::LPColSetRational{};
+  spx_rows_ = soplex::LPRowSetRational{};
+}
 
 LpResult SoplexLpSolver::SolveCore(mpq_class& precision, const bool store_solution) {
-  if (!consolidated_) {
-    spx_.addColsRational(spx_cols_);
-    spx_.addRowsRational(spx_rows_);
-    consolidated_ = true;
-    spx_cols_.clear();
-    spx_rows_.clear();
+  Consolidate();
+  // The dual simplex is the default algorithm, unless the primal one is preferred
+  const bool primal = NextSimplexAlgorithm() == Config::SimplexAlgorithm::PRIMAL;
+  spx_.setIntParam(soplex::SoPlex::ALGORITHM,
+                   primal ? soplex::SoPlex::ALGORITHM_PRIMAL : soplex::SoPlex::ALGORITHM_DUAL);
+  DELPI_DEBUG_FMT("SoplexLpSolver::SolveCore: using the {} simplex", primal ? "primal" : "dual");
+  if (config_.lp_mode() == Config::LpMode::FLOAT_FIRST && SolveFloatFirst(precision, store_solution)) {
+    return precision == 0 ? LpResult::OPTIMAL : LpResult::DELTA_OPTIMAL;
   }
-  const SoplexStatus status = spx_.optimize();
+  profiler_.Enter("simplex");
+  const SoplexStatus status = spx_.optimize(&soplex_interrupt_);
+  profiler_.Count("iterations", spx_.numIterations());
+  profiler_.Count("precision_boosts", spx_.numPrecisionBoosts());
+  profiler_.Count("boosted_iterations", spx_.numIterationsBoosted());
+  profiler_.Exit();
   soplex::Rational max_violation, sum_violation;
 
+  if (interrupt_) {
+    DELPI_DEBUG_FMT("SoplexLpSolver::SolveCore: interrupted with status {}", status);
+    return LpResult::ERROR;
+  }
   // The status must be OPTIMAL, UNBOUNDED, or INFEASIBLE. Anything else is an error
   if (status != SoplexStatus::OPTIMAL && status != SoplexStatus::UNBOUNDED && status != SoplexStatus::INFEASIBLE) {
     DELPI_ERROR_FMT("SoplexLpSolver::Optimise: Unexpected SoPlex return -> {}", status);
@@ -199,6 +295,7 @@ LpResult SoplexLpSolver::SolveCore(mpq_class& precision, const bool store_soluti
 }
 
 void SoplexLpSolver::UpdateFeasible() {
+  const ProfilerGuard profiler_guard{profiler_, "extract"};
   DELPI_ASSERT(solution_.empty(), "solution_ must be empty");
   DELPI_ASSERT(dual_solution_.empty(), "dual_solution_ must be empty");
   // Set the feasible information
@@ -219,6 +316,71 @@ void SoplexLpSolver::UpdateFeasible() {
   for (int i = 0; i < rowcount; i++) dual_solution_.emplace_back(gmp::ToMpqClass(dual[i].backend().data()));
 
   obj_lb_ = obj_ub_ = gmp::ToMpqClass(spx_.objValueRational().backend().data());
+
+  basis_ = CurrentBasis();
+}
+
+void SoplexLpSolver::Interrupt() {
+  interrupt_ = true;
+  soplex_interrupt_ = true;
+}
+void SoplexLpSolver::ResetInterrupt() {
+  interrupt_ = false;
+  soplex_interrupt_ = false;
+}
+
+bool SoplexLpSolver::SolveFloatFirst(mpq_class& precision, const bool store_solution) {
+  profiler_.Enter("float_simplex");
+  spx_.setIntParam(soplex::SoPlex::SOLVEMODE, soplex::SoPlex::SOLVEMODE_REAL);
+  spx_.setIntParam(soplex::SoPlex::CHECKMODE, soplex::SoPlex::CHECKMODE_REAL);
+  const SoplexStatus status = spx_.optimize(&soplex_interrupt_);
+  spx_.setIntParam(soplex::SoPlex::SOLVEMODE, soplex::SoPlex::SOLVEMODE_RATIONAL);
+  spx_.setIntParam(soplex::SoPlex::CHECKMODE, soplex::SoPlex::CHECKMODE_RATIONAL);
+  profiler_.Count("iterations", spx_.numIterations());
+  profiler_.Exit();
+
+  if (status != SoplexStatus::OPTIMAL || !spx_.hasBasis()) {
+    DELPI_DEBUG_FMT("SoplexLpSolver::SolveFloatFirst: SoPlex returned {}, falling back to the rational solve", status);
+    return false;
+  }
+  if (CertifyBasis(CurrentBasis(), store_solution)) {
+    precision = 0;
+    return true;
+  }
+  if (precision <= 0) return false;
+
+  // The basis is not optimal in exact arithmetic, but the float solution may be good enough for the requested precision
+  std::vector<double> solution(num_columns()), dual(num_rows());
+  if (!spx_.getPrimalReal(solution.data(), num_columns()) || !spx_.getDualReal(dual.data(), num_rows())) return false;
+  if (!AcceptApproximateSolution(solution, dual, precision, store_solution)) return false;
+  if (store_solution) basis_ = CurrentBasis();
+  return true;
+}
+
+Basis SoplexLpSolver::CurrentBasis() const {
+  Basis basis;
+  if (!spx_.hasBasis()) return basis;
+  const int colcount = num_columns();
+  const int rowcount = num_rows();
+  std::vector<SoplexVarStatus> row_status(rowcount), column_status(colcount);
+  spx_.getBasis(row_status.data(), column_status.data());
+  basis.columns.reserve(colcount);
+  basis.rows.reserve(rowcount);
+  for (const SoplexVarStatus status : column_status) basis.columns.push_back(ToBasisStatus(status));
+  for (const SoplexVarStatus status : row_status) basis.rows.push_back(ToBasisStatus(status));
+  return basis;
+}
+
+void SoplexLpSolver::LoadBasis(const Basis& basis) {
+  DELPI_ASSERT(static_cast<int>(basis.columns.size()) == num_columns(), "The basis must have a status for each column");
+  DELPI_ASSERT(static_cast<int>(basis.rows.size()) == num_rows(), "The basis must have a status for each row");
+  Consolidate();
+  std::vector<SoplexVarStatus> row_status, column_status;
+  row_status.reserve(basis.rows.size());
+  column_status.reserve(basis.columns.size());
+  for (const BasisStatus status : basis.rows) row_status.push_back(ToSoplexVarStatus(status));
+  for (const BasisStatus status : basis.columns) column_status.push_back(ToSoplexVarStatus(status));
+  spx_.setBasis(row_status.data(), column_status.data());
 }
 
 #if 0
@@ -10,6 +10,8 @@
 #error SoPlex is not enabled. Please enable it by adding "--//tools:enable_soplex" to the bazel command.
 #endif
 
+#include <atomic>
+#include <span>  // NOLINT(build/include_order): c++20 header
 #include <string>
 #include <utility>
 #include <vector>
@@ -25,6 +27,14 @@ namespace delpi {
 
 /**
  * Linear programming solver using [SoPlex](https://soplex.zib.de/).
+ *
+ * SoPlex keeps both a rational copy of the problem and a floating point one, used by its simplex
+ * and kept in sync automatically.
+ * By default, the columns and rows are staged in @ref spx_cols_ and @ref spx_rows_ and handed to SoPlex
+ * in a single batch by @ref Consolidate, which is much faster than adding them one by one,
+ * but holds a third copy of the problem until then.
+ * With @ref Config::memory_lean, the problem is consolidated from the start, so each column and row is streamed
+ * straight into SoPlex and the peak memory is the one of its two copies.
  */
 class SoplexLpSolver final : public LpSolver {
  public:
@@ -40,9 +50,7 @@ class SoplexLpSolver final : public LpSolver {
   ColumnIndex AddColumn(const Variable& var, const mpq_class& obj, const mpq_class& lb, const mpq_class& ub) override;
   RowIndex AddRow(const std::vector<Expression::Addend>& addends, const mpq_class& lb, const mpq_class& ub) override;
   RowIndex AddRow(const Expression::Addends& lhs, FormulaKind sense, const mpq_class& rhs) override;
-  void SetBound(Variable var, const mpq_class& lb, const mpq_class& ub) override;
   void SetCoefficient(RowIndex row, ColumnIndex column, const mpq_class& value) override;
-  void SetObjective(int column, const mpq_class& value) override;
 
 #ifndef NDEBUG
   void Dump() override;
@@ -50,6 +58,21 @@ class SoplexLpSolver final : public LpSolver {
 
  private:
   LpResult SolveCore(mpq_class& precision, bool store_solution) override;
+  void RemoveRowsCore(std::span<const RowIndex> rows) override;
+  void RemoveColumnsCore(std::span<const ColumnIndex> columns) override;
+  void SetBoundCore(Variable var, const mpq_class& lb, const mpq_class& ub) override;
+  void SetObjectiveCore(ColumnIndex column, const mpq_class& value) override;
+  void SetRowBoundCore(RowIndex row, const mpq_class& lb, const mpq_class& ub) override;
+  [[nodiscard]] Basis CurrentBasis() const override;
+  void LoadBasis(const Basis& basis) override;
+  void Interrupt() override;
+  void ResetInterrupt() override;
+  /**
+   * Transfer the columns and rows collected so far to the underlying SoPlex solver, if not done already.
+   *
+   * From then on, all the changes to the LP problem are applied to SoPlex directly.
+   */
+  void Consolidate();
   /**
    * Parse a sequence of `literal_monomials` and set the coefficient for each decisional variable appearing in it.
    * @tparam TypedIterable generic iterable containing pairs (Variable, coeff) (i.e. std::vector, std::set, std::span)
@@ -74,6 +97,20 @@ class SoplexLpSolver final : public LpSolver {
    * The useful information will be stored in @ref solution_ and @ref dual_solution_.
    */
   void UpdateFeasible();
+  /**
+   * Solve the LP problem with the floating point simplex and certify the optimality of the final basis
+   * in rational arithmetic, without running the rational solve.
+   *
+   * Used in the @ref Config::LpMode::FLOAT_FIRST mode.
+   * If the basis cannot be certified but `precision` is positive, the floating point solution is still accepted
+   * if the safe objective bound obtained from its dual solution proves it is within `precision` of the optimum.
+   * Otherwise, the caller should fall back to the rational solve, which will start from the basis found so far.
+   * @param[in,out] precision desired precision. Set to the actual one on success, 0 if the solution is exact
+   * @param store_solution whether the solution and dual solution should be stored
+   * @return true if the problem has been solved
+   * @return false if the rational solve is needed
+   */
+  bool SolveFloatFirst(mpq_class& precision, bool store_solution);
 #if 0
   /**
    * Use the result from the lp solver to update the infeasible ray with the conflict that has been detected.
@@ -90,7 +127,9 @@ class SoplexLpSolver final : public LpSolver {
 #endif
 
  private:
-  bool consolidated_;  ///< Whether the LP problem has been consolidated
+  bool consolidated_;               ///< Whether the LP problem has been consolidated
+  std::atomic<bool> interrupt_;     ///< Whether the solve in progress should stop. Polled by delpi
+  volatile bool soplex_interrupt_;  ///< Copy of @ref interrupt_ handed to SoPlex, which only polls a plain flag
 
   soplex::SoPlex spx_;  ///< SoPlex LP solver
 
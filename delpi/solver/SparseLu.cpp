@@ -0,0 +1,266 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/solver/SparseLu.h"
+
+#include <algorithm>
+#include <future>
+#include <limits>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <set>
+
+#include "delpi/util/ThreadPool.h"
+#include "delpi/util/error.h"
+#include "delpi/util/logging.h"
+
+namespace delpi {
+
+namespace {
+
+/** Maximum number of rows and columns inspected by the Markowitz search once a candidate pivot has been found. */
+constexpr int markowitz_search_limit = 4;
+
+/**
+ * Find the representative of the set containing `node`, compressing the path along the way.
+ * @param parent parent of each node in the disjoint-set forest
+ * @param node node to find the representative of
+ * @return representative of the set
+ */
+int FindRoot(std::vector<int>& parent, int node) {
+  while (parent[node] != node) {
+    parent[node] = parent[parent[node]];
+    node = parent[node];
+  }
+  return node;
+}
+
+}  // namespace
+
+SparseLu::SparseLu(const std::vector<SparseVector>& columns, const unsigned int num_threads)
+    : size_{static_cast<int>(columns.size())}, singular_{false} {
+  // Rows are the nodes [0, size_), columns the nodes [size_, 2 * size_) of the row-column graph
+  std::vector<int> parent(2 * size_);
+  std::iota(parent.begin(), parent.end(), 0);
+  for (int j = 0; j < size_; ++j) {
+    for (const auto& [i, value] : columns[j]) {
+      DELPI_ASSERT(0 <= i && i < size_, "Row index out of bounds");
+      if (value == 0) continue;
+      const int row_root = FindRoot(parent, i), column_root = FindRoot(parent, size_ + j);
+      if (row_root != column_root) parent[row_root] = column_root;
+    }
+  }
+
+  std::vector<int> block_of_root(2 * size_, -1);
+  std::vector<std::vector<int>> block_rows, block_columns;
+  for (int node = 0; node < 2 * size_; ++node) {
+    const int root = FindRoot(parent, node);
+    if (block_of_root[root] == -1) {
+      block_of_root[root] = static_cast<int>(block_rows.size());
+      block_rows.emplace_back();
+      block_columns.emplace_back();
+    }
+    if (node < size_) {
+      block_rows[block_of_root[root]].push_back(node);
+    } else {
+      block_columns[block_of_root[root]].push_back(node - size_);
+    }
+  }
+  // An empty row or column, or any block that is not square, makes the matrix singular
+  for (std::size_t b = 0; b < block_rows.size(); ++b) {
+    if (block_rows[b].size() != block_columns[b].size()) {
+      DELPI_DEBUG_FMT("SparseLu::SparseLu: block {} has {} rows and {} columns", b, block_rows[b].size(),
+                      block_columns[b].size());
+      singular_ = true;
+      return;
+    }
+  }
+
+  blocks_.resize(block_rows.size());
+  if (num_threads > 1 && blocks_.size() > 1) {
+    ThreadPool pool{std::min(num_threads, static_cast<unsigned int>(blocks_.size()))};
+    std::vector<std::future<Block>> futures;
+    futures.reserve(blocks_.size());
+    for (std::size_t b = 0; b < blocks_.size(); ++b) {
+      futures.emplace_back(pool.Submit([&, b]() { return FactoriseBlock(block_rows[b], block_columns[b], columns); }));
+    }
+    for (std::size_t b = 0; b < blocks_.size(); ++b) blocks_[b] = futures[b].get();
+  } else {
+    for (std::size_t b = 0; b < blocks_.size(); ++b) {
+      blocks_[b] = FactoriseBlock(block_rows[b], block_columns[b], columns);
+    }
+  }
+  singular_ = std::ranges::any_of(blocks_, [](const Block& block) { return block.empty(); });
+  DELPI_DEBUG_FMT("SparseLu::SparseLu: factorised {}x{} matrix in {} blocks, singular = {}", size_, size_,
+                  blocks_.size(), singular_);
+}
+
+SparseLu::Block SparseLu::FactoriseBlock(const std::vector<int>& rows, const std::vector<int>& columns,
+                                         const std::vector<SparseVector>& matrix) {
+  const int n = static_cast<int>(rows.size());
+  std::map<int, int> local_row;
+  for (int i = 0; i < n; ++i) local_row.emplace(rows[i], i);
+
+  // Active submatrix, stored both by row (with the values) and by column (with the row indices only)
+  std::vector<std::map<int, mpq_class>> a(n);
+  std::vector<std::set<int>> col_rows(n);
+  for (int j = 0; j < n; ++j) {
+    for (const auto& [i, value] : matrix[columns[j]]) {
+      if (value == 0) continue;
+      const int li = local_row.at(i);
+      a[li][j] += value;
+      if (a[li][j] == 0) {
+        a[li].erase(j);
+        col_rows[j].erase(li);
+      } else {
+        col_rows[j].insert(li);
+      }
+    }
+  }
+
+  // Rows and columns of the active submatrix, bucketed by their number of non-zeros
+  std::vector<std::set<int>> row_bucket(n + 1), col_bucket(n + 1);
+  for (int i = 0; i < n; ++i) row_bucket[a[i].size()].insert(i);
+  for (int j = 0; j < n; ++j) col_bucket[col_rows[j].size()].insert(j);
+
+  Block block;
+  block.reserve(n);
+  for (int step = 0; step < n; ++step) {
+    if (!row_bucket[0].empty() || !col_bucket[0].empty()) return {};
+
+    // Markowitz search, from the sparsest rows and columns
+    int pivot_row = -1, pivot_col = -1;
+    std::size_t best_cost = std::numeric_limits<std::size_t>::max();
+    int searched = 0;
+    for (std::size_t count = 1; count <= static_cast<std::size_t>(n); ++count) {
+      for (const int j : col_bucket[count]) {
+        for (const int i : col_rows[j]) {
+          const std::size_t cost = (a[i].size() - 1) * (count - 1);
+          if (cost >= best_cost) continue;
+          best_cost = cost;
+          pivot_row = i;
+          pivot_col = j;
+        }
+        if (++searched >= markowitz_search_limit) break;
+      }
+      for (const int i : row_bucket[count]) {
+        for (const auto& [j, value] : a[i]) {
+          const std::size_t cost = (count - 1) * (col_rows[j].size() - 1);
+          if (cost >= best_cost) continue;
+          best_cost = cost;
+          pivot_row = i;
+          pivot_col = j;
+        }
+        if (++searched >= markowitz_search_limit) break;
+      }
+      // Any pivot yet to be inspected has more than `count` non-zeros in both its row and column
+      if (pivot_row != -1 && (searched >= markowitz_search_limit || best_cost <= count * count)) break;
+    }
+    DELPI_ASSERT(pivot_row != -1, "A non-empty active submatrix must have a pivot");
+
+    Pivot& pivot = block.emplace_back();
+    pivot.row = rows[pivot_row];
+    pivot.column = columns[pivot_col];
+    const std::map<int, mpq_class>& pivot_entries = a[pivot_row];
+    const mpq_class& pivot_value = pivot_entries.at(pivot_col);
+    pivot.upper.reserve(pivot_entries.size());
+    pivot.upper.emplace_back(pivot.column, pivot_value);
+    for (const auto& [j, value] : pivot_entries) {
+      if (j != pivot_col) pivot.upper.emplace_back(columns[j], value);
+    }
+
+    // Remove the pivot row and column from the active submatrix
+    row_bucket[pivot_entries.size()].erase(pivot_row);
+    col_bucket[col_rows[pivot_col].size()].erase(pivot_col);
+    for (const auto& [j, value] : pivot_entries) {
+      if (j == pivot_col) continue;
+      col_bucket[col_rows[j].size()].erase(j);
+      col_rows[j].erase(pivot_row);
+      col_bucket[col_rows[j].size()].insert(j);
+    }
+
+    // Eliminate the pivot column from the other rows
+    pivot.lower.reserve(col_rows[pivot_col].size() - 1);
+    for (const int i : col_rows[pivot_col]) {
+      if (i == pivot_row) continue;
+      row_bucket[a[i].size()].erase(i);
+      const auto it = a[i].find(pivot_col);
+      const mpq_class factor{it->second / pivot_value};
+      a[i].erase(it);
+      for (const auto& [j, value] : pivot_entries) {
+        if (j == pivot_col) continue;
+        const auto [jt, inserted] = a[i].try_emplace(j, 0);
+        jt->second -= factor * value;
+        if (inserted != (jt->second == 0)) {
+          // Either a cancellation or a fill-in changes the number of non-zeros in column j
+          col_bucket[col_rows[j].size()].erase(j);
+          if (inserted) {
+            col_rows[j].insert(i);
+          } else {
+            col_rows[j].erase(i);
+          }
+          col_bucket[col_rows[j].size()].insert(j);
+        }
+        if (jt->second == 0) a[i].erase(jt);
+      }
+      row_bucket[a[i].size()].insert(i);
+      pivot.lower.emplace_back(rows[i], factor);
+    }
+    col_rows[pivot_col].clear();
+    a[pivot_row].clear();
+  }
+  return block;
+}
+
+std::vector<mpq_class> SparseLu::Solve(std::vector<mpq_class> b) const {
+  DELPI_ASSERT(!singular_, "Cannot solve a system with a singular matrix");
+  DELPI_ASSERT(static_cast<int>(b.size()) == size_, "Right-hand side size does not match the matrix");
+  std::vector<mpq_class> x(size_);
+  for (const Block& block : blocks_) {
+    // L z = b, overwriting b
+    for (const Pivot& pivot : block) {
+      if (b[pivot.row] == 0) continue;
+      for (const auto& [i, factor] : pivot.lower) b[i] -= factor * b[pivot.row];
+    }
+    // U x = z. The pivot row only contains columns pivoted later
+    for (auto it = block.rbegin(); it != block.rend(); ++it) {
+      mpq_class value{b[it->row]};
+      for (std::size_t k = 1; k < it->upper.size(); ++k) value -= it->upper[k].second * x[it->upper[k].first];
+      x[it->column] = value / it->upper.front().second;
+    }
+  }
+  return x;
+}
+
+std::vector<mpq_class> SparseLu::SolveTranspose(std::vector<mpq_class> c) const {
+  DELPI_ASSERT(!singular_, "Cannot solve a system with a singular matrix");
+  DELPI_ASSERT(static_cast<int>(c.size()) == size_, "Right-hand side size does not match the matrix");
+  std::vector<mpq_class> y(size_);
+  for (const Block& block : blocks_) {
+    // U^T z = c, overwriting c. z is stored in y at the index of the pivot row
+    for (const Pivot& pivot : block) {
+      mpq_class& z = y[pivot.row];
+      z = c[pivot.column] / pivot.upper.front().second;
+      if (z == 0) continue;
+      for (std::size_t k = 1; k < pivot.upper.size(); ++k) c[pivot.upper[k].first] -= pivot.upper[k].second * z;
+    }
+    // L^T y = z. The multipliers only refer to rows pivoted later
+    for (auto it = block.rbegin(); it != block.rend(); ++it) {
+      for (const auto& [i, factor] : it->lower) y[it->row] -= factor * y[i];
+    }
+  }
+  return y;
+}
+
+std::size_t SparseLu::num_nonzeros() const {
+  std::size_t nnz = 0;
+  for (const Block& block : blocks_) {
+    for (const Pivot& pivot : block) nnz += pivot.lower.size() + pivot.upper.size();
+  }
+  return nnz;
+}
+
+}  // namespace delpi
@@ -0,0 +1,96 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * SparseLu class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "delpi/libs/gmp.h"
+
+namespace delpi {
+
+/**
+ * Exact sparse LU factorisation of a square matrix over the rationals.
+ *
+ * The matrix is first split into independent blocks, i.e., the connected components of its row-column graph.
+ * Blocks share no row or column, so they are the disjoint subtrees of the elimination forest
+ * and are factorised in parallel when more than one thread is available.
+ * Each block is then factorised with a right-looking Gaussian elimination.
+ * Since the arithmetic is exact, any non-zero pivot is acceptable, and pivots are chosen only to limit the fill-in
+ * with the Markowitz criterion, i.e., the pivot @f$ a_{ij} @f$ that minimises @f$ (r_i - 1)(c_j - 1) @f$,
+ * where @f$ r_i @f$ and @f$ c_j @f$ are the number of non-zeros in the row and column of the active submatrix.
+ * @code
+ * // A = [[2, 0], [1, 1]]
+ * const SparseLu lu{{{{0, 2}, {1, 1}}, {{1, 1}}}};
+ * lu.Solve({4, 3});           // x = [2, 1]
+ * lu.SolveTranspose({4, 3});  // y = [1/2, 3]
+ * @endcode
+ */
+class SparseLu {
+ public:
+  using SparseVector = std::vector<std::pair<int, mpq_class>>;  ///< Sparse vector as (index, value) pairs
+
+  /**
+   * Factorise the square matrix with the given `columns`.
+   *
+   * Zero coefficients are ignored, while repeated indices in the same column are summed up.
+   * @param columns columns of the matrix. The i-th element contains the (row, value) pairs of the i-th column
+   * @param num_threads maximum number of threads used to factorise independent blocks
+   */
+  explicit SparseLu(const std::vector<SparseVector>& columns, unsigned int num_threads = 1);
+
+  /**
+   * Solve the system @f$ A x = b @f$.
+   * @pre The matrix is not singular
+   * @param b right-hand side, indexed by row
+   * @return solution, indexed by column
+   */
+  [[nodiscard]] std::vector<mpq_class> Solve(std::vector<mpq_class> b) const;
+  /**
+   * Solve the system @f$ A^T y = c @f$.
+   * @pre The matrix is not singular
+   * @param c right-hand side, indexed by column
+   * @return solution, indexed by row
+   */
+  [[nodiscard]] std::vector<mpq_class> SolveTranspose(std::vector<mpq_class> c) const;
+
+  /** @getter{order, matrix} */
+  [[nodiscard]] int size() const { return size_; }
+  /** @checker{singular, matrix} */
+  [[nodiscard]] bool singular() const { return singular_; }
+  /** @getter{number of independent blocks, matrix} */
+  [[nodiscard]] std::size_t num_blocks() const { return blocks_.size(); }
+  /** @getter{number of non-zeros in the L and U factors, factorisation} */
+  [[nodiscard]] std::size_t num_nonzeros() const;
+
+ private:
+  /** Elimination step of the factorisation. */
+  struct Pivot {
+    int row;             ///< Pivot row
+    int column;          ///< Pivot column
+    SparseVector lower;  ///< Multipliers used to eliminate the pivot column from the other rows, as (row, factor)
+    SparseVector upper;  ///< Pivot row in the active submatrix, as (column, value). The pivot comes first
+  };
+  using Block = std::vector<Pivot>;  ///< Elimination steps of an independent block, in order
+
+  /**
+   * Factorise the block made of the given `rows` and `columns` of the matrix.
+   * @param rows rows of the block
+   * @param columns columns of the block
+   * @param matrix columns of the whole matrix
+   * @return elimination steps of the block, or an empty vector if the block is singular
+   */
+  static Block FactoriseBlock(const std::vector<int>& rows, const std::vector<int>& columns,
+                              const std::vector<SparseVector>& matrix);
+
+  int size_;                   ///< Order of the matrix
+  bool singular_;              ///< Whether the matrix is singular
+  std::vector<Block> blocks_;  ///< Factorisation of each independent block
+};
+
+}  // namespace delpi
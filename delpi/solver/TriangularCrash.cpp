@@ -0,0 +1,105 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/solver/TriangularCrash.h"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+#include "delpi/util/logging.h"
+
+namespace delpi {
+
+namespace {
+
+constexpr double pivot_tolerance = 0.99;  ///< Smallest pivot allowed, relative to the largest entry of the column
+
+/**
+ * Non-basic status of a column or row with the given bounds.
+ * @param lb lower bound, if any
+ * @param ub upper bound, if any
+ * @return status at the lower bound if there is one, otherwise at the upper bound, or FREE if there are none
+ */
+BasisStatus NonBasicStatus(const std::optional<mpq_class>& lb, const std::optional<mpq_class>& ub) {
+  if (lb.has_value() && ub.has_value() && *lb == *ub) return BasisStatus::FIXED;
+  if (lb.has_value()) return BasisStatus::AT_LOWER;
+  if (ub.has_value()) return BasisStatus::AT_UPPER;
+  return BasisStatus::FREE;
+}
+
+/**
+ * Penalty of a column by the type of its bounds, as in Bixby's crash.
+ * @param column column of the problem
+ * @return 0 for a free column, 1 for a column with a single bound, 2 for a boxed one
+ */
+int BoundPenalty(const Column& column) {
+  return static_cast<int>(column.lb.has_value()) + static_cast<int>(column.ub.has_value());
+}
+
+}  // namespace
+
+TriangularCrash::TriangularCrash(const std::vector<Column>& columns, const std::vector<Row>& rows,
+                                 const std::unordered_map<Variable, int>& var_to_col)
+    : basis_{std::vector<BasisStatus>(columns.size()), std::vector<BasisStatus>(rows.size(), BasisStatus::BASIC)},
+      num_structural_{0} {
+  const std::size_t n = columns.size(), m = rows.size();
+  // Transpose the rows, keeping the magnitude of the entries only
+  std::vector<std::vector<std::pair<int, double>>> entries(n);
+  std::vector<int> row_count(m, 0);
+  for (std::size_t i = 0; i < m; ++i) {
+    for (const auto& [var, coeff] : rows[i].addends) {
+      if (coeff == 0) continue;
+      entries[var_to_col.at(var)].emplace_back(static_cast<int>(i), std::abs(coeff.get_d()));
+      ++row_count[i];
+    }
+  }
+
+  // Sort the candidate columns by bound penalty, then objective relative to the largest one, then number of non-zeros
+  double max_obj = 0;
+  for (const Column& column : columns) {
+    if (column.obj.has_value()) max_obj = std::max(max_obj, std::abs(column.obj->get_d()));
+  }
+  const auto obj_penalty = [&](const Column& column) {
+    return max_obj == 0 || !column.obj.has_value() ? 0.0 : column.obj->get_d() / max_obj;
+  };
+  std::vector<int> order;
+  order.reserve(n);
+  for (std::size_t j = 0; j < n; ++j) {
+    basis_.columns[j] = NonBasicStatus(columns[j].lb, columns[j].ub);
+    if (basis_.columns[j] != BasisStatus::FIXED && !entries[j].empty()) order.push_back(static_cast<int>(j));
+  }
+  std::ranges::stable_sort(order, [&](const int j1, const int j2) {
+    return std::tuple{BoundPenalty(columns[j1]), obj_penalty(columns[j1]), entries[j1].size()} <
+           std::tuple{BoundPenalty(columns[j2]), obj_penalty(columns[j2]), entries[j2].size()};
+  });
+
+  // Number of structural columns in the basis with a non-zero in each row
+  std::vector<int> basic_count(m, 0);
+  for (const int j : order) {
+    double max_entry = 0;
+    for (const auto& [i, value] : entries[j]) max_entry = std::max(max_entry, value);
+    // Equality rows first, then the sparsest. Free rows keep their slack in the basis
+    const auto preference = [&](const int i) { return std::pair{rows[i].lb != rows[i].ub, row_count[i]}; };
+    std::optional<int> pivot_row;
+    for (const auto& [i, value] : entries[j]) {
+      const Row& row = rows[i];
+      if (basic_count[i] != 0 || value < pivot_tolerance * max_entry || (!row.lb.has_value() && !row.ub.has_value()))
+        continue;
+      if (!pivot_row.has_value() || preference(i) < preference(*pivot_row)) pivot_row = i;
+    }
+    if (!pivot_row.has_value()) continue;
+
+    basis_.columns[j] = BasisStatus::BASIC;
+    basis_.rows[*pivot_row] = NonBasicStatus(rows[*pivot_row].lb, rows[*pivot_row].ub);
+    for (const auto& [i, value] : entries[j]) ++basic_count[i];
+    ++num_structural_;
+  }
+  DELPI_DEBUG_FMT("TriangularCrash::TriangularCrash: {} of {} columns in the basis of {} rows", num_structural_, n, m);
+}
+
+}  // namespace delpi
@@ -0,0 +1,57 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * TriangularCrash class.
+ */
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "delpi/solver/Basis.h"
+#include "delpi/solver/Column.h"
+#include "delpi/solver/Row.h"
+#include "delpi/symbolic/Variable.h"
+
+namespace delpi {
+
+/**
+ * Starting basis of an LP problem built from the sparsity pattern of its matrix, following Bixby's triangular crash.
+ *
+ * Starting from the slack basis, the columns are considered from the most to the least likely to be basic:
+ * free columns first, then the ones with a single bound, then the boxed ones, each group sorted by
+ * objective coefficient and number of non-zeros. Fixed columns are never basic.
+ * A column enters the basis if it has a large entry, within 1% of its largest one,
+ * in a row that no structural column in the basis touches yet.
+ * The slack of that row leaves the basis, preferring equality rows, whose slack can never be basic in a solution,
+ * and rows with few non-zeros.
+ * Since the pivot row of each new column is zero in all the previous ones, the basis matrix is triangular,
+ * hence never singular.
+ * @code
+ * const TriangularCrash crash{columns, rows, var_to_col};
+ * lp_solver.SetBasis(crash.basis());
+ * @endcode
+ */
+class TriangularCrash {
+ public:
+  /**
+   * Build the crash basis for the LP problem with the given `columns` and `rows`.
+   * @param columns columns of the problem
+   * @param rows rows of the problem
+   * @param var_to_col map from the variables to the index of their column
+   */
+  TriangularCrash(const std::vector<Column>& columns, const std::vector<Row>& rows,
+                  const std::unordered_map<Variable, int>& var_to_col);
+
+  /** @getter{starting basis\, with exactly as many basic statuses as the rows, crash} */
+  [[nodiscard]] const Basis& basis() const { return basis_; }
+  /** @getter{number of structural columns in the basis, crash} */
+  [[nodiscard]] int num_structural() const { return num_structural_; }
+
+ private:
+  Basis basis_;         ///< Starting basis
+  int num_structural_;  ///< Number of structural columns in the basis
+};
+
+}  // namespace delpi
@@ -6,7 +6,19 @@
  */
 #pragma once
 
+#include "delpi/solver/BackendSelector.h"
+#include "delpi/solver/Basis.h"
+#include "delpi/solver/BoundPropagation.h"
 #include "delpi/solver/Column.h"
+#include "delpi/solver/Decomposition.h"
+#include "delpi/solver/Dualization.h"
+#include "delpi/solver/IntegerRow.h"
 #include "delpi/solver/LpResult.h"
 #include "delpi/solver/LpSolver.h"
+#include "delpi/solver/ModelFeatures.h"
+#include "delpi/solver/Pdhg.h"
 #include "delpi/solver/Row.h"
+#include "delpi/solver/Scaling.h"
+#include "delpi/solver/Scenario.h"
+#include "delpi/solver/SensitivityAnalysis.h"
+#include "delpi/solver/TriangularCrash.h"
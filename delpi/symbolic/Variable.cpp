@@ -7,13 +7,19 @@
 
 #include <atomic>
 #include <limits>
+#include <mutex>
 #include <ostream>
 
 #include "delpi/util/error.h"
 
 namespace delpi {
 
+#ifdef DELPI_THREAD_SAFE
+std::deque<std::string> Variable::names_{{"dummy"}};
+std::shared_mutex Variable::names_mutex_;
+#else
 std::vector<std::string> Variable::names_{{"dummy"}};
+#endif
 const Variable::Id Variable::dummy_id{std::numeric_limits<Id>::max()};
 
 Variable::Id Variable::GetNextId() {
@@ -22,12 +28,24 @@ Variable::Id Variable::GetNextId() {
   return counter;
 }
 
-Variable::Variable(std::string name) : id_{GetNextId()} {
+Variable::Variable(std::string name) {
+#ifdef DELPI_THREAD_SAFE
+  // The id and the position in the names vector must be assigned atomically
+  std::unique_lock<std::shared_mutex> lock{names_mutex_};
+#endif
+  id_ = GetNextId();
   DELPI_ASSERT(id_ < std::numeric_limits<Id>::max(), "The ID of the variable has reached the maximum value.");
   names_.push_back(std::move(name));
   DELPI_ASSERT(names_.size() == id_ + 2u, "The size of the names vector is not equal to the ID + dummy string.");
 }
 
+const std::string &Variable::name() const {
+#ifdef DELPI_THREAD_SAFE
+  std::shared_lock<std::shared_mutex> lock{names_mutex_};
+#endif
+  return names_[id_ + 1];
+}
+
 std::ostream &operator<<(std::ostream &os, const Variable &var) { return os << var.name(); }
 
 }  // namespace delpi
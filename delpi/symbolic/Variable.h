@@ -9,7 +9,13 @@
 #include <cstddef>
 #include <iosfwd>
 #include <string>
+
+#ifdef DELPI_THREAD_SAFE
+#include <deque>
+#include <shared_mutex>
+#else
 #include <vector>
+#endif
 
 namespace delpi {
 
@@ -45,7 +51,7 @@ class Variable {
   /** @getter{id, variable} */
   [[nodiscard]] Id id() const { return id_; }
   /** @getter{name, variable} */
-  [[nodiscard]] const std::string &name() const { return names_[id_ + 1]; }
+  [[nodiscard]] const std::string &name() const;
 
   /** @equal_to{variable, Two variables are the same if their @ref id_ is the same, regardless of their name.} */
   [[nodiscard]] bool equal_to(const Variable &o) const noexcept { return id_ == o.id_; }
@@ -57,7 +63,12 @@ class Variable {
   Variable operator+() const { return *this; }
 
  private:
+#ifdef DELPI_THREAD_SAFE
+  static std::deque<std::string> names_;  ///< Names of all existing variables. Appending does not move the others.
+  static std::shared_mutex names_mutex_;  ///< Mutex protecting @ref names_ from concurrent access.
+#else
   static std::vector<std::string> names_;  ///< Names of all existing variables.
+#endif
   /**
    * Get the next unique identifier for a variable.
    * @return incremental unique identifier
@@ -97,19 +97,35 @@ void ArgParser::AddOptions() {
   DELPI_PARSE_PARAM_BOOL(parser_, continuous_output, "--continuous-output");
   DELPI_PARSE_PARAM_BOOL(parser_, debug_parsing, "--debug-parsing");
   DELPI_PARSE_PARAM_BOOL(parser_, debug_scanning, "--debug-scanning");
+  DELPI_PARSE_PARAM_BOOL(parser_, decompose, "--decompose");
+  DELPI_PARSE_PARAM_BOOL(parser_, features, "--features");
+  DELPI_PARSE_PARAM_BOOL(parser_, memory_lean, "--memory-lean");
   DELPI_PARSE_PARAM_BOOL(parser_, skip_optimise, "--skip-optimise");
   DELPI_PARSE_PARAM_BOOL(parser_, produce_models, "-m", "--produce-models");
   DELPI_PARSE_PARAM_BOOL(parser_, silent, "-s", "--silent");
   DELPI_PARSE_PARAM_BOOL(parser_, with_timings, "-t", "--timings");
   DELPI_PARSE_PARAM_BOOL(parser_, read_from_stdin, "--in");
   DELPI_PARSE_PARAM_BOOL(parser_, verify, "--verify");
+  DELPI_PARSE_PARAM_BOOL(parser_, scaling, "--scaling");
+  DELPI_PARSE_PARAM_BOOL(parser_, scenarios, "--scenarios");
+  DELPI_PARSE_PARAM_BOOL(parser_, sensitivity, "--sensitivity");
+  DELPI_PARSE_PARAM_BOOL(parser_, server, "--server");
 
-  //  DELPI_PARSE_PARAM_SCAN(parser_, number_of_jobs, 'i', unsigned int, "-j", "--jobs");
+  DELPI_PARSE_PARAM_SCAN(parser_, cache_size, 'i', unsigned int, "--cache-size");
+  DELPI_PARSE_PARAM_SCAN(parser_, number_of_jobs, 'i', unsigned int, "-j", "--jobs");
+  DELPI_PARSE_PARAM_SCAN(parser_, pdhg_iterations, 'i', unsigned int, "--pdhg-iterations");
+  DELPI_PARSE_PARAM_SCAN(parser_, pdhg_tolerance, 'g', double, "--pdhg-tolerance");
   DELPI_PARSE_PARAM_SCAN(parser_, precision, 'g', double, "-p", "--precision");
+  DELPI_PARSE_PARAM_SCAN(parser_, propagation_rounds, 'i', unsigned int, "--propagation-rounds");
   DELPI_PARSE_PARAM_SCAN(parser_, random_seed, 'i', unsigned int, "-r", "--random-seed");
+  DELPI_PARSE_PARAM_SCAN(parser_, restarts, 'i', unsigned int, "--restarts");
   DELPI_PARSE_PARAM_SCAN(parser_, timeout, 'i', unsigned int, "--timeout");
   DELPI_PARSE_PARAM_SCAN(parser_, verbose_simplex, 'i', int, "--verbose-simplex");
 
+  parser_.add_argument("--cache-dir").help(std::string{Config::help_cache_dir}).default_value("").nargs(1);
+  parser_.add_argument("--socket").help(std::string{Config::help_server_socket}).default_value("").nargs(1);
+  parser_.add_argument("--lp-solver-rules").help(std::string{Config::help_lp_solver_rules}).default_value("").nargs(1);
+
   parser_.add_argument("-V", "--verbose")
       .help("increase verbosity level. Can be used multiple times. Maximum verbosity level is 5 and default is 2")
       .action([this](const auto &) {
@@ -127,19 +143,42 @@ void ArgParser::AddOptions() {
 
   DELPI_PARSE_PARAM_ENUM(
       parser_, lp_mode, "--lp-mode",
-      "[ auto | pure-precision-boosting | pure-iterative-refinement | hybrid ] or [ 1 | 2 | 3 | 4 ]",
+      "[ auto | pure-precision-boosting | pure-iterative-refinement | hybrid | float-first ] or [ 1 | 2 | 3 | 4 | 5 ]",
       if (value == "auto" || value == "1") return Config::LpMode::AUTO;
       if (value == "pure-precision-boosting" || value == "2") return Config::LpMode::PURE_PRECISION_BOOSTING;
       if (value == "pure-iterative-refinement" || value == "3") return Config::LpMode::PURE_ITERATIVE_REFINEMENT;
-      if (value == "hybrid" || value == "4") return Config::LpMode::HYBRID;);  // NOLINT(readability/braces)
+      if (value == "hybrid" || value == "4") return Config::LpMode::HYBRID;
+      if (value == "float-first" || value == "5") return Config::LpMode::FLOAT_FIRST;);  // NOLINT(readability/braces)
+  DELPI_PARSE_PARAM_ENUM(
+      parser_, dualize, "--dualize", "[ auto | on | off ] or [ 1 | 2 | 3 ]",
+      if (value == "auto" || value == "1") return Config::Dualize::AUTO;
+      if (value == "on" || value == "2") return Config::Dualize::ON;
+      if (value == "off" || value == "3") return Config::Dualize::OFF;);  // NOLINT(readability/braces)
   DELPI_PARSE_PARAM_ENUM(
       parser_, format, "--format", "[ auto | mps ] or [ 1 | 2 ]",
       if (value == "auto" || value == "1") return Config::Format::AUTO;
       if (value == "mps" || value == "2") return Config::Format::MPS;);  // NOLINT(readability/braces)
   DELPI_PARSE_PARAM_ENUM(
-      parser_, lp_solver, "--lp-solver", "[ soplex | qsoptex ] or [ 1 | 2 ]",
+      parser_, lp_solver, "--lp-solver", "[ soplex | qsoptex | auto ] or [ 1 | 2 | 3 ]",
       if (value == "soplex" || value == "1") return Config::LpSolver::SOPLEX;
-      if (value == "qsoptex" || value == "2") return Config::LpSolver::QSOPTEX;);  // NOLINT(readability/braces)
+      if (value == "qsoptex" || value == "2") return Config::LpSolver::QSOPTEX;
+      if (value == "auto" || value == "3") return Config::LpSolver::AUTO;);  // NOLINT(readability/braces)
+  DELPI_PARSE_PARAM_ENUM(
+      parser_, warm_start, "--warm-start", "[ none | pdhg | crash ] or [ 1 | 2 | 3 ]",
+      if (value == "none" || value == "1") return Config::WarmStart::NONE;
+      if (value == "pdhg" || value == "2") return Config::WarmStart::PDHG;
+      if (value == "crash" || value == "3") return Config::WarmStart::CRASH;);  // NOLINT(readability/braces)
+  DELPI_PARSE_PARAM_ENUM(
+      parser_, simplex, "--simplex", "[ auto | primal | dual ] or [ 1 | 2 | 3 ]",
+      if (value == "auto" || value == "1") return Config::SimplexAlgorithm::AUTO;
+      if (value == "primal" || value == "2") return Config::SimplexAlgorithm::PRIMAL;
+      if (value == "dual" || value == "3") return Config::SimplexAlgorithm::DUAL;);  // NOLINT(readability/braces)
+  DELPI_PARSE_PARAM_ENUM(
+      parser_, pricing, "--pricing", "[ auto | dantzig | devex | steepest ] or [ 1 | 2 | 3 | 4 ]",
+      if (value == "auto" || value == "1") return Config::Pricing::AUTO;
+      if (value == "dantzig" || value == "2") return Config::Pricing::DANTZIG;
+      if (value == "devex" || value == "3") return Config::Pricing::DEVEX;
+      if (value == "steepest" || value == "4") return Config::Pricing::STEEPEST;);  // NOLINT(readability/braces)
   DELPI_TRACE("ArgParser::ArgParser: added all arguments");
 }
 
@@ -147,25 +186,44 @@ Config ArgParser::ToConfig() const {
   DELPI_TRACE("ArgParser::ToConfig: converting to Config");
   Config config{};
 
+  DELPI_PARAM_TO_CONFIG("cache-dir", cache_dir, std::string);
+  DELPI_PARAM_TO_CONFIG("cache-size", cache_size, unsigned int);
   DELPI_PARAM_TO_CONFIG("csv", csv, bool);
   DELPI_PARAM_TO_CONFIG("continuous-output", continuous_output, bool);
   DELPI_PARAM_TO_CONFIG("debug-parsing", debug_parsing, bool);
   DELPI_PARAM_TO_CONFIG("debug-scanning", debug_scanning, bool);
+  DELPI_PARAM_TO_CONFIG("decompose", decompose, bool);
+  DELPI_PARAM_TO_CONFIG("dualize", dualize, Config::Dualize);
+  DELPI_PARAM_TO_CONFIG("features", features, bool);
   config.m_filename().SetFromCommandLine(parser_.is_used("file") ? parser_.get<std::string>("file") : "");
   DELPI_PARAM_TO_CONFIG("format", format, Config::Format);
   DELPI_PARAM_TO_CONFIG("lp-mode", lp_mode, Config::LpMode);
   DELPI_PARAM_TO_CONFIG("lp-solver", lp_solver, Config::LpSolver);
-  // DELPI_PARAM_TO_CONFIG("jobs", number_of_jobs, unsigned int);
+  DELPI_PARAM_TO_CONFIG("lp-solver-rules", lp_solver_rules, std::string);
+  DELPI_PARAM_TO_CONFIG("memory-lean", memory_lean, bool);
+  DELPI_PARAM_TO_CONFIG("jobs", number_of_jobs, unsigned int);
+  DELPI_PARAM_TO_CONFIG("pdhg-iterations", pdhg_iterations, unsigned int);
+  DELPI_PARAM_TO_CONFIG("pdhg-tolerance", pdhg_tolerance, double);
   DELPI_PARAM_TO_CONFIG("skip-optimise", skip_optimise, bool);
+  DELPI_PARAM_TO_CONFIG("pricing", pricing, Config::Pricing);
   DELPI_PARAM_TO_CONFIG("precision", precision, double);
   DELPI_PARAM_TO_CONFIG("produce-models", produce_models, bool);
+  DELPI_PARAM_TO_CONFIG("propagation-rounds", propagation_rounds, unsigned int);
   DELPI_PARAM_TO_CONFIG("random-seed", random_seed, unsigned int);
   DELPI_PARAM_TO_CONFIG("in", read_from_stdin, bool);
+  DELPI_PARAM_TO_CONFIG("restarts", restarts, unsigned int);
+  DELPI_PARAM_TO_CONFIG("scaling", scaling, bool);
+  DELPI_PARAM_TO_CONFIG("scenarios", scenarios, bool);
+  DELPI_PARAM_TO_CONFIG("sensitivity", sensitivity, bool);
+  DELPI_PARAM_TO_CONFIG("server", server, bool);
+  DELPI_PARAM_TO_CONFIG("socket", server_socket, std::string);
+  DELPI_PARAM_TO_CONFIG("simplex", simplex, Config::SimplexAlgorithm);
   DELPI_PARAM_TO_CONFIG("silent", silent, bool);
   DELPI_PARAM_TO_CONFIG("timeout", timeout, unsigned int);
   config.m_verbose_delpi().SetFromCommandLine(verbosity_);
   DELPI_PARAM_TO_CONFIG("verbose-simplex", verbose_simplex, int);
   DELPI_PARAM_TO_CONFIG("verify", verify, bool);
+  DELPI_PARAM_TO_CONFIG("warm-start", warm_start, Config::WarmStart);
   DELPI_PARAM_TO_CONFIG("timings", with_timings, bool);
 
   DELPI_TRACE_FMT("ArgParser::ToConfig: {}", config);
@@ -176,8 +234,18 @@ void ArgParser::ValidateOptions() {
   DELPI_TRACE("ArgParser::ValidateOptions: validating options");
   if (parser_.is_used("in") && parser_.is_used("file"))
     DELPI_INVALID_ARGUMENT("--in", "--in and file are mutually exclusive");
-  if (!parser_.is_used("in") && !parser_.is_used("file"))
-    DELPI_INVALID_ARGUMENT("file", "must be specified unless --in is used");
+  if (parser_.is_used("server") && (parser_.is_used("in") || parser_.is_used("file")))
+    DELPI_INVALID_ARGUMENT("--server", "the input is received through the server requests");
+  if (parser_.is_used("socket") && !parser_.is_used("server"))
+    DELPI_INVALID_ARGUMENT("--socket", "can only be used with --server");
+  if (parser_.is_used("scenarios") && parser_.is_used("server"))
+    DELPI_INVALID_ARGUMENT("--scenarios", "cannot be used with --server");
+  if (parser_.is_used("sensitivity") && (parser_.is_used("scenarios") || parser_.is_used("server")))
+    DELPI_INVALID_ARGUMENT("--sensitivity", "cannot be used with --scenarios or --server");
+  if (parser_.is_used("decompose") && (parser_.is_used("scenarios") || parser_.is_used("server")))
+    DELPI_INVALID_ARGUMENT("--decompose", "cannot be used with --scenarios or --server");
+  if (!parser_.is_used("server") && !parser_.is_used("in") && !parser_.is_used("file"))
+    DELPI_INVALID_ARGUMENT("file", "must be specified unless --in or --server is used");
   if (parser_.is_used("in") && (parser_.get<Config::Format>("format") == Config::Format::AUTO))
     DELPI_INVALID_ARGUMENT("--in", "a format must be specified with --format");
   // Check file extension if a file is provided
@@ -191,6 +259,25 @@ void ArgParser::ValidateOptions() {
       DELPI_INVALID_ARGUMENT("file", "cannot find file or the file is not a regular file");
   }
   if (parser_.get<double>("precision") < 0) DELPI_INVALID_ARGUMENT("--precision", "cannot be negative");
+  if (parser_.is_used("cache-size") && !parser_.is_used("cache-dir"))
+    DELPI_INVALID_ARGUMENT("--cache-size", "can only be used with --cache-dir");
+  if (parser_.is_used("lp-solver-rules")) {
+    if (parser_.get<Config::LpSolver>("lp-solver") != Config::LpSolver::AUTO)
+      DELPI_INVALID_ARGUMENT("--lp-solver-rules", "can only be used with --lp-solver auto");
+    if (!std::filesystem::is_regular_file(parser_.get<std::string>("lp-solver-rules")))
+      DELPI_INVALID_ARGUMENT("--lp-solver-rules", "cannot find file or the file is not a regular file");
+  }
+  if (parser_.get<Config::LpSolver>("lp-solver") == Config::LpSolver::AUTO && parser_.is_used("server"))
+    DELPI_INVALID_ARGUMENT("--lp-solver", "auto cannot be used with --server");
+  if (parser_.is_used("features") && parser_.is_used("server"))
+    DELPI_INVALID_ARGUMENT("--features", "cannot be used with --server");
+  if (parser_.get<unsigned int>("jobs") == 0) DELPI_INVALID_ARGUMENT("--jobs", "must be at least 1");
+  if (parser_.get<unsigned int>("restarts") == 0) DELPI_INVALID_ARGUMENT("--restarts", "must be at least 1");
+  if (parser_.is_used("pdhg-iterations") && parser_.get<Config::WarmStart>("warm-start") != Config::WarmStart::PDHG)
+    DELPI_INVALID_ARGUMENT("--pdhg-iterations", "can only be used with --warm-start pdhg");
+  if (parser_.is_used("pdhg-tolerance") && parser_.get<Config::WarmStart>("warm-start") != Config::WarmStart::PDHG)
+    DELPI_INVALID_ARGUMENT("--pdhg-tolerance", "can only be used with --warm-start pdhg");
+  if (parser_.get<double>("pdhg-tolerance") <= 0) DELPI_INVALID_ARGUMENT("--pdhg-tolerance", "must be positive");
   if (parser_.is_used("verbose") && parser_.is_used("silent"))
     DELPI_INVALID_ARGUMENT("--verbose", "verbosity is forcefully set to 0 if --silent is provided");
   if (parser_.is_used("quiet") && parser_.is_used("silent"))
@@ -44,6 +44,8 @@ std::ostream &operator<<(std::ostream &os, const Config::LpSolver &lp_solver) {
       return os << "qsoptex";
     case Config::LpSolver::SOPLEX:
       return os << "soplex";
+    case Config::LpSolver::AUTO:
+      return os << "auto";
     default:
       DELPI_UNREACHABLE();
   }
@@ -70,6 +72,62 @@ std::ostream &operator<<(std::ostream &os, const Config::LpMode &mode) {
       return os << "I";
     case Config::LpMode::HYBRID:
       return os << "H";
+    case Config::LpMode::FLOAT_FIRST:
+      return os << "F";
+    default:
+      DELPI_UNREACHABLE();
+  }
+}
+
+std::ostream &operator<<(std::ostream &os, const Config::Dualize &dualize) {
+  switch (dualize) {
+    case Config::Dualize::AUTO:
+      return os << "auto";
+    case Config::Dualize::ON:
+      return os << "on";
+    case Config::Dualize::OFF:
+      return os << "off";
+    default:
+      DELPI_UNREACHABLE();
+  }
+}
+
+std::ostream &operator<<(std::ostream &os, const Config::WarmStart &warm_start) {
+  switch (warm_start) {
+    case Config::WarmStart::NONE:
+      return os << "none";
+    case Config::WarmStart::PDHG:
+      return os << "pdhg";
+    case Config::WarmStart::CRASH:
+      return os << "crash";
+    default:
+      DELPI_UNREACHABLE();
+  }
+}
+
+std::ostream &operator<<(std::ostream &os, const Config::SimplexAlgorithm &simplex) {
+  switch (simplex) {
+    case Config::SimplexAlgorithm::AUTO:
+      return os << "auto";
+    case Config::SimplexAlgorithm::PRIMAL:
+      return os << "primal";
+    case Config::SimplexAlgorithm::DUAL:
+      return os << "dual";
+    default:
+      DELPI_UNREACHABLE();
+  }
+}
+
+std::ostream &operator<<(std::ostream &os, const Config::Pricing &pricing) {
+  switch (pricing) {
+    case Config::Pricing::AUTO:
+      return os << "auto";
+    case Config::Pricing::DANTZIG:
+      return os << "dantzig";
+    case Config::Pricing::DEVEX:
+      return os << "devex";
+    case Config::Pricing::STEEPEST:
+      return os << "steepest";
     default:
       DELPI_UNREACHABLE();
   }
@@ -77,25 +135,44 @@ std::ostream &operator<<(std::ostream &os, const Config::LpMode &mode) {
 
 std::ostream &operator<<(std::ostream &os, const Config &config) {
   return os << "Config {\n"
+            << "cache_dir = '" << config.cache_dir() << "',\n"
+            << "cache_size = " << config.cache_size() << ",\n"
             << "csv = " << config.csv() << ",\n"
             << "continuous_output = " << config.continuous_output() << ",\n"
             << "debug_parsing = " << config.debug_parsing() << ",\n"
             << "debug_scanning = " << config.debug_scanning() << ",\n"
+            << "decompose = " << config.decompose() << ",\n"
+            << "dualize = '" << config.dualize() << "',\n"
+            << "features = " << config.features() << ",\n"
             << "filename = '" << config.filename() << "',\n"
             << "format = '" << config.format() << "',\n"
             << "lp_mode = '" << config.lp_mode() << "',\n"
             << "lp_solver = " << config.lp_solver() << ",\n"
+            << "lp_solver_rules = '" << config.lp_solver_rules() << "',\n"
+            << "memory_lean = " << config.memory_lean() << ",\n"
             << "number_of_jobs = " << config.number_of_jobs() << ",\n"
+            << "pdhg_iterations = " << config.pdhg_iterations() << ",\n"
+            << "pdhg_tolerance = " << config.pdhg_tolerance() << ",\n"
             << "skip_optimise = '" << config.skip_optimise() << "',\n"
+            << "pricing = '" << config.pricing() << "',\n"
             << "precision = " << config.precision() << ",\n"
             << "produce_model = " << config.produce_models() << ",\n"
+            << "propagation_rounds = " << config.propagation_rounds() << ",\n"
             << "random_seed = " << config.random_seed() << ",\n"
             << "read_from_stdin = " << config.read_from_stdin() << ",\n"
+            << "restarts = " << config.restarts() << ",\n"
+            << "scaling = " << config.scaling() << ",\n"
+            << "scenarios = " << config.scenarios() << ",\n"
+            << "sensitivity = " << config.sensitivity() << ",\n"
+            << "server = " << config.server() << ",\n"
+            << "server_socket = '" << config.server_socket() << "',\n"
+            << "simplex = '" << config.simplex() << "',\n"
             << "silent = " << config.silent() << ",\n"
             << "timeout = " << config.timeout() << ",\n"
             << "verbose_delpi = " << config.verbose_delpi() << ",\n"
             << "verbose_simplex = " << config.verbose_simplex() << ",\n"
             << "verify = " << config.verify() << ",\n"
+            << "warm_start = '" << config.warm_start() << "',\n"
             << "with_timings = " << config.with_timings() << ",\n"
             << '}';
 }
@@ -39,6 +39,7 @@ class Config {
   enum class LpSolver {
     SOPLEX,   ///< Soplex Solver. Default option
     QSOPTEX,  ///< Qsoptex Solver
+    AUTO,     ///< Pick the LP solver and its mode based on the features of the problem
   };
   /** Format of the input file. */
   enum class Format {
@@ -51,6 +52,33 @@ class Config {
     PURE_PRECISION_BOOSTING = 1,    ///< Use the precision boosting mode, if available
     PURE_ITERATIVE_REFINEMENT = 2,  ///< Use the iterative refinement mode, if available
     HYBRID = 3,                     ///< Use both modes, if available
+    FLOAT_FIRST = 4,                ///< Solve in floating point first and certify the basis exactly, if available
+  };
+  /** Whether the LP solver solves the dual of the problem instead of the problem itself. */
+  enum class Dualize {
+    AUTO,  ///< Solve the dual problem if the rows greatly outnumber the columns. Default option
+    ON,    ///< Always solve the dual problem
+    OFF,   ///< Never solve the dual problem
+  };
+  /** How the starting basis of the LP solver is computed before the first solve. */
+  enum class WarmStart {
+    NONE,   ///< Start from the default basis of the LP solver. Default option
+    PDHG,   ///< Start from a basis built from the approximate solution found by the PDHG method
+    CRASH,  ///< Start from a triangular basis built from the sparsity pattern of the matrix
+  };
+
+  /** Variant of the simplex algorithm used by the LP solver. */
+  enum class SimplexAlgorithm {
+    AUTO,    ///< Dual after bound-only changes, primal after objective-only changes, else the LP solver's. Default
+    PRIMAL,  ///< Always use the primal simplex
+    DUAL,    ///< Always use the dual simplex
+  };
+  /** Pricing strategy used by the simplex algorithm to pick the entering or leaving variable. */
+  enum class Pricing {
+    AUTO,      ///< Let the LP solver choose the pricing strategy. Default option
+    DANTZIG,   ///< Largest reduced cost or infeasibility
+    DEVEX,     ///< Devex approximation of the steepest edge
+    STEEPEST,  ///< Steepest edge
   };
 
   /** @constructor{Config} */
@@ -73,6 +101,13 @@ class Config {
 
  public:
   static constexpr std::string_view help_filename{"Input file name"};
+  static constexpr std::string_view help_cache_dir{
+      "Directory of the on-disk result cache. If empty, results are not cached"};
+  static constexpr std::string_view help_server_socket{
+      "Path of the UNIX socket the server will listen on. If empty, the server reads from the standard input"};
+  static constexpr std::string_view help_lp_solver_rules{
+      "CSV file with the rules used to pick the LP solver and its mode. If empty, the default rules are used.\n"
+      "\t\tOnly used with --lp-solver auto"};
 
   /** @getter{`filename` parameter, configuration, Default to ""}*/
   [[nodiscard]] const std::string &filename() const { return filename_.get(); }
@@ -80,6 +115,18 @@ class Config {
   [[nodiscard]] std::string filename_extension() const;
   /** @getsetter{`filename` extension, configuration, Contains the @ref filename substring after the dot.}*/
   OptionValue<std::string> &m_filename() { return filename_; }
+  /** @getter{`cache_dir` parameter, configuration, Default to ""}*/
+  [[nodiscard]] const std::string &cache_dir() const { return cache_dir_.get(); }
+  /** @getsetter{`cache_dir` parameter, configuration, Default to ""}*/
+  OptionValue<std::string> &m_cache_dir() { return cache_dir_; }
+  /** @getter{`server_socket` parameter, configuration, Default to ""}*/
+  [[nodiscard]] const std::string &server_socket() const { return server_socket_.get(); }
+  /** @getsetter{`server_socket` parameter, configuration, Default to ""}*/
+  OptionValue<std::string> &m_server_socket() { return server_socket_; }
+  /** @getter{`lp_solver_rules` parameter, configuration, Default to ""}*/
+  [[nodiscard]] const std::string &lp_solver_rules() const { return lp_solver_rules_.get(); }
+  /** @getsetter{`lp_solver_rules` parameter, configuration, Default to ""}*/
+  OptionValue<std::string> &m_lp_solver_rules() { return lp_solver_rules_; }
   /**
    * @getter{actual `lp_mode` parameter, configuration,
      If the lp_mode is LPMode::AUTO\, it will return the appropriate mode based on the lp_solver}
@@ -93,24 +140,52 @@ class Config {
 
  private:
   OptionValue<std::string> filename_{""};
+  OptionValue<std::string> cache_dir_{""};
+  OptionValue<std::string> server_socket_{""};
+  OptionValue<std::string> lp_solver_rules_{""};
 
+  DELPI_PARAMETER(cache_size, unsigned int, 1024u,
+                  "Maximum size of the result cache in MB. The least recently used results are evicted first.\n"
+                  "\t\t0 means no limit. Only used if --cache-dir is provided")
   DELPI_PARAMETER(continuous_output, bool, false, "Continuous output")
-  DELPI_PARAMETER(csv, bool, false, "Produce CSV output. Must also specify --with-timings to get the time stats")
+  DELPI_PARAMETER(csv, bool, false, "Print the time stats in CSV instead of JSON format. Must also specify --timings")
   DELPI_PARAMETER(debug_parsing, bool, false, "Debug parsing")
   DELPI_PARAMETER(debug_scanning, bool, false, "Debug scanning/lexing")
+  DELPI_PARAMETER(decompose, bool, false,
+                  "Split the problem into independent blocks of rows and columns and solve each block on its own,\n"
+                  "\t\tin parallel if more than one job is available")
+  DELPI_PARAMETER(dualize, Dualize, delpi::Config::Dualize::AUTO,
+                  "Solve the dual of the problem instead, mapping its solution back to the original problem.\n"
+                  "\t\tWith auto, only if there are at least 1000 rows and they are at least 10 times the columns.\n"
+                  "\t\tOne of: auto (1), on (2), off (3)")
+  DELPI_PARAMETER(features, bool, false,
+                  "Print the features of the problem used to pick the LP solver before solving it.\n"
+                  "\t\tIn CSV format if --csv is set")
   DELPI_PARAMETER(format, Format, delpi::Config::Format::AUTO,
                   "Input file format\n"
                   "\t\tOne of: auto (1), mps (2)")
   DELPI_PARAMETER(lp_mode, LpMode, delpi::Config::LpMode::AUTO,
                   "LP mode used by the LP solver.\n"
-                  "\t\tOne of: auto (1), pure-precision-boosting (2), pure-iterative-refinement (3), hybrid (4)")
+                  "\t\tOne of: auto (1), pure-precision-boosting (2), pure-iterative-refinement (3), hybrid (4), "
+                  "float-first (5)")
   DELPI_PARAMETER(lp_solver, LpSolver, delpi::Config::LpSolver::SOPLEX,
                   "Underlying LP solver used by the theory solver.\n"
-                  "\t\tOne of: soplex (1), qsoptex (2)")
+                  "\t\tWith auto, the LP solver and the LP mode are picked based on the features of the problem.\n"
+                  "\t\tOne of: soplex (1), qsoptex (2), auto (3)")
+  DELPI_PARAMETER(memory_lean, bool, false,
+                  "Stream the problem straight into the LP solver instead of staging it until the first solve.\n"
+                  "\t\tLowers the peak memory on large problems at the cost of a slower loading. Only affects soplex")
   DELPI_PARAMETER(number_of_jobs, unsigned int, 1u, "Number of jobs")
+  DELPI_PARAMETER(pdhg_iterations, unsigned int, 10000u,
+                  "Maximum number of iterations of the PDHG method. Only used if --warm-start is pdhg")
+  DELPI_PARAMETER(pdhg_tolerance, double, 1e-4,
+                  "Relative KKT error at which the PDHG method stops. Only used if --warm-start is pdhg")
   DELPI_PARAMETER(skip_optimise, bool, false,
                   "Whether to skip the objective function, turning the optimisation in a feasibility problem. "
                   "Only affects the MPS format")
+  DELPI_PARAMETER(pricing, Pricing, delpi::Config::Pricing::AUTO,
+                  "Pricing strategy used by the simplex algorithm of the LP solver.\n"
+                  "\t\tOne of: auto (1), dantzig (2), devex (3), steepest (4)")
   DELPI_PARAMETER(precision, double, 9.999999999999996e-4,
                   "Delta precision used by the LP solver solver.\n"
                   "\t\tEven when set to 0, a positive infinitesimal value will be considered.\n"
@@ -119,9 +194,35 @@ class Config {
   DELPI_PARAMETER(produce_models, bool, false,
                   "Produce models, showing a valid assignment.\n"
                   "\t\tOnly applicable if the result is sat or delta-sat")
+  DELPI_PARAMETER(propagation_rounds, unsigned int, 0u,
+                  "Maximum number of rounds of exact bound propagation over the rows before each solve.\n"
+                  "\t\tThe column bounds implied by the rows are tightened before the LP solver sees them. "
+                  "0 disables it")
   DELPI_PARAMETER(random_seed, unsigned int, 0u,
-                  "Set the random seed. 0 means that the seed will be generated on the fly")
+                  "Set the random seed, used by the LP solver for perturbation and by the copies of --restarts.\n"
+                  "\t\t0 means that the LP solver keeps its default seed, while the generator picks one on the fly")
   DELPI_PARAMETER(read_from_stdin, bool, false, "Read the input from the standard input")
+  DELPI_PARAMETER(restarts, unsigned int, 1u,
+                  "Number of differently seeded copies of the LP solver racing on each solve.\n"
+                  "\t\tAt most --jobs copies run at the same time. The result of the first one to finish is kept. "
+                  "1 means no race")
+  DELPI_PARAMETER(scaling, bool, false,
+                  "Scale rows and columns by exact powers of two before handing the problem to the LP solver.\n"
+                  "\t\tThe scaled problem is equivalent to the original one, and its solution is mapped back exactly")
+  DELPI_PARAMETER(scenarios, bool, false,
+                  "Collect every RHS and BOUNDS set of the MPS file as a separate scenario over the same matrix,\n"
+                  "\t\tthen solve all of them instead of the base problem. Only affects the MPS format")
+  DELPI_PARAMETER(sensitivity, bool, false,
+                  "After an optimal solve, print the ranges over which the objective coefficient of each column\n"
+                  "\t\tand the right-hand side of each row can move while the final basis stays optimal")
+  DELPI_PARAMETER(server, bool, false,
+                  "Run as a persistent server, solving the framed requests received from the standard input\n"
+                  "\t\tor from the UNIX socket specified with --socket")
+  DELPI_PARAMETER(simplex, SimplexAlgorithm, delpi::Config::SimplexAlgorithm::AUTO,
+                  "Simplex algorithm used by the LP solver.\n"
+                  "\t\tWith auto, the dual simplex is used if only bounds have changed since the last solve,\n"
+                  "\t\tthe primal simplex if only the objective has changed, the LP solver's default otherwise.\n"
+                  "\t\tOne of: auto (1), primal (2), dual (3)")
   DELPI_PARAMETER(silent, bool, false, "Silent mode. Nothing will be printed on the standard output")
   DELPI_PARAMETER(
       timeout, unsigned int, 0,
@@ -129,6 +230,12 @@ class Config {
   DELPI_PARAMETER(verbose_delpi, int, 2, "Verbosity level for delpi. In the range [0, 5]")
   DELPI_PARAMETER(verbose_simplex, int, 0, "Verbosity level for simplex. In the range [0, 5]")
   DELPI_PARAMETER(verify, bool, false, "If the input produces a SAT output, verify the assignment against the input")
+  DELPI_PARAMETER(warm_start, WarmStart, delpi::Config::WarmStart::NONE,
+                  "How the starting basis of the LP solver is computed before the first solve.\n"
+                  "\t\tWith pdhg, a basis is built from the approximate solution of a first-order method in double "
+                  "precision.\n"
+                  "\t\tWith crash, a triangular basis is built from the sparsity pattern of the matrix.\n"
+                  "\t\tOne of: none (1), pdhg (2), crash (3)")
   DELPI_PARAMETER(with_timings, bool, false, "Report timings alongside results")
 };
 
@@ -136,6 +243,10 @@ std::ostream &operator<<(std::ostream &os, const Config &config);
 std::ostream &operator<<(std::ostream &os, const Config::LpSolver &lp_solver);
 std::ostream &operator<<(std::ostream &os, const Config::Format &format);
 std::ostream &operator<<(std::ostream &os, const Config::LpMode &mode);
+std::ostream &operator<<(std::ostream &os, const Config::Dualize &dualize);
+std::ostream &operator<<(std::ostream &os, const Config::WarmStart &warm_start);
+std::ostream &operator<<(std::ostream &os, const Config::SimplexAlgorithm &simplex);
+std::ostream &operator<<(std::ostream &os, const Config::Pricing &pricing);
 
 }  // namespace delpi
 
@@ -147,5 +258,9 @@ OSTREAM_FORMATTER(delpi::Config);
 OSTREAM_FORMATTER(delpi::Config::LpSolver);
 OSTREAM_FORMATTER(delpi::Config::Format);
 OSTREAM_FORMATTER(delpi::Config::LpMode);
+OSTREAM_FORMATTER(delpi::Config::Dualize);
+OSTREAM_FORMATTER(delpi::Config::WarmStart);
+OSTREAM_FORMATTER(delpi::Config::SimplexAlgorithm);
+OSTREAM_FORMATTER(delpi::Config::Pricing);
 
 #endif
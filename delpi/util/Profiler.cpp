@@ -0,0 +1,156 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/util/Profiler.h"
+
+#include <algorithm>
+#include <ostream>
+
+#include "delpi/util/error.h"
+
+namespace delpi {
+
+namespace {
+
+void WriteJsonPhase(std::ostream& os, const Profiler::Phase& phase) {
+  os << "{\"name\":\"" << phase.name << "\",\"calls\":" << phase.calls << ",\"seconds\":" << phase.timer.seconds()
+     << ",\"counters\":{";
+  for (std::size_t i = 0; i < phase.counters.size(); ++i) {
+    if (i > 0) os << ",";
+    os << "\"" << phase.counters[i].first << "\":" << phase.counters[i].second;
+  }
+  os << "},\"phases\":[";
+  for (std::size_t i = 0; i < phase.children.size(); ++i) {
+    if (i > 0) os << ",";
+    WriteJsonPhase(os, *phase.children[i]);
+  }
+  os << "]}";
+}
+
+void WriteCsvPhase(std::ostream& os, const Profiler::Phase& phase, const std::string& path) {
+  os << path << ",calls," << phase.calls << "\n";
+  os << path << ",seconds," << phase.timer.seconds() << "\n";
+  for (const auto& [name, value] : phase.counters) os << path << "," << name << "," << value << "\n";
+  for (const auto& child : phase.children) WriteCsvPhase(os, *child, path + "/" + child->name);
+}
+
+/**
+ * Accumulate the counters and the nested phases of `from` into `to`.
+ * @param to phase to accumulate into
+ * @param from phase to accumulate
+ */
+void MergePhase(Profiler::Phase& to, const Profiler::Phase& from) {
+  for (const auto& [name, value] : from.counters) {
+    const auto it = std::ranges::find_if(to.counters, [&name](const auto& counter) { return counter.first == name; });
+    if (it != to.counters.end()) {
+      it->second += value;
+    } else {
+      to.counters.emplace_back(name, value);
+    }
+  }
+  for (const auto& from_child : from.children) {
+    const auto it =
+        std::ranges::find_if(to.children, [&from_child](const auto& child) { return child->name == from_child->name; });
+    Profiler::Phase* child;
+    if (it != to.children.end()) {
+      child = it->get();
+    } else {
+      child = to.children.emplace_back(std::make_unique<Profiler::Phase>()).get();
+      child->name = from_child->name;
+      child->parent = &to;
+    }
+    child->calls += from_child->calls;
+    child->timer += from_child->timer;
+    MergePhase(*child, *from_child);
+  }
+}
+
+}  // namespace
+
+Profiler::Profiler(const bool enabled) : enabled_{enabled}, root_{}, current_{&root_} {}
+
+void Profiler::EnterCore(const std::string_view name) {
+  const auto it = std::ranges::find_if(current_->children, [name](const auto& child) { return child->name == name; });
+  Phase* phase;
+  if (it != current_->children.end()) {
+    phase = it->get();
+  } else {
+    phase = current_->children.emplace_back(std::make_unique<Phase>()).get();
+    phase->name = name;
+    phase->parent = current_;
+  }
+  ++phase->calls;
+  phase->timer.Resume();
+  current_ = phase;
+}
+
+void Profiler::ExitCore() {
+  DELPI_ASSERT(current_ != &root_, "Cannot exit the root phase");
+  current_->timer.Pause();
+  current_ = current_->parent;
+}
+
+void Profiler::CountCore(const std::string_view name, const std::uint64_t amount) {
+  const auto it =
+      std::ranges::find_if(current_->counters, [name](const auto& counter) { return counter.first == name; });
+  if (it != current_->counters.end()) {
+    it->second += amount;
+  } else {
+    current_->counters.emplace_back(name, amount);
+  }
+}
+
+void Profiler::Reset() {
+  DELPI_ASSERT(current_ == &root_, "Cannot reset the profiler while a phase is active");
+  root_.children.clear();
+  root_.counters.clear();
+}
+
+void Profiler::Merge(const Profiler& other) {
+  if (!enabled_) return;
+  DELPI_ASSERT(other.current_ == &other.root_, "Cannot merge a profiler while one of its phases is active");
+  MergePhase(*current_, other.root_);
+}
+
+const Profiler::Phase* Profiler::Find(std::string_view path) const {
+  const Phase* phase = &root_;
+  while (!path.empty()) {
+    const std::size_t separator = path.find('/');
+    const std::string_view name = path.substr(0, separator);
+    const auto it = std::ranges::find_if(phase->children, [name](const auto& child) { return child->name == name; });
+    if (it == phase->children.end()) return nullptr;
+    phase = it->get();
+    path = separator == std::string_view::npos ? std::string_view{} : path.substr(separator + 1);
+  }
+  return phase;
+}
+
+std::uint64_t Profiler::counter(const std::string_view path, const std::string_view name) const {
+  const Phase* const phase = Find(path);
+  if (phase == nullptr) return 0;
+  const auto it = std::ranges::find_if(phase->counters, [name](const auto& counter) { return counter.first == name; });
+  return it == phase->counters.end() ? 0 : it->second;
+}
+
+void Profiler::WriteJson(std::ostream& os) const {
+  os << "{\"phases\":[";
+  for (std::size_t i = 0; i < root_.children.size(); ++i) {
+    if (i > 0) os << ",";
+    WriteJsonPhase(os, *root_.children[i]);
+  }
+  os << "]}";
+}
+
+void Profiler::WriteCsv(std::ostream& os) const {
+  os << "phase,metric,value\n";
+  for (const auto& child : root_.children) WriteCsvPhase(os, *child, child->name);
+}
+
+std::ostream& operator<<(std::ostream& os, const Profiler& profiler) {
+  profiler.WriteJson(os);
+  return os;
+}
+
+}  // namespace delpi
@@ -0,0 +1,171 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * Profiler class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "delpi/util/Timer.h"
+
+namespace delpi {
+
+/**
+ * Hierarchical registry of scoped timers and counters.
+ *
+ * Each phase of the computation (e.g., parse, build, solve) is identified by its name and by the phase it is nested in.
+ * Entering the same phase multiple times accumulates its time and number of calls.
+ * Counters (e.g., non-zero coefficients, simplex iterations) are attached to the phase active when they are increased.
+ * The resulting tree can be written in JSON or CSV format.
+ *
+ * When the profiler is disabled, all operations reduce to a single branch, and nothing is recorded.
+ * @code
+ * Profiler profiler{true};
+ * {
+ *   const ProfilerGuard guard{profiler, "parse"};
+ *   profiler.Count("rationals", 42);
+ *   {
+ *     const ProfilerGuard inner_guard{profiler, "build"};  // nested in "parse"
+ *   }
+ * }
+ * profiler.WriteJson(std::cout);
+ * @endcode
+ * @note The profiler is not thread-safe. Each LP solver owns its own.
+ */
+class Profiler {
+ public:
+  /** Node of the tree of phases. */
+  struct Phase {
+    std::string name;                                              ///< Name of the phase
+    Timer timer;                                                   ///< Cumulative time spent in the phase
+    std::size_t calls{0};                                          ///< Number of times the phase has been entered
+    std::vector<std::pair<std::string, std::uint64_t>> counters;  ///< Counters, in insertion order
+    std::vector<std::unique_ptr<Phase>> children;                  ///< Nested phases, in insertion order
+    Phase* parent{nullptr};                                        ///< Phase this phase is nested in
+  };
+
+  /**
+   * Construct a new Profiler object.
+   * @param enabled whether the profiler records anything
+   */
+  explicit Profiler(bool enabled);
+  Profiler(const Profiler&) = delete;
+  Profiler(Profiler&&) = delete;
+  Profiler& operator=(const Profiler&) = delete;
+  Profiler& operator=(Profiler&&) = delete;
+
+  /**
+   * Enter the phase `name`, nested in the currently active phase, and start its timer.
+   * @param name name of the phase
+   */
+  void Enter(const std::string_view name) {
+    if (enabled_) EnterCore(name);
+  }
+  /** Stop the timer of the currently active phase and make its parent active again. */
+  void Exit() {
+    if (enabled_) ExitCore();
+  }
+  /**
+   * Increase the counter `name` of the currently active phase by `amount`.
+   * @param name name of the counter
+   * @param amount amount to add to the counter
+   */
+  void Count(const std::string_view name, const std::uint64_t amount = 1) {
+    if (enabled_) CountCore(name, amount);
+  }
+
+  /** Discard all the recorded phases and counters. */
+  void Reset();
+  /**
+   * Add the phases and counters recorded by the `other` profiler to the currently active phase,
+   * e.g., to report the work of an auxiliary LP solver as part of the phase that used it.
+   * Phases with the same name and parent are accumulated.
+   * @pre no phase of the `other` profiler must be active
+   * @param other profiler whose phases and counters are added
+   */
+  void Merge(const Profiler& other);
+
+  /**
+   * Write the tree of phases in JSON format.
+   *
+   * Each phase is an object with the fields `name`, `calls`, `seconds`, `counters` and `phases`.
+   * @param os output stream
+   */
+  void WriteJson(std::ostream& os) const;
+  /**
+   * Write the tree of phases in CSV format.
+   *
+   * Each line has the form `phase,metric,value`, where `phase` is the `/`-separated path of the phase
+   * and `metric` is either `calls`, `seconds` or the name of a counter.
+   * @param os output stream
+   */
+  void WriteCsv(std::ostream& os) const;
+
+  /** @checker{enabled, profiler} */
+  [[nodiscard]] bool enabled() const { return enabled_; }
+  /** @getter{root of the tree of phases, profiler} */
+  [[nodiscard]] const Phase& root() const { return root_; }
+  /**
+   * Find the phase at the given `/`-separated `path`, starting from the root.
+   * @param path path of the phase, e.g. `solve/simplex`
+   * @return pointer to the phase, or nullptr if it has not been recorded
+   */
+  [[nodiscard]] const Phase* Find(std::string_view path) const;
+  /**
+   * Get the value of the counter `name` of the phase at the given `path`.
+   * @param path path of the phase, e.g. `solve/simplex`
+   * @param name name of the counter
+   * @return value of the counter, or 0 if it has not been recorded
+   */
+  [[nodiscard]] std::uint64_t counter(std::string_view path, std::string_view name) const;
+
+ private:
+  void EnterCore(std::string_view name);
+  void ExitCore();
+  void CountCore(std::string_view name, std::uint64_t amount);
+
+  const bool enabled_;  ///< Whether the profiler records anything
+  Phase root_;          ///< Root of the tree of phases. Never entered
+  Phase* current_;      ///< Currently active phase
+};
+
+/**
+ * The ProfilerGuard enters a phase of a @ref Profiler when constructed and exits it when destructed.
+ * @code
+ * void Solve() {
+ *   const ProfilerGuard guard{profiler_, "solve"};
+ *   // Code to measure
+ * }
+ * @endcode
+ */
+class ProfilerGuard {
+ public:
+  /**
+   * Construct a new ProfilerGuard object, entering the phase `name` of the `profiler`.
+   * @param profiler profiler recording the phase
+   * @param name name of the phase
+   */
+  ProfilerGuard(Profiler& profiler, const std::string_view name) : profiler_{profiler} { profiler_.Enter(name); }
+  ProfilerGuard(const ProfilerGuard&) = delete;
+  ProfilerGuard(ProfilerGuard&&) = delete;
+  ProfilerGuard& operator=(const ProfilerGuard&) = delete;
+  ProfilerGuard& operator=(ProfilerGuard&&) = delete;
+  /** Exit the phase entered in the constructor. */
+  ~ProfilerGuard() { profiler_.Exit(); }
+
+ private:
+  Profiler& profiler_;  ///< Profiler recording the phase
+};
+
+std::ostream& operator<<(std::ostream& os, const Profiler& profiler);
+
+}  // namespace delpi
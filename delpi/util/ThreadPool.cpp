@@ -0,0 +1,66 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include "delpi/util/ThreadPool.h"
+
+#include <algorithm>
+
+#include "delpi/util/logging.h"
+
+namespace delpi {
+
+ThreadPool::ThreadPool(const unsigned int num_threads) {
+  const unsigned int actual_threads =
+      num_threads > 0 ? num_threads : std::max(1u, std::thread::hardware_concurrency());
+  DELPI_DEBUG_FMT("ThreadPool::ThreadPool: starting {} workers", actual_threads);
+  workers_.reserve(actual_threads);
+  for (unsigned int i = 0; i < actual_threads; ++i) workers_.emplace_back(&ThreadPool::WorkerLoop, this);
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    stopping_ = true;
+  }
+  job_available_.notify_all();
+  for (std::thread &worker : workers_) worker.join();
+}
+
+void ThreadPool::Wait() {
+  std::unique_lock<std::mutex> lock{mutex_};
+  idle_.wait(lock, [this]() { return jobs_.empty() && running_ == 0; });
+}
+
+void ThreadPool::Enqueue(std::function<void()> job) {
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    jobs_.emplace(std::move(job));
+  }
+  job_available_.notify_one();
+}
+
+void ThreadPool::WorkerLoop() {
+  while (true) {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock{mutex_};
+      job_available_.wait(lock, [this]() { return stopping_ || !jobs_.empty(); });
+      // Keep draining the queue even when stopping, so that no submitted job is lost
+      if (jobs_.empty()) return;
+      job = std::move(jobs_.front());
+      jobs_.pop();
+      ++running_;
+    }
+    // Exceptions are captured by the packaged_task and forwarded to the future
+    job();
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      --running_;
+    }
+    idle_.notify_all();
+  }
+}
+
+}  // namespace delpi
@@ -0,0 +1,87 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ * ThreadPool class.
+ */
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace delpi {
+
+/**
+ * Fixed-size pool of worker threads consuming a FIFO queue of jobs.
+ * Jobs are submitted with @ref Submit and their result can be retrieved through the returned future.
+ * @code
+ * ThreadPool pool{4};
+ * std::future<int> result = pool.Submit([]() { return 42; });
+ * result.get();  // 42
+ * @endcode
+ * @note The destructor waits for all the queued jobs to complete before joining the workers.
+ */
+class ThreadPool {
+ public:
+  /**
+   * Construct a new ThreadPool object with `num_threads` workers.
+   * @param num_threads number of worker threads. If 0, the number of hardware threads is used
+   */
+  explicit ThreadPool(unsigned int num_threads);
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool(ThreadPool &&) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  ThreadPool &operator=(ThreadPool &&) = delete;
+  /** Wait for all the queued jobs to complete and join the workers. */
+  ~ThreadPool();
+
+  /**
+   * Add the callable `f` to the queue of jobs.
+   * It will be executed by the first available worker.
+   * @tparam F type of the callable
+   * @param f callable to execute
+   * @return future holding the value returned by `f`, or the exception it has thrown
+   */
+  template <class F>
+  std::future<std::invoke_result_t<F>> Submit(F &&f) {
+    using ReturnType = std::invoke_result_t<F>;
+    auto task = std::make_shared<std::packaged_task<ReturnType()>>(std::forward<F>(f));
+    std::future<ReturnType> future = task->get_future();
+    Enqueue([task]() { (*task)(); });
+    return future;
+  }
+
+  /** Block until the queue is empty and no worker is running a job. */
+  void Wait();
+
+  /** @getter{number of worker threads, thread pool} */
+  [[nodiscard]] std::size_t size() const { return workers_.size(); }
+
+ private:
+  /**
+   * Add the `job` to the queue and wake up a worker.
+   * @param job job to add to the queue
+   */
+  void Enqueue(std::function<void()> job);
+  /** Main loop of each worker thread. */
+  void WorkerLoop();
+
+  std::vector<std::thread> workers_;         ///< Worker threads
+  std::queue<std::function<void()>> jobs_;  ///< Queue of jobs waiting for a worker
+  std::mutex mutex_;                         ///< Mutex protecting the queue and the counters
+  std::condition_variable job_available_;    ///< Notified when a job is added or the pool is stopping
+  std::condition_variable idle_;             ///< Notified when a worker completes a job
+  std::size_t running_{0};                   ///< Number of jobs currently being executed
+  bool stopping_{false};                     ///< Whether the pool is being destroyed
+};
+
+}  // namespace delpi
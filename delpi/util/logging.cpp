@@ -14,7 +14,13 @@
 
 namespace delpi {
 
-std::shared_ptr<spdlog::logger> get_logger(LoggerType logger_type) {
+namespace {
+
+constexpr const char *const log_pattern = "[%Y-%m-%d %H:%M:%S.%e] [%^%l%$] [thread %t] %v";
+
+}  // namespace
+
+std::shared_ptr<spdlog::logger> make_logger(const LoggerType logger_type) {
   // Checks if there exists a logger with the name. If it exists, return it.
   const char *logger_name = logger_type == LoggerType::OUT ? "delpi_out" : "delpi_err";
   std::shared_ptr<spdlog::logger> logger{spdlog::get(logger_name)};
@@ -27,11 +33,19 @@ std::shared_ptr<spdlog::logger> get_logger(LoggerType logger_type) {
   logger->set_level(spdlog::level::off);
 
   // Set format.
-  logger->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%^%l%$] [thread %t] %v");
+  logger->set_pattern(log_pattern);
 
   return logger;
 }
 
+void redirect_out_logger_to_stderr() {
+  const std::shared_ptr<spdlog::logger> &logger = get_logger(LoggerType::OUT);
+  logger->flush();
+  logger->sinks() = {std::make_shared<spdlog::sinks::stderr_color_sink_mt>()};
+  // The pattern is stored in the sinks, so the new one needs it as well
+  logger->set_pattern(log_pattern);
+}
+
 }  // namespace delpi
 
 #else
@@ -19,6 +19,19 @@
   template <>                   \
   struct fmt::formatter<type> : ostream_formatter {};
 
+/**
+ * @def DELPI_LOG_ACTIVE_LEVEL
+ * Minimum level of the logging calls compiled into the binary.
+ * Calls below this level are discarded at compile time, together with the evaluation of their arguments.
+ * It uses the same values as spdlog's levels:
+ * 0 (trace), 1 (debug), 2 (info), 3 (warn), 4 (error), 5 (critical), 6 (off).
+ * Set it with `--log_active_level=<level>`.
+ * Optimised builds default to 2 (info), all other builds to 0 (trace).
+ */
+#ifndef DELPI_LOG_ACTIVE_LEVEL
+#define DELPI_LOG_ACTIVE_LEVEL 0
+#endif
+
 #ifndef NLOG
 
 #include <spdlog/logger.h>
@@ -29,7 +42,32 @@ namespace delpi {
 
 enum class LoggerType { OUT, ERR };
 
-std::shared_ptr<spdlog::logger> get_logger(LoggerType logger_type);
+/**
+ * Create the logger of the given type, or retrieve it if it has already been registered in spdlog.
+ * @param logger_type type of the logger
+ * @return the logger
+ */
+std::shared_ptr<spdlog::logger> make_logger(LoggerType logger_type);
+
+/**
+ * Get the logger of the given type.
+ *
+ * The loggers are created on the first call and cached, so that following calls do not query the spdlog registry.
+ * @param logger_type type of the logger
+ * @return the logger
+ */
+inline const std::shared_ptr<spdlog::logger> &get_logger(const LoggerType logger_type) {
+  static const std::shared_ptr<spdlog::logger> out_logger{make_logger(LoggerType::OUT)};
+  static const std::shared_ptr<spdlog::logger> err_logger{make_logger(LoggerType::ERR)};
+  return logger_type == LoggerType::OUT ? out_logger : err_logger;
+}
+
+/**
+ * Send the messages of the @ref LoggerType::OUT logger to the standard error,
+ * for when the standard output is reserved to a protocol, as with the server.
+ * @warning Not thread safe. It must be called before any other thread starts logging.
+ */
+void redirect_out_logger_to_stderr();
 
 }  // namespace delpi
 
@@ -47,25 +85,42 @@ std::shared_ptr<spdlog::logger> get_logger(LoggerType logger_type);
                             : ((verbosity) == 4 ? spdlog::level::debug \
                                                 : ((verbosity) == 5 ? spdlog::level::trace : spdlog::level::off))))))
 #define DELPI_LOG_INIT_VERBOSITY(verbosity) DELPI_LOG_INIT_LEVEL(DELPI_VERBOSITY_TO_LOG_LEVEL(verbosity))
+#define DELPI_LOG_OUT_TO_STDERR() ::delpi::redirect_out_logger_to_stderr()
 #define DELPI_LOG_INIT_LEVEL(level)                                  \
   do {                                                               \
     ::delpi::get_logger(::delpi::LoggerType::OUT)->set_level(level); \
     ::delpi::get_logger(::delpi::LoggerType::ERR)->set_level(level); \
   } while (0)
-#define DELPI_TRACE(msg) ::delpi::get_logger(::delpi::LoggerType::OUT)->trace(msg)
-#define DELPI_TRACE_FMT(msg, ...) ::delpi::get_logger(::delpi::LoggerType::OUT)->trace(msg, __VA_ARGS__)
-#define DELPI_DEBUG(msg) ::delpi::get_logger(::delpi::LoggerType::OUT)->debug(msg)
-#define DELPI_DEBUG_FMT(msg, ...) ::delpi::get_logger(::delpi::LoggerType::OUT)->debug(msg, __VA_ARGS__)
-#define DELPI_INFO(msg) ::delpi::get_logger(::delpi::LoggerType::OUT)->info(msg)
-#define DELPI_INFO_FMT(msg, ...) ::delpi::get_logger(::delpi::LoggerType::OUT)->info(msg, __VA_ARGS__)
-#define DELPI_WARN(msg) ::delpi::get_logger(::delpi::LoggerType::ERR)->warn(msg)
-#define DELPI_WARN_FMT(msg, ...) ::delpi::get_logger(::delpi::LoggerType::ERR)->warn(msg, __VA_ARGS__)
-#define DELPI_ERROR(msg) ::delpi::get_logger(::delpi::LoggerType::ERR)->error(msg)
-#define DELPI_ERROR_FMT(msg, ...) ::delpi::get_logger(::delpi::LoggerType::ERR)->error(msg, __VA_ARGS__)
-#define DELPI_CRITICAL(msg) ::delpi::get_logger(::delpi::LoggerType::ERR)->critical(msg)
-#define DELPI_CRITICAL_FMT(msg, ...) ::delpi::get_logger(::delpi::LoggerType::ERR)->critical(msg, __VA_ARGS__)
-#define DELPI_INFO_ENABLED (::delpi::get_logger(::delpi::LoggerType::OUT)->should_log(spdlog::level::info))
-#define DELPI_TRACE_ENABLED (::delpi::get_logger(::delpi::LoggerType::OUT)->should_log(spdlog::level::trace))
+/**
+ * Log a message with the logger of type `logger_type` at the given `level`.
+ * If the level is below @ref DELPI_LOG_ACTIVE_LEVEL, the call is discarded at compile time.
+ * Otherwise, the arguments are only evaluated if the logger is going to print the message.
+ */
+#define DELPI_LOG(logger_type, level, ...)                                                    \
+  do {                                                                                        \
+    if constexpr (static_cast<int>(level) >= DELPI_LOG_ACTIVE_LEVEL) {                        \
+      const std::shared_ptr<spdlog::logger> &delpi_logger = ::delpi::get_logger(logger_type); \
+      if (delpi_logger->should_log(level)) delpi_logger->log(level, __VA_ARGS__);             \
+    }                                                                                         \
+  } while (0)
+#define DELPI_TRACE(msg) DELPI_LOG(::delpi::LoggerType::OUT, spdlog::level::trace, msg)
+#define DELPI_TRACE_FMT(msg, ...) DELPI_LOG(::delpi::LoggerType::OUT, spdlog::level::trace, msg, __VA_ARGS__)
+#define DELPI_DEBUG(msg) DELPI_LOG(::delpi::LoggerType::OUT, spdlog::level::debug, msg)
+#define DELPI_DEBUG_FMT(msg, ...) DELPI_LOG(::delpi::LoggerType::OUT, spdlog::level::debug, msg, __VA_ARGS__)
+#define DELPI_INFO(msg) DELPI_LOG(::delpi::LoggerType::OUT, spdlog::level::info, msg)
+#define DELPI_INFO_FMT(msg, ...) DELPI_LOG(::delpi::LoggerType::OUT, spdlog::level::info, msg, __VA_ARGS__)
+#define DELPI_WARN(msg) DELPI_LOG(::delpi::LoggerType::ERR, spdlog::level::warn, msg)
+#define DELPI_WARN_FMT(msg, ...) DELPI_LOG(::delpi::LoggerType::ERR, spdlog::level::warn, msg, __VA_ARGS__)
+#define DELPI_ERROR(msg) DELPI_LOG(::delpi::LoggerType::ERR, spdlog::level::err, msg)
+#define DELPI_ERROR_FMT(msg, ...) DELPI_LOG(::delpi::LoggerType::ERR, spdlog::level::err, msg, __VA_ARGS__)
+#define DELPI_CRITICAL(msg) DELPI_LOG(::delpi::LoggerType::ERR, spdlog::level::critical, msg)
+#define DELPI_CRITICAL_FMT(msg, ...) DELPI_LOG(::delpi::LoggerType::ERR, spdlog::level::critical, msg, __VA_ARGS__)
+#define DELPI_INFO_ENABLED                                            \
+  (static_cast<int>(spdlog::level::info) >= DELPI_LOG_ACTIVE_LEVEL && \
+   ::delpi::get_logger(::delpi::LoggerType::OUT)->should_log(spdlog::level::info))
+#define DELPI_TRACE_ENABLED                                            \
+  (static_cast<int>(spdlog::level::trace) >= DELPI_LOG_ACTIVE_LEVEL && \
+   ::delpi::get_logger(::delpi::LoggerType::OUT)->should_log(spdlog::level::trace))
 
 #ifndef NDEBUG
 
@@ -105,6 +160,7 @@ std::shared_ptr<spdlog::logger> get_logger(LoggerType logger_type);
 #define DELPI_FORMAT(message, ...) fmt::format(message, __VA_ARGS__)
 #define DELPI_VERBOSITY_TO_LOG_LEVEL(verbosity) 0
 #define DELPI_LOG_INIT_LEVEL(level) void(0)
+#define DELPI_LOG_OUT_TO_STDERR() void(0)
 #define DELPI_LOG_INIT_VERBOSITY(verbosity) void(0)
 #define DELPI_TRACE(msg) void(0)
 #define DELPI_TRACE_FMT(msg, ...) void(0)
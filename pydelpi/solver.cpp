@@ -34,6 +34,26 @@ void init_solver(py::module_ &m) {
       .def("__str__", STR_LAMBDA(Row))
       .def("__repr__", REPR_LAMBDA(Row));
 
+  py::class_<Scenario::Bounds>(m, "ScenarioBounds")  //
+      .def(py::init<>())
+      .def(py::init<>([](const int index, const std::optional<mpq_class> &lb, const std::optional<mpq_class> &ub) {
+             return Scenario::Bounds{index, lb, ub};
+           }),
+           py::arg("index"), py::arg("lb"), py::arg("ub"))
+      .def_readwrite("index", &Scenario::Bounds::index)
+      .def_readwrite("lb", &Scenario::Bounds::lb)
+      .def_readwrite("ub", &Scenario::Bounds::ub)
+      .def("__str__", STR_LAMBDA(Scenario::Bounds))
+      .def("__repr__", REPR_LAMBDA(Scenario::Bounds));
+
+  py::class_<Scenario>(m, "Scenario")  //
+      .def(py::init<>())
+      .def_readwrite("name", &Scenario::name)
+      .def_readwrite("rows", &Scenario::rows)
+      .def_readwrite("columns", &Scenario::columns)
+      .def("__str__", STR_LAMBDA(Scenario))
+      .def("__repr__", REPR_LAMBDA(Scenario));
+
   py::enum_<LpResult>(m, "LpResult")
       .value("OPTIMAL", LpResult::OPTIMAL)
       .value("DELTA_OPTIMAL", LpResult::DELTA_OPTIMAL)
@@ -42,6 +62,49 @@ void init_solver(py::module_ &m) {
       .value("ERROR", LpResult::ERROR)
       .value("UNSOLVED", LpResult::UNSOLVED);
 
+  py::class_<SensitivityRange>(m, "SensitivityRange")  //
+      .def_readonly("lb", &SensitivityRange::lb)
+      .def_readonly("ub", &SensitivityRange::ub)
+      .def("__str__", STR_LAMBDA(SensitivityRange))
+      .def("__repr__", REPR_LAMBDA(SensitivityRange));
+
+  py::class_<SensitivityReport>(m, "SensitivityReport")  //
+      .def_readonly("objective", &SensitivityReport::objective)
+      .def_readonly("rhs", &SensitivityReport::rhs);
+
+  py::class_<ParametricSegment>(m, "ParametricSegment")  //
+      .def_readonly("t_lb", &ParametricSegment::t_lb)
+      .def_readonly("t_ub", &ParametricSegment::t_ub)
+      .def_readonly("result", &ParametricSegment::result)
+      .def_readonly("objective", &ParametricSegment::objective)
+      .def_readonly("slope", &ParametricSegment::slope)
+      .def_readonly("solution", &ParametricSegment::solution)
+      .def("__str__", STR_LAMBDA(ParametricSegment))
+      .def("__repr__", REPR_LAMBDA(ParametricSegment));
+
+  py::class_<ScenarioResult>(m, "ScenarioResult")  //
+      .def_readonly("name", &ScenarioResult::name)
+      .def_readonly("result", &ScenarioResult::result)
+      .def_readonly("precision", &ScenarioResult::precision)
+      .def_readonly("obj_lb", &ScenarioResult::obj_lb)
+      .def_readonly("obj_ub", &ScenarioResult::obj_ub)
+      .def_readonly("solution", &ScenarioResult::solution)
+      .def("__str__", STR_LAMBDA(ScenarioResult))
+      .def("__repr__", REPR_LAMBDA(ScenarioResult));
+
+  py::class_<ModelFeatures>(m, "ModelFeatures")  //
+      .def(py::init<const std::vector<Column> &, const std::vector<Row> &>(), py::arg("columns"), py::arg("rows"))
+      .def_readonly_static("names", &ModelFeatures::names)
+      .def_property_readonly("values", &ModelFeatures::values)
+      .def("__getitem__",
+           [](const ModelFeatures &self, const std::string &name) {
+             const std::optional<ModelFeatures::Feature> feature{ModelFeatures::FromName(name)};
+             if (!feature.has_value()) throw py::key_error(name);
+             return self[*feature];
+           })
+      .def("__str__", STR_LAMBDA(ModelFeatures))
+      .def("__repr__", REPR_LAMBDA(ModelFeatures));
+
   py::class_<LpSolver>(m, "LpSolver")
       .def_static("get_instance", &LpSolver::GetInstance, py::arg("config"))
       .def_property_readonly("variables", &LpSolver::variables)
@@ -63,7 +126,40 @@ void init_solver(py::module_ &m) {
       .def("add_row", py::overload_cast<const Formula &>(&LpSolver::AddRow), py::arg("formula"))
       .def("add_row", py::overload_cast<const Expression &, FormulaKind, const mpq_class &>(&LpSolver::AddRow),
            py::arg("formula"), py::arg("kind"), py::arg("rhs"))
+      .def(
+          "remove_rows", [](LpSolver &self, const std::vector<int> &rows) { self.RemoveRows(rows); },
+          py::arg("rows"))
+      .def(
+          "remove_columns", [](LpSolver &self, const std::vector<int> &columns) { self.RemoveColumns(columns); },
+          py::arg("columns"))
+      .def("set_row_bound", &LpSolver::SetRowBound, py::arg("row"), py::arg("lb"), py::arg("ub"))
+      .def("push", &LpSolver::Push)
+      .def("pop", &LpSolver::Pop, py::arg("n") = 1)
       .def("solve", &LpSolver::Solve, py::arg("precision"), py::arg("store_solution") = true)
+      .def("solve_decomposed", &LpSolver::SolveDecomposed, py::arg("precision"), py::arg("store_solution") = true)
+      .def_property_readonly("scenarios", &LpSolver::scenarios)
+      .def("add_scenario", &LpSolver::AddScenario, py::arg("scenario"))
+      .def(
+          "solve_scenarios",
+          [](LpSolver &self, const std::vector<Scenario> &scenarios, const mpq_class &precision,
+             const bool store_solution) { return self.SolveScenarios(scenarios, precision, store_solution); },
+          py::arg("scenarios"), py::arg("precision"), py::arg("store_solution") = false)
+      .def(
+          "solve_lexicographic",
+          [](LpSolver &self, const std::vector<Expression> &objectives, mpq_class &precision,
+             const bool store_solution) { return self.SolveLexicographic(objectives, precision, store_solution); },
+          py::arg("objectives"), py::arg("precision"), py::arg("store_solution") = true)
+      .def("sensitivity", &LpSolver::Sensitivity)
+      .def(
+          "solve_parametric",
+          [](LpSolver &self, const std::vector<mpq_class> &direction, const mpq_class &t_lb, const mpq_class &t_ub) {
+            return self.SolveParametric(direction, t_lb, t_ub);
+          },
+          py::arg("direction"), py::arg("t_lb"), py::arg("t_ub"))
+      .def("clone", py::overload_cast<>(&LpSolver::Clone, py::const_))
+      .def("clone", py::overload_cast<const Config &>(&LpSolver::Clone, py::const_), py::arg("config"))
+      .def("features", &LpSolver::Features)
+      .def("select_backend", &LpSolver::SelectBackend)
       .def("solution", [](const LpSolver &self) { return self.solution(); })
       .def("solution", [](const LpSolver &self, const Variable &var) { return self.solution(var); })
       .def("row", &LpSolver::row, py::arg("row_idx"))
@@ -28,7 +28,8 @@ void init_util(py::module_ &m) {
 
   py::enum_<Config::LpSolver>(m, "LpSolverName")
       .value("QSOPTEX", Config::LpSolver::QSOPTEX)
-      .value("SOPLEX", Config::LpSolver::SOPLEX);
+      .value("SOPLEX", Config::LpSolver::SOPLEX)
+      .value("AUTO", Config::LpSolver::AUTO);
 
   py::enum_<Config::Format>(m, "Format").value("AUTO", Config::Format::AUTO).value("MPS", Config::Format::MPS);
 
@@ -36,7 +37,29 @@ void init_util(py::module_ &m) {
       .value("AUTO", Config::LpMode::AUTO)
       .value("PURE_PRECISION_BOOSTING", Config::LpMode::PURE_PRECISION_BOOSTING)
       .value("PURE_ITERATIVE_REFINEMENT", Config::LpMode::PURE_ITERATIVE_REFINEMENT)
-      .value("HYBRID", Config::LpMode::HYBRID);
+      .value("HYBRID", Config::LpMode::HYBRID)
+      .value("FLOAT_FIRST", Config::LpMode::FLOAT_FIRST);
+
+  py::enum_<Config::Dualize>(m, "Dualize")
+      .value("AUTO", Config::Dualize::AUTO)
+      .value("ON", Config::Dualize::ON)
+      .value("OFF", Config::Dualize::OFF);
+
+  py::enum_<Config::WarmStart>(m, "WarmStart")
+      .value("NONE", Config::WarmStart::NONE)
+      .value("PDHG", Config::WarmStart::PDHG)
+      .value("CRASH", Config::WarmStart::CRASH);
+
+  py::enum_<Config::SimplexAlgorithm>(m, "SimplexAlgorithm")
+      .value("AUTO", Config::SimplexAlgorithm::AUTO)
+      .value("PRIMAL", Config::SimplexAlgorithm::PRIMAL)
+      .value("DUAL", Config::SimplexAlgorithm::DUAL);
+
+  py::enum_<Config::Pricing>(m, "Pricing")
+      .value("AUTO", Config::Pricing::AUTO)
+      .value("DANTZIG", Config::Pricing::DANTZIG)
+      .value("DEVEX", Config::Pricing::DEVEX)
+      .value("STEEPEST", Config::Pricing::STEEPEST);
 
   py::class_<Config>(m, "Config")
       .def(py::init<>())
@@ -103,6 +126,12 @@ void init_util(py::module_ &m) {
                     [](Config &self, const bool value) { self.m_debug_parsing() = value; })
       .def_property("debug_scanning", &Config::debug_scanning,
                     [](Config &self, const bool value) { self.m_debug_scanning() = value; })
+      .def_property("decompose", &Config::decompose,
+                    [](Config &self, const bool value) { self.m_decompose() = value; })
+      .def_property("dualize", &Config::dualize,
+                    [](Config &self, const Config::Dualize value) { self.m_dualize() = value; })
+      .def_property("features", &Config::features,
+                    [](Config &self, const bool value) { self.m_features() = value; })
       .def_property("filename", &Config::filename,
                     [](Config &self, const std::string &value) { self.m_filename() = value; })
       .def_property("format", &Config::format,
@@ -111,22 +140,45 @@ void init_util(py::module_ &m) {
                     [](Config &self, const Config::LpMode value) { self.m_lp_mode() = value; })
       .def_property("lp_solver", &Config::lp_solver,
                     [](Config &self, const Config::LpSolver &value) { self.m_lp_solver() = value; })
+      .def_property("lp_solver_rules", &Config::lp_solver_rules,
+                    [](Config &self, const std::string &value) { self.m_lp_solver_rules() = value; })
+      .def_property("memory_lean", &Config::memory_lean,
+                    [](Config &self, const bool value) { self.m_memory_lean() = value; })
       .def_property("number_of_jobs", &Config::number_of_jobs,
                     [](Config &self, const int value) { self.m_number_of_jobs() = value; })
+      .def_property("pdhg_iterations", &Config::pdhg_iterations,
+                    [](Config &self, const unsigned int value) { self.m_pdhg_iterations() = value; })
+      .def_property("pdhg_tolerance", &Config::pdhg_tolerance,
+                    [](Config &self, const double value) { self.m_pdhg_tolerance() = value; })
       .def_property("skip_optimise", &Config::skip_optimise,
                     [](Config &self, const bool value) { self.m_skip_optimise() = value; })
+      .def_property("pricing", &Config::pricing,
+                    [](Config &self, const Config::Pricing value) { self.m_pricing() = value; })
       .def_property("precision", &Config::precision, [](Config &self, double value) { self.m_precision() = value; })
       .def_property("produce_model", &Config::produce_models,
                     [](Config &self, const bool value) { self.m_produce_models() = value; })
+      .def_property("propagation_rounds", &Config::propagation_rounds,
+                    [](Config &self, const unsigned int value) { self.m_propagation_rounds() = value; })
       .def_property("random_seed", &Config::random_seed, [](Config &self, int value) { self.m_random_seed() = value; })
       .def_property("read_from_stdin", &Config::read_from_stdin,
                     [](Config &self, const bool value) { self.m_read_from_stdin() = value; })
+      .def_property("restarts", &Config::restarts,
+                    [](Config &self, const unsigned int value) { self.m_restarts() = value; })
+      .def_property("scaling", &Config::scaling, [](Config &self, const bool value) { self.m_scaling() = value; })
+      .def_property("scenarios", &Config::scenarios,
+                    [](Config &self, const bool value) { self.m_scenarios() = value; })
+      .def_property("sensitivity", &Config::sensitivity,
+                    [](Config &self, const bool value) { self.m_sensitivity() = value; })
+      .def_property("simplex", &Config::simplex,
+                    [](Config &self, const Config::SimplexAlgorithm value) { self.m_simplex() = value; })
       .def_property("silent", &Config::silent, [](Config &self, bool value) { self.m_silent() = value; })
       .def_property("verbose_delpi", &Config::verbose_delpi,
                     [](Config &self, const int value) { self.m_verbose_delpi() = value; })
       .def_property("verbose_simplex", &Config::verbose_simplex,
                     [](Config &self, const int value) { self.m_verbose_simplex() = value; })
       .def_property("verify", &Config::verify, [](Config &self, const bool value) { self.m_verify() = value; })
+      .def_property("warm_start", &Config::warm_start,
+                    [](Config &self, const Config::WarmStart value) { self.m_warm_start() = value; })
       .def_property("with_timings", &Config::with_timings,
                     [](Config &self, const bool value) { self.m_with_timings() = value; })
       .def("__str__", STR_LAMBDA(Config))
@@ -0,0 +1,22 @@
+#!/bin/bash
+
+# Run all the micro-benchmarks, storing the results in JSON format.
+# Usage: benchmark.sh [output_dir] [mps files...]
+# The results of two runs can be compared with Google Benchmark's compare.py script.
+readonly script_path="$( cd -- "$(dirname "$0")" >/dev/null 2>&1 || exit ; pwd -P )"
+readonly root_dir="$script_path/.."
+readonly output_dir="$(realpath -m "${1:-$root_dir/benchmark-results}")"
+shift
+mps_files=()
+for file in "$@"; do mps_files+=("$(realpath "$file")"); done
+
+mkdir -p "$output_dir"
+cd "$root_dir" || exit 1
+bazel build --config=bench //benchmarks/... || exit 1
+for bench in bench_gmp bench_expression bench_lp_solver; do
+  "$root_dir/bazel-bin/benchmarks/$bench" --benchmark_out="$output_dir/$bench.json" --benchmark_out_format=json
+done
+for bench in bench_mps_driver bench_sparse_lu; do
+  "$root_dir/bazel-bin/benchmarks/$bench" --benchmark_out="$output_dir/$bench.json" --benchmark_out_format=json \
+    "${mps_files[@]}"
+done
@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+"""Retrain the rules used by delpi to pick the LP solver and the LP mode with --lp-solver auto.
+
+Usage:
+  train_selector.py collect <delpi binary> <output csv> [mps files...]
+      Solve each problem with every combination of LP solver and LP mode,
+      storing the features of the problem and the time taken by each combination.
+  train_selector.py train <input csv> <output rules csv>
+      Learn an ordered list of rules from the collected times.
+      Each rule is a threshold on a single feature, picked greedily to save the most time
+      with respect to the combination that is the fastest overall on the problems it has not covered yet.
+"""
+import csv
+import subprocess
+import sys
+import time
+
+COMBINATIONS = [
+    ("soplex", "pure-precision-boosting"),
+    ("soplex", "pure-iterative-refinement"),
+    ("soplex", "hybrid"),
+    ("soplex", "float-first"),
+    ("qsoptex", "pure-precision-boosting"),
+]
+TIMEOUT = 600  # seconds. Failed or timed out runs count twice as much
+MIN_SUPPORT = 2  # minimum number of problems a rule must cover
+
+
+def collect(delpi, output, files):
+    writer = None
+    with open(output, "w", newline="") as out:
+        for file in files:
+            for lp_solver, lp_mode in COMBINATIONS:
+                cmd = [delpi, "--lp-solver", lp_solver, "--lp-mode", lp_mode, "--features", "--csv", file]
+                start = time.perf_counter()
+                try:
+                    run = subprocess.run(cmd, capture_output=True, text=True, timeout=TIMEOUT)
+                    seconds = time.perf_counter() - start if run.returncode == 0 else 2 * TIMEOUT
+                    lines = run.stdout.splitlines()
+                except subprocess.TimeoutExpired:
+                    seconds, lines = 2 * TIMEOUT, []
+                header = next((i for i, line in enumerate(lines) if line.startswith("num_columns,")), None)
+                if header is None:
+                    print(f"{file}: no features with {lp_solver}/{lp_mode}", file=sys.stderr)
+                    continue
+                names, values = lines[header].split(","), lines[header + 1].split(",")
+                if writer is None:
+                    writer = csv.writer(out)
+                    writer.writerow(["instance", *names, "lp_solver", "lp_mode", "seconds"])
+                writer.writerow([file, *values, lp_solver, lp_mode, f"{seconds:.6f}"])
+
+
+def train(input_csv, output):
+    features, times = {}, {}
+    with open(input_csv, newline="") as f:
+        reader = csv.DictReader(f)
+        names = [name for name in reader.fieldnames if name not in ("instance", "lp_solver", "lp_mode", "seconds")]
+        for row in reader:
+            features[row["instance"]] = {name: float(row[name]) for name in names}
+            times.setdefault(row["instance"], {})[(row["lp_solver"], row["lp_mode"])] = float(row["seconds"])
+
+    def time_of(instance, combination):
+        return times[instance].get(combination, 2 * TIMEOUT)
+
+    def fastest(instances):
+        return min(COMBINATIONS, key=lambda c: sum(time_of(i, c) for i in instances))
+
+    rules, remaining = [], list(features)
+    while remaining:
+        default = fastest(remaining)
+        best, best_saved = None, 0.0
+        for name in names:
+            values = sorted({features[i][name] for i in remaining})
+            for low, high in zip(values, values[1:]):
+                threshold = (low + high) / 2
+                for at_least in (True, False):
+                    covered = [i for i in remaining if (features[i][name] >= threshold) == at_least]
+                    if len(covered) < MIN_SUPPORT:
+                        continue
+                    combination = fastest(covered)
+                    saved = sum(time_of(i, default) - time_of(i, combination) for i in covered)
+                    if saved > best_saved:
+                        best, best_saved = (name, at_least, threshold, combination, covered), saved
+        if best is None:
+            break
+        name, at_least, threshold, combination, covered = best
+        rules.append((name, ">=" if at_least else "<", f"{threshold:g}", *combination))
+        covered = set(covered)
+        remaining = [i for i in remaining if i not in covered]
+    # The problems no rule covers use the combination that is the fastest on them
+    rules.append(("", "", "", *fastest(remaining or list(features))))
+
+    with open(output, "w", newline="") as out:
+        out.write(f"# Learnt from {len(features)} problems in {input_csv}\n")
+        writer = csv.writer(out, lineterminator="\n")
+        writer.writerow(["feature", "comparison", "threshold", "lp_solver", "lp_mode"])
+        writer.writerows(rules)
+
+
+if __name__ == "__main__":
+    if len(sys.argv) >= 4 and sys.argv[1] == "collect":
+        collect(sys.argv[2], sys.argv[3], sys.argv[4:])
+    elif len(sys.argv) == 4 and sys.argv[1] == "train":
+        train(sys.argv[2], sys.argv[3])
+    else:
+        print(__doc__, file=sys.stderr)
+        sys.exit(1)
@@ -0,0 +1,165 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tuple>
+
+#include "delpi/generator/Generator.h"
+#include "delpi/solver/LpSolver.h"
+#include "delpi/util/exception.h"
+#include "tests/solver/SolverUtils.h"
+
+using delpi::Config;
+using delpi::DelpiInvalidArgumentException;
+using delpi::Generator;
+using delpi::LpResult;
+using delpi::LpSolver;
+
+class TestGenerator : public ::testing::Test {
+ protected:
+  Config config_;
+  Generator::Options options_;
+
+  TestGenerator() {
+    config_.m_random_seed() = 42;
+    options_.num_rows = 20;
+    options_.num_columns = 30;
+    options_.nnz_per_column = 3;
+  }
+
+  [[nodiscard]] std::string Mps(const Generator& generator) const {
+    std::stringstream ss;
+    generator.WriteMps(ss);
+    return ss.str();
+  }
+};
+
+TEST_F(TestGenerator, SameSeedSameProblem) {
+  const Generator lhs{config_, options_};
+  const Generator rhs{config_, options_};
+  EXPECT_EQ(lhs.seed(), 42u);
+  EXPECT_EQ(Mps(lhs), Mps(rhs));
+}
+
+TEST_F(TestGenerator, DifferentSeedDifferentProblem) {
+  const Generator lhs{config_, options_};
+  config_.m_random_seed() = 43;
+  const Generator rhs{config_, options_};
+  EXPECT_NE(Mps(lhs), Mps(rhs));
+}
+
+TEST_F(TestGenerator, RandomSeed) {
+  config_.m_random_seed() = 0;
+  const Generator generator{config_, options_};
+  EXPECT_NE(generator.seed(), 0u);
+}
+
+TEST_F(TestGenerator, Random) {
+  const Generator generator{config_, options_};
+  EXPECT_EQ(generator.rows().size(), 20u);
+  EXPECT_EQ(generator.columns().size(), 30u);
+  EXPECT_GE(generator.nnz(), 30u * 3u);
+}
+
+TEST_F(TestGenerator, Degenerate) {
+  options_.kind = Generator::Kind::DEGENERATE;
+  const Generator generator{config_, options_};
+  EXPECT_EQ(generator.rows().size(), 20u);
+  EXPECT_EQ(generator.columns().size(), 30u);
+  for (const auto& row : generator.rows()) EXPECT_FALSE(row.lb.has_value());
+}
+
+TEST_F(TestGenerator, Transportation) {
+  options_.kind = Generator::Kind::TRANSPORTATION;
+  const Generator generator{config_, options_};
+  EXPECT_EQ(generator.rows().size(), 20u);
+  EXPECT_EQ(generator.columns().size(), 10u * 10u);
+  EXPECT_EQ(generator.nnz(), 2u * 10u * 10u);
+}
+
+TEST_F(TestGenerator, Multicommodity) {
+  options_.kind = Generator::Kind::MULTICOMMODITY;
+  const Generator generator{config_, options_};
+  EXPECT_EQ(generator.rows().size(), 20u * 2u + 30u);
+  EXPECT_EQ(generator.columns().size(), 30u * 2u);
+}
+
+TEST_F(TestGenerator, Infeasible) {
+  options_.expected = LpResult::INFEASIBLE;
+  const Generator generator{config_, options_};
+  EXPECT_EQ(generator.rows().size(), 21u);
+  EXPECT_NE(Mps(generator).find("* @set-info :status infeasible\n"), std::string::npos);
+}
+
+TEST_F(TestGenerator, Unbounded) {
+  options_.expected = LpResult::UNBOUNDED;
+  const Generator generator{config_, options_};
+  EXPECT_EQ(generator.columns().size(), 31u);
+  EXPECT_FALSE(generator.columns().back().lb.has_value());
+  EXPECT_FALSE(generator.columns().back().ub.has_value());
+  EXPECT_NE(Mps(generator).find("* @set-info :status unbounded\n"), std::string::npos);
+}
+
+TEST_F(TestGenerator, InvalidOptions) {
+  options_.num_rows = 0;
+  EXPECT_THROW(Generator(config_, options_), DelpiInvalidArgumentException);
+  options_.num_rows = 10;
+  options_.num_commodities = 0;
+  EXPECT_THROW(Generator(config_, options_), DelpiInvalidArgumentException);
+  options_.num_commodities = 1;
+  options_.expected = LpResult::DELTA_OPTIMAL;
+  EXPECT_THROW(Generator(config_, options_), DelpiInvalidArgumentException);
+}
+
+class TestGeneratorSolve
+    : public ::testing::TestWithParam<std::tuple<Config::LpSolver, Generator::Kind, LpResult>> {
+ protected:
+  Config config_;
+  Generator::Options options_;
+  std::unique_ptr<LpSolver> solver_;
+
+  TestGeneratorSolve() {
+    const auto& [solver, kind, expected] = GetParam();
+    config_.m_lp_solver() = solver;
+    config_.m_random_seed() = 7;
+    options_.kind = kind;
+    options_.expected = expected;
+    options_.num_rows = 12;
+    options_.num_columns = 16;
+    options_.nnz_per_column = 3;
+    solver_ = LpSolver::GetInstance(config_);
+  }
+};
+
+INSTANTIATE_TEST_SUITE_P(TestGeneratorSolve, TestGeneratorSolve,
+                         ::testing::Combine(enabled_test_solvers,
+                                            ::testing::Values(Generator::Kind::RANDOM, Generator::Kind::TRANSPORTATION,
+                                                              Generator::Kind::MULTICOMMODITY,
+                                                              Generator::Kind::DEGENERATE),
+                                            ::testing::Values(LpResult::OPTIMAL, LpResult::INFEASIBLE,
+                                                              LpResult::UNBOUNDED)));
+
+TEST_P(TestGeneratorSolve, MpsMatchesExpectedResult) {
+  const Generator generator{config_, options_};
+  std::stringstream ss;
+  generator.WriteMps(ss);
+  ASSERT_TRUE(solver_->ParseString(ss.str()));
+  ASSERT_EQ(solver_->expected(), options_.expected);
+  mpq_class precision{0};
+  EXPECT_EQ(solver_->Solve(precision), options_.expected);
+}
+
+TEST_P(TestGeneratorSolve, AddToMatchesExpectedResult) {
+  const Generator generator{config_, options_};
+  generator.AddTo(*solver_);
+  EXPECT_EQ(solver_->num_columns(), static_cast<int>(generator.columns().size()));
+  EXPECT_EQ(solver_->num_rows(), static_cast<int>(generator.rows().size()));
+  mpq_class precision{0};
+  EXPECT_EQ(solver_->Solve(precision), options_.expected);
+}
@@ -11,6 +11,7 @@
 using delpi::Config;
 using delpi::Formula;
 using delpi::LpSolver;
+using delpi::Scenario;
 using delpi::Variable;
 using delpi::mps::MpsDriver;
 
@@ -381,3 +382,54 @@ TEST_F(TestMpsDriver, BoundsImplicit) {
                                                            x3 >= 0,  //
                                                            x1 + x2 + x3 + x4 + x5 == 0));
 }
+
+TEST_F(TestMpsDriver, Scenarios) {
+  config_.m_scenarios() = true;
+  lp_solver_ = LpSolver::GetInstance(config_);
+  MpsDriver driver{*lp_solver_};
+  ASSERT_TRUE(
+      driver.ParseString("ROWS\n"
+                         " N  Ob\n"
+                         " L  R1\n"
+                         " G  R2\n"
+                         "COLUMNS\n"
+                         " X1 Ob 1. R1 1.\n"
+                         " X1 R2 1.\n"
+                         " X2 Ob 1. R1 1.\n"
+                         " X2 R2 -1.\n"
+                         "RHS\n"
+                         " RHS1 R1 10. R2 1.\n"
+                         " RHS2 R1 20.\n"
+                         "BOUNDS\n"
+                         " UP BND1 X1 4.\n"
+                         " UP BND2 X1 6.\n"
+                         " UP BND2 X2 3.\n"
+                         "ENDATA"));
+  // The base problem only uses the first set of each kind
+  EXPECT_EQ(lp_solver_->row(0).ub.value(), 10);
+  EXPECT_EQ(lp_solver_->row(1).lb.value(), 1);
+  EXPECT_EQ(lp_solver_->column(0).ub.value(), 4);
+  EXPECT_FALSE(lp_solver_->column(1).ub.has_value());
+
+  const std::vector<Scenario>& scenarios = lp_solver_->scenarios();
+  ASSERT_EQ(scenarios.size(), 2u);
+  EXPECT_EQ(scenarios[0].name, "RHS1/BND1");
+  EXPECT_TRUE(scenarios[0].rows.empty());
+  EXPECT_TRUE(scenarios[0].columns.empty());
+
+  // R2 is missing from RHS2, so its rhs defaults to 0
+  EXPECT_EQ(scenarios[1].name, "RHS2/BND2");
+  ASSERT_EQ(scenarios[1].rows.size(), 2u);
+  EXPECT_EQ(scenarios[1].rows[0].index, 0);
+  EXPECT_FALSE(scenarios[1].rows[0].lb.has_value());
+  EXPECT_EQ(scenarios[1].rows[0].ub, mpq_class{20});
+  EXPECT_EQ(scenarios[1].rows[1].index, 1);
+  EXPECT_EQ(scenarios[1].rows[1].lb, mpq_class{0});
+  EXPECT_FALSE(scenarios[1].rows[1].ub.has_value());
+  ASSERT_EQ(scenarios[1].columns.size(), 2u);
+  EXPECT_EQ(scenarios[1].columns[0].index, 0);
+  EXPECT_EQ(scenarios[1].columns[0].lb, mpq_class{0});
+  EXPECT_EQ(scenarios[1].columns[0].ub, mpq_class{6});
+  EXPECT_EQ(scenarios[1].columns[1].index, 1);
+  EXPECT_EQ(scenarios[1].columns[1].ub, mpq_class{3});
+}
@@ -0,0 +1,170 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "delpi/server/Server.h"
+#include "delpi/util/exception.h"
+
+using delpi::Config;
+using delpi::DelpiInvalidArgumentException;
+using delpi::LpResult;
+using delpi::Server;
+using delpi::ServerRequest;
+using delpi::ServerResponse;
+
+class TestServer : public ::testing::Test {
+ protected:
+  Config config_{Config::Format::MPS};
+
+  /**
+   * Feed the `input` to a server and collect everything it writes back.
+   * @param input raw bytes sent to the server
+   * @return raw bytes received from the server
+   */
+  std::string Exchange(const std::string& input) {
+    int in_pipe[2], out_pipe[2];
+    EXPECT_EQ(pipe(in_pipe), 0);
+    EXPECT_EQ(pipe(out_pipe), 0);
+    EXPECT_EQ(write(in_pipe[1], input.data(), input.size()), static_cast<ssize_t>(input.size()));
+    close(in_pipe[1]);
+    {
+      Server server{config_};
+      server.Serve(in_pipe[0], out_pipe[1]);
+    }
+    close(in_pipe[0]);
+    close(out_pipe[1]);
+    std::string output;
+    char buffer[256];
+    ssize_t n;
+    while ((n = read(out_pipe[0], buffer, sizeof(buffer))) > 0) output.append(buffer, static_cast<std::size_t>(n));
+    close(out_pipe[0]);
+    return output;
+  }
+};
+
+TEST_F(TestServer, ParseRequestHeader) {
+  const ServerRequest request = Server::ParseRequestHeader("req-1 42");
+  EXPECT_EQ(request.id, "req-1");
+  EXPECT_EQ(request.size, 42u);
+  EXPECT_TRUE(request.options.empty());
+}
+
+TEST_F(TestServer, ParseRequestHeaderOptions) {
+  const ServerRequest request = Server::ParseRequestHeader("7 0 precision=0 produce-models=true");
+  EXPECT_EQ(request.id, "7");
+  EXPECT_EQ(request.size, 0u);
+  ASSERT_EQ(request.options.size(), 2u);
+  EXPECT_EQ(request.options[0].first, "precision");
+  EXPECT_EQ(request.options[0].second, "0");
+  EXPECT_EQ(request.options[1].first, "produce-models");
+  EXPECT_EQ(request.options[1].second, "true");
+}
+
+TEST_F(TestServer, ParseRequestHeaderMissingSize) {
+  EXPECT_THROW(static_cast<void>(Server::ParseRequestHeader("req-1")), DelpiInvalidArgumentException);
+}
+
+TEST_F(TestServer, ParseRequestHeaderInvalidSize) {
+  EXPECT_THROW(static_cast<void>(Server::ParseRequestHeader("req-1 -4")), DelpiInvalidArgumentException);
+  EXPECT_THROW(static_cast<void>(Server::ParseRequestHeader("req-1 4a")), DelpiInvalidArgumentException);
+}
+
+TEST_F(TestServer, ParseRequestHeaderTooLarge) {
+  const std::string max_size{std::to_string(Server::max_payload_size)};
+  EXPECT_EQ(Server::ParseRequestHeader("req-1 " + max_size).size, Server::max_payload_size);
+  EXPECT_THROW(static_cast<void>(Server::ParseRequestHeader("req-1 " + std::to_string(Server::max_payload_size + 1))),
+               DelpiInvalidArgumentException);
+  EXPECT_THROW(static_cast<void>(Server::ParseRequestHeader("req-1 18446744073709551615")),
+               DelpiInvalidArgumentException);
+  EXPECT_THROW(static_cast<void>(Server::ParseRequestHeader("req-1 99999999999999999999999")),
+               DelpiInvalidArgumentException);
+}
+
+TEST_F(TestServer, ParseRequestHeaderInvalidOption) {
+  EXPECT_THROW(static_cast<void>(Server::ParseRequestHeader("req-1 4 precision")), DelpiInvalidArgumentException);
+  EXPECT_THROW(static_cast<void>(Server::ParseRequestHeader("req-1 4 =1")), DelpiInvalidArgumentException);
+}
+
+TEST_F(TestServer, FormatResponse) {
+  EXPECT_EQ(Server::FormatResponse({"req-1", LpResult::OPTIMAL, "objective 1 1\n"}),
+            "req-1 optimal 14\nobjective 1 1\n");
+  EXPECT_EQ(Server::FormatResponse({"req-2", LpResult::INFEASIBLE, ""}), "req-2 infeasible 0\n");
+}
+
+TEST_F(TestServer, NumWorkers) {
+  config_.m_number_of_jobs() = 2u;
+  const Server server{config_};
+#ifdef DELPI_THREAD_SAFE
+  EXPECT_EQ(server.num_workers(), 2u);
+#else
+  EXPECT_EQ(server.num_workers(), 1u);
+#endif
+}
+
+#ifdef DELPI_ENABLED_QSOPTEX
+TEST_F(TestServer, NumWorkersQsoptex) {
+  // QSopt_ex relies on global state, so the problems are never built, parsed or solved in parallel
+  config_.m_number_of_jobs() = 2u;
+  config_.m_lp_solver() = Config::LpSolver::QSOPTEX;
+  const Server server{config_};
+  EXPECT_EQ(server.num_workers(), 1u);
+}
+#endif
+
+TEST_F(TestServer, ServeMalformedHeader) {
+  const std::string output = Exchange("not-a-valid-header\n");
+  EXPECT_EQ(output.rfind("- error ", 0), 0u);
+}
+
+TEST_F(TestServer, ServeTruncatedPayload) {
+  EXPECT_EQ(Exchange("req-1 100\nENDATA\n"), "req-1 error 17\nTruncated payload");
+}
+
+TEST_F(TestServer, ServeOversizedPayload) {
+  // The request is rejected with an error response instead of trying to allocate the payload
+  const std::string output = Exchange("req-1 18446744073709551615\nENDATA\n");
+  EXPECT_EQ(output.rfind("- error ", 0), 0u);
+  EXPECT_NE(output.find("exceeds the maximum"), std::string::npos);
+}
+
+TEST_F(TestServer, ServeEmptyInput) { EXPECT_EQ(Exchange(""), ""); }
+
+TEST_F(TestServer, ServeFeasible) {
+  const std::string payload{
+      "ROWS\n"
+      " N  obj\n"
+      " L  c1\n"
+      "COLUMNS\n"
+      "    x  obj  -1  c1  1\n"
+      "    y  c1  1\n"
+      "RHS\n"
+      "    rhs  c1  4\n"
+      "ENDATA\n"};
+  const std::string output = Exchange("req-1 " + std::to_string(payload.size()) + " precision=0\n" + payload);
+  EXPECT_EQ(output.rfind("req-1 optimal ", 0), 0u);
+  EXPECT_NE(output.find("\nobjective -4 -4\n"), std::string::npos);
+}
+
+TEST_F(TestServer, ServeMultipleRequests) {
+  const std::string payload{
+      "ROWS\n"
+      " N  obj\n"
+      " L  c1\n"
+      " G  c2\n"
+      "COLUMNS\n"
+      "    x  c1  1  c2  1\n"
+      "    y  c1  1  c2  1\n"
+      "RHS\n"
+      "    rhs  c1  1  c2  2\n"
+      "ENDATA\n"};
+  const std::string request = std::to_string(payload.size()) + "\n" + payload;
+  const std::string output = Exchange("a " + request + "b " + request);
+  EXPECT_NE(output.find("a infeasible 0\n"), std::string::npos);
+  EXPECT_NE(output.find("b infeasible 0\n"), std::string::npos);
+}
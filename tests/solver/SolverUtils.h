@@ -8,6 +8,18 @@
 
 #include <gtest/gtest.h>
 
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "delpi/libs/gmp.h"
+#include "delpi/solver/Basis.h"
+#include "delpi/solver/Column.h"
+#include "delpi/solver/LpSolver.h"
+#include "delpi/solver/Row.h"
+#include "delpi/symbolic/Expression.h"
+#include "delpi/symbolic/Formula.h"
+#include "delpi/symbolic/Variable.h"
 #include "delpi/util/Config.h"
 
 const auto enabled_test_solvers = ::testing::Values(
@@ -23,3 +35,37 @@ const auto enabled_test_solvers = ::testing::Values(
     delpi::Config::LpSolver::SOPLEX
 #endif
 );
+
+/**
+ * Fixture with the small LP problem @f$ \min -x - y @f$ s.t. @f$ x + 2y \le 4 @f$, @f$ 3x + y \le 6 @f$,
+ * @f$ x, y, z \ge 0 @f$, shared by the solver tests.
+ * The optimal solution is x = 8/5, y = 6/5 with both rows tight,
+ * with duals -2/5 and -1/5 and objective value -14/5.
+ * z does not appear in any row.
+ * @tparam Base googletest fixture to derive from
+ */
+template <class Base = ::testing::Test>
+class SmallLpTest : public Base {
+ protected:
+  /**
+   * Add the columns of x and y and the two rows of the problem to the `lp_solver`.
+   * @param lp_solver LP solver to add the problem to
+   */
+  void AddSmallLp(delpi::LpSolver& lp_solver) const {
+    lp_solver.AddColumn(x_, -1);
+    lp_solver.AddColumn(y_, -1);
+    lp_solver.AddRow(x_ + 2 * y_, delpi::FormulaKind::Leq, 4);
+    lp_solver.AddRow(3 * x_ + y_, delpi::FormulaKind::Leq, 6);
+  }
+
+  const delpi::Variable x_{"x"}, y_{"y"}, z_{"z"};
+  std::vector<delpi::Column> columns_{delpi::Column{x_, 0, std::nullopt, -1}, delpi::Column{y_, 0, std::nullopt, -1},
+                                      delpi::Column{z_, 0, std::nullopt, std::nullopt}};
+  const std::vector<delpi::Row> rows_{delpi::Row{{{x_, 1}, {y_, 2}}, std::nullopt, 4},
+                                      delpi::Row{{{x_, 3}, {y_, 1}}, std::nullopt, 6}};
+  const std::unordered_map<delpi::Variable, int> var_to_col_{{x_, 0}, {y_, 1}, {z_, 2}};
+  const delpi::Basis optimal_basis_{
+      {delpi::BasisStatus::BASIC, delpi::BasisStatus::BASIC, delpi::BasisStatus::AT_LOWER},
+      {delpi::BasisStatus::AT_UPPER, delpi::BasisStatus::AT_UPPER}};
+  const mpq_class optimum_{-14, 5};
+};
@@ -0,0 +1,98 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <sstream>
+#include <vector>
+
+#include "delpi/solver/BackendSelector.h"
+#include "delpi/util/exception.h"
+
+using delpi::BackendSelector;
+using delpi::Column;
+using delpi::Config;
+using delpi::DelpiException;
+using delpi::ModelFeatures;
+using delpi::Row;
+using delpi::Variable;
+using Feature = delpi::ModelFeatures::Feature;
+
+class TestBackendSelector : public ::testing::Test {
+ protected:
+  const Variable x_{"x"}, y_{"y"};
+  const std::vector<Column> columns_{Column{x_, 0, std::nullopt, 1}, Column{y_, 0, std::nullopt, 1}};
+  // Every number is an exact double
+  const ModelFeatures exact_{columns_, {Row{{{x_, 1}, {y_, 2}}, 1, std::nullopt}}};
+  // 1/3 is not an exact double
+  const ModelFeatures rational_{columns_, {Row{{{x_, mpq_class{1, 3}}, {y_, 2}}, 1, std::nullopt}}};
+  // A coefficient with hundreds of bits
+  const ModelFeatures large_{columns_, {Row{{{x_, mpq_class{mpz_class{1} << 600, 7}}, {y_, 2}}, 1, std::nullopt}}};
+  Config config_;
+};
+
+TEST_F(TestBackendSelector, DefaultRules) {
+  const BackendSelector selector{};
+  Config config{selector.Select(exact_, config_)};
+  EXPECT_EQ(config.lp_solver(), Config::LpSolver::SOPLEX);
+  EXPECT_EQ(config.lp_mode(), Config::LpMode::FLOAT_FIRST);
+
+  config = selector.Select(rational_, config_);
+  EXPECT_EQ(config.lp_solver(), Config::LpSolver::SOPLEX);
+  EXPECT_EQ(config.lp_mode(), Config::LpMode::HYBRID);
+
+  config = selector.Select(large_, config_);
+  EXPECT_EQ(config.lp_solver(), Config::LpSolver::QSOPTEX);
+  EXPECT_EQ(config.lp_mode(), Config::LpMode::PURE_PRECISION_BOOSTING);
+}
+
+TEST_F(TestBackendSelector, KeepMode) {
+  const BackendSelector selector{};
+  config_.m_lp_mode() = Config::LpMode::PURE_ITERATIVE_REFINEMENT;
+  // QSopt_ex does not support iterative refinement, so its rule is skipped
+  const Config config{selector.Select(large_, config_)};
+  EXPECT_EQ(config.lp_solver(), Config::LpSolver::SOPLEX);
+  EXPECT_EQ(config.lp_mode(), Config::LpMode::PURE_ITERATIVE_REFINEMENT);
+}
+
+TEST_F(TestBackendSelector, NoRule) {
+  const BackendSelector selector{std::vector<BackendSelector::Rule>{}};
+  const Config config{selector.Select(exact_, config_)};
+  EXPECT_EQ(config.lp_solver(), Config::LpSolver::SOPLEX);
+  EXPECT_EQ(config.lp_mode(), Config::LpMode::AUTO);
+}
+
+TEST_F(TestBackendSelector, Csv) {
+  std::stringstream ss{
+      "# Rules\n"
+      "feature,comparison,threshold,lp_solver,lp_mode\n"
+      "num_rows,<,2,qsoptex,auto\r\n"
+      "\n"
+      "density,>=,0.6,soplex,pure-iterative-refinement\n"
+      ",,,soplex,hybrid\n"};
+  const BackendSelector selector{ss};
+  ASSERT_EQ(selector.rules().size(), 3u);
+  EXPECT_EQ(selector.rules()[0].feature, Feature::NUM_ROWS);
+  EXPECT_FALSE(selector.rules()[0].at_least);
+  EXPECT_EQ(selector.rules()[0].threshold, 2);
+  EXPECT_EQ(selector.rules()[1].lp_mode, Config::LpMode::PURE_ITERATIVE_REFINEMENT);
+  EXPECT_FALSE(selector.rules()[2].feature.has_value());
+
+  EXPECT_EQ(selector.Select(exact_, config_).lp_solver(), Config::LpSolver::QSOPTEX);
+  const ModelFeatures sparse{columns_, {Row{{{x_, 1}}, 0, 1}, Row{{{y_, 1}}, 0, 1}, Row{{{y_, 2}}, 0, 1}}};
+  const Config config{selector.Select(sparse, config_)};
+  EXPECT_EQ(config.lp_solver(), Config::LpSolver::SOPLEX);
+  EXPECT_EQ(config.lp_mode(), Config::LpMode::HYBRID);
+}
+
+TEST_F(TestBackendSelector, MalformedCsv) {
+  for (const char* const line : {"num_rows,<,2,soplex", "not_a_feature,<,2,soplex,auto", "num_rows,>,2,soplex,auto",
+                                 "num_rows,<,two,soplex,auto", "num_rows,<,2,glpk,auto", "num_rows,<,2,soplex,fast",
+                                 "num_rows,<,2,qsoptex,hybrid"}) {
+    std::stringstream ss{line};
+    EXPECT_THROW(BackendSelector{ss}, DelpiException) << line;
+  }
+}
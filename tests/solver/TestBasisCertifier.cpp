@@ -0,0 +1,63 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <vector>
+
+#include "delpi/solver/BasisCertifier.h"
+#include "tests/solver/SolverUtils.h"
+
+using delpi::Basis;
+using delpi::BasisCertifier;
+using delpi::BasisStatus;
+
+class TestBasisCertifier : public SmallLpTest<> {
+ protected:
+  const BasisCertifier certifier_{columns_, rows_, var_to_col_};
+};
+
+TEST_F(TestBasisCertifier, OptimalBasis) {
+  const std::optional<BasisCertifier::Certificate> certificate = certifier_.Certify(optimal_basis_);
+  ASSERT_TRUE(certificate.has_value());
+  EXPECT_EQ(certificate->solution, (std::vector<mpq_class>{mpq_class{8, 5}, mpq_class{6, 5}, 0}));
+  EXPECT_EQ(certificate->dual_solution, (std::vector<mpq_class>{mpq_class{-2, 5}, mpq_class{-1, 5}}));
+  EXPECT_EQ(certificate->objective, mpq_class(-14, 5));
+}
+
+TEST_F(TestBasisCertifier, NotDualFeasible) {
+  // x = 2, y = 0 is a vertex, but increasing y improves the objective
+  const Basis basis{{BasisStatus::BASIC, BasisStatus::AT_LOWER, BasisStatus::AT_LOWER},
+                    {BasisStatus::BASIC, BasisStatus::AT_UPPER}};
+  EXPECT_FALSE(certifier_.Certify(basis).has_value());
+}
+
+TEST_F(TestBasisCertifier, NotPrimalFeasible) {
+  // x = 4, y = 0 violates the second row
+  const Basis basis{{BasisStatus::BASIC, BasisStatus::AT_LOWER, BasisStatus::AT_LOWER},
+                    {BasisStatus::AT_UPPER, BasisStatus::BASIC}};
+  EXPECT_FALSE(certifier_.Certify(basis).has_value());
+}
+
+TEST_F(TestBasisCertifier, SingularBasis) {
+  // z does not appear in any row
+  const Basis basis{{BasisStatus::BASIC, BasisStatus::AT_LOWER, BasisStatus::BASIC},
+                    {BasisStatus::AT_UPPER, BasisStatus::AT_UPPER}};
+  EXPECT_FALSE(certifier_.Certify(basis).has_value());
+}
+
+TEST_F(TestBasisCertifier, WrongNumberOfBasicVariables) {
+  const Basis basis{{BasisStatus::BASIC, BasisStatus::BASIC, BasisStatus::BASIC},
+                    {BasisStatus::AT_UPPER, BasisStatus::AT_UPPER}};
+  EXPECT_FALSE(certifier_.Certify(basis).has_value());
+}
+
+TEST_F(TestBasisCertifier, IncompatibleStatus) {
+  // x has no upper bound
+  const Basis basis{{BasisStatus::AT_UPPER, BasisStatus::BASIC, BasisStatus::AT_LOWER},
+                    {BasisStatus::AT_UPPER, BasisStatus::BASIC}};
+  EXPECT_FALSE(certifier_.Certify(basis).has_value());
+}
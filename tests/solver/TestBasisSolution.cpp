@@ -0,0 +1,95 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <vector>
+
+#include "delpi/solver/BasisSolution.h"
+#include "tests/solver/SolverUtils.h"
+
+using delpi::Basis;
+using delpi::BasisSolution;
+using delpi::BasisStatus;
+
+using TestBasisSolution = SmallLpTest<>;
+
+TEST_F(TestBasisSolution, OptimalBasis) {
+  const BasisSolution solution{columns_, rows_, var_to_col_, optimal_basis_};
+  ASSERT_TRUE(solution.solved());
+  EXPECT_TRUE(solution.primal_feasible());
+  EXPECT_TRUE(solution.dual_feasible());
+  EXPECT_TRUE(solution.optimal());
+  EXPECT_EQ(solution.basic_columns(), (std::vector<int>{0, 1}));
+  EXPECT_EQ(solution.tight_rows(), (std::vector<int>{0, 1}));
+  EXPECT_EQ(solution.solution(), (std::vector<mpq_class>{mpq_class{8, 5}, mpq_class{6, 5}, 0}));
+  EXPECT_EQ(solution.activity(), (std::vector<mpq_class>{4, 6}));
+  EXPECT_EQ(solution.dual_solution(), (std::vector<mpq_class>{mpq_class{-2, 5}, mpq_class{-1, 5}}));
+  EXPECT_EQ(solution.reduced_costs(), (std::vector<mpq_class>{0, 0, 0}));
+}
+
+TEST_F(TestBasisSolution, ReusesFactorisation) {
+  const BasisSolution solution{columns_, rows_, var_to_col_, optimal_basis_};
+  ASSERT_TRUE(solution.solved());
+  // Raising the right-hand side of the first row by one moves x by -1/5 and y by 3/5
+  EXPECT_EQ(solution.lu().Solve({1, 0}), (std::vector<mpq_class>{mpq_class{-1, 5}, mpq_class{3, 5}}));
+}
+
+TEST_F(TestBasisSolution, NotDualFeasible) {
+  // x = 2, y = 0 is a vertex, but increasing y improves the objective
+  const BasisSolution solution{columns_, rows_, var_to_col_,
+                               Basis{{BasisStatus::BASIC, BasisStatus::AT_LOWER, BasisStatus::AT_LOWER},
+                                     {BasisStatus::BASIC, BasisStatus::AT_UPPER}}};
+  ASSERT_TRUE(solution.solved());
+  EXPECT_TRUE(solution.primal_feasible());
+  EXPECT_FALSE(solution.dual_feasible());
+  EXPECT_FALSE(solution.optimal());
+  EXPECT_EQ(solution.solution(), (std::vector<mpq_class>{2, 0, 0}));
+  EXPECT_EQ(solution.reduced_costs(), (std::vector<mpq_class>{0, mpq_class{-2, 3}, 0}));
+}
+
+TEST_F(TestBasisSolution, NotPrimalFeasible) {
+  // x = 4, y = 0 violates the second row
+  const BasisSolution solution{columns_, rows_, var_to_col_,
+                               Basis{{BasisStatus::BASIC, BasisStatus::AT_LOWER, BasisStatus::AT_LOWER},
+                                     {BasisStatus::AT_UPPER, BasisStatus::BASIC}}};
+  ASSERT_TRUE(solution.solved());
+  EXPECT_FALSE(solution.primal_feasible());
+  EXPECT_FALSE(solution.optimal());
+  EXPECT_EQ(solution.activity(), (std::vector<mpq_class>{4, 12}));
+}
+
+TEST_F(TestBasisSolution, SingularBasis) {
+  // z does not appear in any row
+  const BasisSolution solution{columns_, rows_, var_to_col_,
+                               Basis{{BasisStatus::BASIC, BasisStatus::AT_LOWER, BasisStatus::BASIC},
+                                     {BasisStatus::AT_UPPER, BasisStatus::AT_UPPER}}};
+  EXPECT_FALSE(solution.solved());
+  EXPECT_FALSE(solution.optimal());
+}
+
+TEST_F(TestBasisSolution, StatusNotCompatibleWithBounds) {
+  // y has no upper bound
+  const BasisSolution solution{columns_, rows_, var_to_col_,
+                               Basis{{BasisStatus::BASIC, BasisStatus::AT_UPPER, BasisStatus::AT_LOWER},
+                                     {BasisStatus::BASIC, BasisStatus::AT_UPPER}}};
+  EXPECT_FALSE(solution.solved());
+  EXPECT_FALSE(solution.optimal());
+}
+
+TEST_F(TestBasisSolution, BasisDoesNotMatch) {
+  const BasisSolution solution{columns_, rows_, var_to_col_,
+                               Basis{{BasisStatus::BASIC, BasisStatus::BASIC}, {BasisStatus::AT_UPPER}}};
+  EXPECT_FALSE(solution.solved());
+  EXPECT_FALSE(solution.optimal());
+}
+
+TEST_F(TestBasisSolution, FixedBounds) {
+  EXPECT_TRUE(BasisSolution::FixedBounds(mpq_class{1}, mpq_class{1}));
+  EXPECT_FALSE(BasisSolution::FixedBounds(mpq_class{1}, mpq_class{2}));
+  EXPECT_FALSE(BasisSolution::FixedBounds(mpq_class{1}, std::nullopt));
+  EXPECT_FALSE(BasisSolution::FixedBounds(std::nullopt, std::nullopt));
+}
@@ -0,0 +1,101 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "delpi/solver/BoundPropagation.h"
+
+using delpi::BoundPropagation;
+using delpi::Column;
+using delpi::Row;
+using delpi::Variable;
+
+class TestBoundPropagation : public ::testing::Test {
+ protected:
+  const Variable x_{"x"}, y_{"y"}, z_{"z"};
+  const std::unordered_map<Variable, int> var_to_col_{{x_, 0}, {y_, 1}, {z_, 2}};
+};
+
+TEST_F(TestBoundPropagation, Upper) {
+  // x + y <= 4 with x, y >= 0
+  const std::vector<Column> columns{Column{x_, 0, std::nullopt, std::nullopt}, Column{y_, 0, std::nullopt, 1}};
+  const std::vector<Row> rows{Row{{{x_, 1}, {y_, 1}}, std::nullopt, 4}};
+  const BoundPropagation propagation{columns, rows, var_to_col_, 10};
+  EXPECT_FALSE(propagation.infeasible());
+  EXPECT_EQ(propagation.num_tightened(), 2);
+  EXPECT_EQ(propagation.rounds(), 1);
+  EXPECT_EQ(propagation.columns()[0].lb, 0);
+  EXPECT_EQ(propagation.columns()[0].ub, 4);
+  EXPECT_EQ(propagation.columns()[1].ub, 4);
+  EXPECT_EQ(propagation.columns()[1].obj, 1);
+}
+
+TEST_F(TestBoundPropagation, Exact) {
+  // 3x + 7y >= 1 with x <= 10 and y <= 0
+  const std::vector<Column> columns{Column{x_, std::nullopt, 10, std::nullopt},
+                                    Column{y_, std::nullopt, 0, std::nullopt}};
+  const std::vector<Row> rows{Row{{{x_, 3}, {y_, 7}}, 1, std::nullopt}};
+  const BoundPropagation propagation{columns, rows, var_to_col_, 10};
+  EXPECT_FALSE(propagation.infeasible());
+  EXPECT_EQ(propagation.columns()[0].lb, mpq_class(1, 3));
+  EXPECT_EQ(propagation.columns()[1].lb, mpq_class(-29, 7));
+}
+
+TEST_F(TestBoundPropagation, Worklist) {
+  // x - y <= 0 and y + z <= 3 with x, y, z >= 0: the bound on x only follows from the one on y
+  const std::vector<Column> columns{Column{x_, 0, std::nullopt, std::nullopt},
+                                    Column{y_, 0, std::nullopt, std::nullopt},
+                                    Column{z_, 0, std::nullopt, std::nullopt}};
+  const std::vector<Row> rows{Row{{{x_, 1}, {y_, -1}}, std::nullopt, 0}, Row{{{y_, 1}, {z_, 1}}, std::nullopt, 3}};
+  const BoundPropagation propagation{columns, rows, var_to_col_, 10};
+  EXPECT_EQ(propagation.rounds(), 2);
+  EXPECT_EQ(propagation.num_tightened(), 3);
+  EXPECT_EQ(propagation.columns()[0].ub, 3);
+  EXPECT_EQ(propagation.columns()[1].ub, 3);
+  EXPECT_EQ(propagation.columns()[2].ub, 3);
+}
+
+TEST_F(TestBoundPropagation, MaxRounds) {
+  const std::vector<Column> columns{Column{x_, 0, std::nullopt, std::nullopt},
+                                    Column{y_, 0, std::nullopt, std::nullopt},
+                                    Column{z_, 0, std::nullopt, std::nullopt}};
+  const std::vector<Row> rows{Row{{{x_, 1}, {y_, -1}}, std::nullopt, 0}, Row{{{y_, 1}, {z_, 1}}, std::nullopt, 3}};
+  const BoundPropagation propagation{columns, rows, var_to_col_, 1};
+  EXPECT_EQ(propagation.rounds(), 1);
+  EXPECT_EQ(propagation.columns()[0].ub, std::nullopt);
+  EXPECT_EQ(propagation.columns()[1].ub, 3);
+}
+
+TEST_F(TestBoundPropagation, SmallImprovement) {
+  // The new bound on x is less than 0.1% tighter than the current one, so it is discarded
+  const std::vector<Column> columns{Column{x_, 0, 1000, std::nullopt}, Column{y_, 0, 1, std::nullopt}};
+  const std::vector<Row> rows{Row{{{x_, 1}, {y_, 1}}, std::nullopt, mpq_class(99999, 100)}};
+  const BoundPropagation propagation{columns, rows, var_to_col_, 10};
+  EXPECT_EQ(propagation.num_tightened(), 0);
+  EXPECT_EQ(propagation.columns()[0].ub, 1000);
+}
+
+TEST_F(TestBoundPropagation, Infeasible) {
+  // x + y >= 5 with x, y in [0, 2]
+  const std::vector<Column> columns{Column{x_, 0, 2, std::nullopt}, Column{y_, 0, 2, std::nullopt}};
+  const std::vector<Row> rows{Row{{{x_, 1}, {y_, 1}}, 5, std::nullopt}};
+  const BoundPropagation propagation{columns, rows, var_to_col_, 10};
+  EXPECT_TRUE(propagation.infeasible());
+}
+
+TEST_F(TestBoundPropagation, InfeasibleAfterPropagation) {
+  // x - z >= 2 and x + y <= 1 with x, y, z >= 0: each row can be satisfied on its own, but not both
+  const std::vector<Column> columns{Column{x_, 0, std::nullopt, std::nullopt},
+                                    Column{y_, 0, std::nullopt, std::nullopt},
+                                    Column{z_, 0, std::nullopt, std::nullopt}};
+  const std::vector<Row> rows{Row{{{x_, 1}, {z_, -1}}, 2, std::nullopt}, Row{{{x_, 1}, {y_, 1}}, std::nullopt, 1}};
+  const BoundPropagation propagation{columns, rows, var_to_col_, 10};
+  EXPECT_TRUE(propagation.infeasible());
+  EXPECT_EQ(propagation.rounds(), 1);
+}
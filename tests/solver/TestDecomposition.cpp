@@ -0,0 +1,79 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "delpi/solver/Decomposition.h"
+
+using delpi::Decomposition;
+using delpi::Row;
+using delpi::Variable;
+
+class TestDecomposition : public ::testing::TestWithParam<unsigned int> {
+ protected:
+  const Variable x_{"x"}, y_{"y"}, z_{"z"}, w_{"w"};
+  const std::unordered_map<Variable, int> var_to_col_{{x_, 0}, {y_, 1}, {z_, 2}, {w_, 3}};
+};
+
+INSTANTIATE_TEST_SUITE_P(TestDecomposition, TestDecomposition, ::testing::Values(1u, 2u, 8u));
+
+TEST_P(TestDecomposition, SingleBlock) {
+  const std::vector<Row> rows{Row{{{x_, 1}, {y_, 1}}, 0, std::nullopt}, Row{{{y_, 1}, {z_, 2}}, std::nullopt, 1},
+                              Row{{{z_, 1}, {w_, -1}}, 0, 0}};
+  const Decomposition decomposition{rows, var_to_col_, 4, GetParam()};
+  ASSERT_EQ(decomposition.size(), 1u);
+  EXPECT_EQ(decomposition.blocks()[0].columns, (std::vector<int>{0, 1, 2, 3}));
+  EXPECT_EQ(decomposition.blocks()[0].rows, (std::vector<int>{0, 1, 2}));
+}
+
+TEST_P(TestDecomposition, IndependentBlocks) {
+  // The first and last rows share no column with each other, but they are joined by the third one
+  const std::vector<Row> rows{Row{{{y_, 1}, {w_, 1}}, 0, 1}, Row{{{x_, 1}}, 0, 1}, Row{{{w_, 2}}, 0, 1},
+                              Row{{{x_, 1}, {z_, 0}}, 0, 1}};
+  const Decomposition decomposition{rows, var_to_col_, 4, GetParam()};
+  ASSERT_EQ(decomposition.size(), 3u);
+  EXPECT_EQ(decomposition.blocks()[0].columns, (std::vector<int>{0}));
+  EXPECT_EQ(decomposition.blocks()[0].rows, (std::vector<int>{1, 3}));
+  EXPECT_EQ(decomposition.blocks()[1].columns, (std::vector<int>{1, 3}));
+  EXPECT_EQ(decomposition.blocks()[1].rows, (std::vector<int>{0, 2}));
+  // A zero coefficient does not join the columns
+  EXPECT_EQ(decomposition.blocks()[2].columns, (std::vector<int>{2}));
+  EXPECT_TRUE(decomposition.blocks()[2].rows.empty());
+  EXPECT_EQ(decomposition.column_block(), (std::vector<int>{0, 1, 2, 1}));
+}
+
+TEST_P(TestDecomposition, EmptyRows) {
+  const std::vector<Row> rows{Row{{}, 0, 1}, Row{{{x_, 1}, {y_, 1}, {z_, 1}, {w_, 1}}, 0, 1}, Row{{{y_, 0}}, 1, 2}};
+  const Decomposition decomposition{rows, var_to_col_, 4, GetParam()};
+  ASSERT_EQ(decomposition.size(), 3u);
+  EXPECT_EQ(decomposition.blocks()[0].rows, (std::vector<int>{1}));
+  EXPECT_TRUE(decomposition.blocks()[1].columns.empty());
+  EXPECT_EQ(decomposition.blocks()[1].rows, (std::vector<int>{0}));
+  EXPECT_TRUE(decomposition.blocks()[2].columns.empty());
+  EXPECT_EQ(decomposition.blocks()[2].rows, (std::vector<int>{2}));
+}
+
+TEST_P(TestDecomposition, Chain) {
+  // A long chain of rows split among the threads must still end up in a single block
+  constexpr int num_columns = 200;
+  std::vector<Variable> vars;
+  std::unordered_map<Variable, int> var_to_col;
+  for (int j = 0; j < num_columns; ++j) {
+    vars.emplace_back("x" + std::to_string(j));
+    var_to_col.emplace(vars.back(), j);
+  }
+  std::vector<Row> rows;
+  for (int j = num_columns - 1; j > 0; j -= 2) rows.push_back(Row{{{vars[j], 1}, {vars[j - 1], 1}}, 0, 1});
+  for (int j = 1; j + 1 < num_columns; j += 2) rows.push_back(Row{{{vars[j], 1}, {vars[j + 1], 1}}, 0, 1});
+  const Decomposition decomposition{rows, var_to_col, num_columns, GetParam()};
+  ASSERT_EQ(decomposition.size(), 1u);
+  EXPECT_EQ(decomposition.blocks()[0].columns.size(), static_cast<std::size_t>(num_columns));
+  EXPECT_EQ(decomposition.blocks()[0].rows.size(), rows.size());
+}
@@ -0,0 +1,139 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <vector>
+
+#include "delpi/solver/Dualization.h"
+#include "tests/solver/SolverUtils.h"
+
+using delpi::Basis;
+using delpi::BasisStatus;
+using delpi::Column;
+using delpi::Dualization;
+using delpi::Row;
+
+using TestDualization = SmallLpTest<>;
+
+TEST_F(TestDualization, Constructor) {
+  const Dualization dualization{columns_, rows_, var_to_col_};
+  // One column for the upper bound of each row, one for the lower bound of each column
+  ASSERT_EQ(dualization.columns().size(), 5u);
+  ASSERT_EQ(dualization.rows().size(), 3u);
+  EXPECT_EQ(dualization.columns()[0].obj, mpq_class{4});
+  EXPECT_EQ(dualization.columns()[1].obj, mpq_class{6});
+  for (const Column& column : dualization.columns()) {
+    EXPECT_EQ(column.lb, mpq_class{0});
+    EXPECT_FALSE(column.ub.has_value());
+  }
+  EXPECT_FALSE(dualization.columns()[2].obj.has_value());
+  const Row& x_row = dualization.rows()[0];
+  EXPECT_EQ(x_row.lb, mpq_class{-1});
+  EXPECT_EQ(x_row.ub, mpq_class{-1});
+  ASSERT_EQ(x_row.addends.size(), 3u);
+  EXPECT_EQ(x_row.addends[0].second, -1);
+  EXPECT_EQ(x_row.addends[1].second, -3);
+  EXPECT_EQ(x_row.addends[2].second, 1);
+  EXPECT_EQ(dualization.rows()[2].lb, mpq_class{0});
+}
+
+TEST_F(TestDualization, Solutions) {
+  const Dualization dualization{columns_, rows_, var_to_col_};
+  // The optimal solution of the dual problem and its duals
+  const std::vector<mpq_class> solution{mpq_class{2, 5}, mpq_class{1, 5}, 0, 0, 0};
+  const std::vector<mpq_class> dual_solution{mpq_class{-8, 5}, mpq_class{-6, 5}, 0};
+  for (const Row& row : dualization.rows()) {
+    mpq_class activity{0};
+    for (const auto& [var, coeff] : row.addends) {
+      for (std::size_t k = 0; k < dualization.columns().size(); ++k) {
+        if (dualization.columns()[k].var.equal_to(var)) activity += coeff * solution[k];
+      }
+    }
+    EXPECT_EQ(activity, row.lb.value());
+  }
+  EXPECT_EQ(dualization.PrimalSolution(dual_solution), (std::vector<mpq_class>{mpq_class{8, 5}, mpq_class{6, 5}, 0}));
+  EXPECT_EQ(dualization.DualSolution(solution), (std::vector<mpq_class>{mpq_class{-2, 5}, mpq_class{-1, 5}}));
+}
+
+TEST_F(TestDualization, PrimalBasis) {
+  const Dualization dualization{columns_, rows_, var_to_col_};
+  const Basis basis{{BasisStatus::BASIC, BasisStatus::BASIC, BasisStatus::AT_LOWER, BasisStatus::AT_LOWER,
+                     BasisStatus::BASIC},
+                    {BasisStatus::FIXED, BasisStatus::FIXED, BasisStatus::FIXED}};
+  const std::optional<Basis> primal_basis{dualization.PrimalBasis(basis)};
+  ASSERT_TRUE(primal_basis.has_value());
+  EXPECT_EQ(primal_basis->columns,
+            (std::vector<BasisStatus>{BasisStatus::BASIC, BasisStatus::BASIC, BasisStatus::AT_LOWER}));
+  EXPECT_EQ(primal_basis->rows, (std::vector<BasisStatus>{BasisStatus::AT_UPPER, BasisStatus::AT_UPPER}));
+
+  const Basis degenerate{{BasisStatus::BASIC, BasisStatus::BASIC, BasisStatus::AT_LOWER, BasisStatus::AT_LOWER,
+                          BasisStatus::AT_LOWER},
+                         {BasisStatus::FIXED, BasisStatus::FIXED, BasisStatus::BASIC}};
+  EXPECT_FALSE(dualization.PrimalBasis(degenerate).has_value());
+  EXPECT_FALSE(dualization.PrimalBasis(Basis{}).has_value());
+}
+
+TEST_F(TestDualization, EqualityAndRanges) {
+  // x + y = 2, 1 <= x - y <= 3, x fixed to 1, y free
+  const std::vector<Column> columns{Column{x_, 1, 1, std::nullopt}, Column{y_, std::nullopt, std::nullopt, 1}};
+  const std::vector<Row> rows{Row{{{x_, 1}, {y_, 1}}, 2, 2}, Row{{{x_, 1}, {y_, -1}}, 1, 3}};
+  const Dualization dualization{columns, rows, {{x_, 0}, {y_, 1}}};
+  // A free column for the equality, two for the ranged row and a free one for the fixed column
+  ASSERT_EQ(dualization.columns().size(), 4u);
+  EXPECT_FALSE(dualization.columns()[0].lb.has_value());
+  EXPECT_EQ(dualization.columns()[1].lb, mpq_class{0});
+  EXPECT_EQ(dualization.columns()[2].lb, mpq_class{0});
+  EXPECT_FALSE(dualization.columns()[3].lb.has_value());
+  EXPECT_EQ(dualization.columns()[2].obj, mpq_class{3});
+  EXPECT_EQ(dualization.rows()[1].addends.size(), 3u);
+  EXPECT_EQ(dualization.DualSolution(std::vector<mpq_class>{5, 1, 3, 7}), (std::vector<mpq_class>{5, -2}));
+}
+
+TEST_F(TestDualization, ReuseVariables) {
+  Dualization::Variables variables;
+  const Dualization first{columns_, rows_, var_to_col_, &variables};
+  const Dualization second{columns_, rows_, var_to_col_, &variables};
+  EXPECT_EQ(variables.rows.size(), 6u);
+  EXPECT_EQ(variables.columns.size(), 9u);
+  ASSERT_EQ(first.columns().size(), second.columns().size());
+  for (std::size_t k = 0; k < first.columns().size(); ++k) {
+    EXPECT_TRUE(first.columns()[k].var.equal_to(second.columns()[k].var));
+  }
+  // Without the variables to reuse, new ones are created
+  const Dualization fresh{columns_, rows_, var_to_col_};
+  EXPECT_FALSE(fresh.columns()[0].var.equal_to(first.columns()[0].var));
+
+  // Turning the first row into an equality needs a new free variable, while the others are still reused
+  std::vector<Row> rows{rows_};
+  rows[0].lb = 4;
+  const Dualization equality{columns_, rows, var_to_col_, &variables};
+  ASSERT_EQ(equality.columns().size(), first.columns().size());
+  EXPECT_FALSE(equality.columns()[0].var.equal_to(first.columns()[0].var));
+  for (std::size_t k = 1; k < first.columns().size(); ++k) {
+    EXPECT_TRUE(equality.columns()[k].var.equal_to(first.columns()[k].var));
+  }
+}
+
+TEST_F(TestDualization, SameStructure) {
+  Dualization::Variables variables;
+  const Dualization dualization{columns_, rows_, var_to_col_, &variables};
+  // New bounds and objective only change the objective and the row bounds of the dual problem
+  std::vector<Column> columns{columns_};
+  columns[0].obj = 3;
+  std::vector<Row> rows{rows_};
+  rows[1].ub = 7;
+  EXPECT_TRUE(dualization.SameStructure(Dualization{columns, rows, var_to_col_, &variables}));
+  // A new finite bound adds a column to the dual problem
+  columns[0].ub = 5;
+  EXPECT_FALSE(dualization.SameStructure(Dualization{columns, rows, var_to_col_, &variables}));
+  // A new coefficient changes the matrix
+  rows = rows_;
+  rows[0].addends.emplace_back(z_, 1);
+  EXPECT_FALSE(dualization.SameStructure(Dualization{columns_, rows, var_to_col_, &variables}));
+  // Without the same variables, the dual problems cannot be compared
+  EXPECT_FALSE(dualization.SameStructure(Dualization{columns_, rows_, var_to_col_}));
+}
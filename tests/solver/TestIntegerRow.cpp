@@ -0,0 +1,98 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "delpi/solver/IntegerRow.h"
+
+using delpi::IntegerRow;
+using delpi::Row;
+using delpi::Variable;
+
+class TestIntegerRow : public ::testing::Test {
+ protected:
+  const Variable x_{"x"}, y_{"y"}, z_{"z"};
+  const std::unordered_map<Variable, int> var_to_col_{{x_, 0}, {y_, 1}, {z_, 2}};
+};
+
+TEST_F(TestIntegerRow, SharedDenominator) {
+  // x / 4 + 3y / 10 - z / 6
+  const Row row{{{x_, mpq_class(1, 4)}, {y_, mpq_class(3, 10)}, {z_, mpq_class(-1, 6)}}, std::nullopt, 1};
+  const IntegerRow integer_row{row, var_to_col_};
+  ASSERT_EQ(integer_row.size(), 3u);
+  EXPECT_TRUE(integer_row.small());
+  EXPECT_EQ(integer_row.denominator(), 60);
+  EXPECT_EQ(integer_row.numerator(0), 15);
+  EXPECT_EQ(integer_row.numerator(1), 18);
+  EXPECT_EQ(integer_row.numerator(2), -10);
+  EXPECT_EQ(integer_row.columns(), (std::vector<int>{0, 1, 2}));
+}
+
+TEST_F(TestIntegerRow, SkipZeros) {
+  const std::vector<std::pair<int, mpq_class>> entries{{0, 2}, {1, 0}, {2, mpq_class(5, 3)}};
+  const IntegerRow integer_row{entries};
+  ASSERT_EQ(integer_row.size(), 2u);
+  EXPECT_EQ(integer_row.columns(), (std::vector<int>{0, 2}));
+  EXPECT_EQ(integer_row.denominator(), 3);
+  EXPECT_EQ(integer_row.numerator(0), 6);
+  EXPECT_EQ(integer_row.numerator(1), 5);
+}
+
+TEST_F(TestIntegerRow, Dot) {
+  const Row row{{{x_, mpq_class(1, 4)}, {y_, mpq_class(3, 10)}, {z_, mpq_class(-1, 6)}}, std::nullopt, 1};
+  const std::vector<mpq_class> values{mpq_class(2, 7), -5, mpq_class(3, 14)};
+  const IntegerRow point{values};
+  EXPECT_EQ(point.size(), 3u);
+  EXPECT_EQ(point.denominator(), 14);
+  EXPECT_FALSE(point.small());
+
+  mpq_class expected{0};
+  for (const auto& [var, coeff] : row.addends) expected += coeff * values[var_to_col_.at(var)];
+  const mpq_class activity{IntegerRow{row, var_to_col_}.Dot(point)};
+  EXPECT_EQ(activity, expected);
+  // The result is canonical
+  EXPECT_EQ(activity.get_den(), expected.get_den());
+}
+
+TEST_F(TestIntegerRow, LargeNumerators) {
+  // A numerator beyond the range of a machine word forces GMP integers for the whole row
+  const mpz_class word_max{std::numeric_limits<long>::max()};  // NOLINT(runtime/int)
+  const mpq_class huge{mpz_class{word_max * 8 + 1}, mpz_class{5}};
+  const Row row{{{x_, huge}, {z_, mpq_class(-1, 2)}}, 0, std::nullopt};
+  const IntegerRow integer_row{row, var_to_col_};
+  EXPECT_FALSE(integer_row.small());
+  EXPECT_EQ(integer_row.denominator(), 10);
+  EXPECT_EQ(integer_row.numerator(0), huge.get_num() * 2);
+  EXPECT_EQ(integer_row.numerator(1), -5);
+
+  const std::vector<mpq_class> values{mpq_class(1, 5), 4, mpq_class(-7, 5)};
+  const mpq_class expected{huge * values[0] - mpq_class(1, 2) * values[2]};
+  EXPECT_EQ(integer_row.Dot(IntegerRow{values}), expected);
+}
+
+TEST_F(TestIntegerRow, NegativeWordNumerators) {
+  // The smallest machine word still fits, and is subtracted correctly
+  const mpq_class min{mpz_class{std::numeric_limits<long>::min()}};  // NOLINT(runtime/int)
+  const std::vector<std::pair<int, mpq_class>> entries{{1, min}, {2, 1}};
+  const IntegerRow integer_row{entries};
+  EXPECT_TRUE(integer_row.small());
+  const std::vector<mpq_class> values{0, mpq_class(3, 2), 1};
+  EXPECT_EQ(integer_row.Dot(IntegerRow{values}), min * mpq_class(3, 2) + 1);
+}
+
+TEST_F(TestIntegerRow, Empty) {
+  const IntegerRow integer_row{Row{{}, std::nullopt, std::nullopt}, var_to_col_};
+  EXPECT_EQ(integer_row.size(), 0u);
+  EXPECT_FALSE(integer_row.small());
+  EXPECT_EQ(integer_row.denominator(), 1);
+  const std::vector<mpq_class> values{1, 2, 3};
+  EXPECT_EQ(integer_row.Dot(IntegerRow{values}), 0);
+}
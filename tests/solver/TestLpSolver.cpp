@@ -5,7 +5,11 @@
  */
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <vector>
+
 #include "delpi/solver/LpSolver.h"
+#include "delpi/util/exception.h"
 #include "tests/solver/SolverUtils.h"
 
 using delpi::Config;
@@ -14,12 +18,13 @@ using delpi::Formula;
 using delpi::FormulaKind;
 using delpi::LpResult;
 using delpi::LpSolver;
+using delpi::Scenario;
+using delpi::ScenarioResult;
 using delpi::Variable;
 
-class TestLpSolver : public ::testing::TestWithParam<Config::LpSolver> {
+class TestLpSolver : public SmallLpTest<::testing::TestWithParam<Config::LpSolver>> {
  protected:
   Config config_;
-  Variable x_{"x"}, y_{"y"}, z_{"z"};
   std::unique_ptr<LpSolver> solver_;
 
   TestLpSolver() {
@@ -110,6 +115,626 @@ TEST_P(TestLpSolver, Optimise) {
   EXPECT_EQ(solver_->solution(y_), 10);
 }
 
+TEST_P(TestLpSolver, RemoveRows) {
+  solver_->AddColumn(x_, 9);
+  solver_->AddColumn(y_, 1);
+  solver_->AddRow(x_ + y_, FormulaKind::Geq, 10);
+  solver_->AddRow(y_ - x_, FormulaKind::Leq, 4);
+  solver_->AddRow(x_ + 2 * y_, FormulaKind::Geq, 1);
+  mpq_class precision{0};
+  ASSERT_EQ(solver_->Solve(precision), delpi::LpResult::OPTIMAL);
+  EXPECT_EQ(solver_->solution(x_), 3);
+  EXPECT_EQ(solver_->solution(y_), 7);
+
+  const std::vector<int> rows{1, 2, 1};
+  solver_->RemoveRows(rows);
+  ASSERT_EQ(solver_->num_rows(), 1);
+  EXPECT_TRUE(solver_->solution().empty());
+  EXPECT_EQ(solver_->row(0).lb.value(), 10);
+  ASSERT_EQ(solver_->Solve(precision), delpi::LpResult::OPTIMAL);
+  EXPECT_EQ(solver_->solution(x_), 0);
+  EXPECT_EQ(solver_->solution(y_), 10);
+}
+
+TEST_P(TestLpSolver, RemoveColumns) {
+  solver_->AddColumn(x_, 9);
+  solver_->AddColumn(y_, 1);
+  solver_->AddColumn(z_, 2);
+  solver_->AddRow(x_ + y_ + z_, FormulaKind::Geq, 10);
+  solver_->AddRow(x_ - y_ + z_, FormulaKind::Leq, 20);
+
+  const std::vector<int> columns{1};
+  solver_->RemoveColumns(columns);
+  ASSERT_EQ(solver_->num_columns(), 2);
+  EXPECT_FALSE(solver_->var_to_col().contains(y_));
+  EXPECT_EQ(solver_->var_to_col().at(z_), 1);
+  EXPECT_TRUE(solver_->var(1).equal_to(z_));
+  EXPECT_EQ(solver_->column(1).obj.value(), 2);
+  for (int i = 0; i < solver_->num_rows(); ++i) {
+    ASSERT_EQ(solver_->row(i).addends.size(), 2u);
+    for (const auto& [var, coeff] : solver_->row(i).addends) EXPECT_FALSE(var.equal_to(y_));
+  }
+  mpq_class precision{0};
+  ASSERT_EQ(solver_->Solve(precision), delpi::LpResult::OPTIMAL);
+  EXPECT_EQ(solver_->solution(x_), 0);
+  EXPECT_EQ(solver_->solution(z_), 10);
+}
+
+TEST_P(TestLpSolver, PushPopRows) {
+  solver_->AddColumn(x_, 9);
+  solver_->AddColumn(y_, 1);
+  solver_->AddRow(x_ + y_, FormulaKind::Geq, 10);
+  mpq_class precision{0};
+  ASSERT_EQ(solver_->Solve(precision), delpi::LpResult::OPTIMAL);
+  EXPECT_EQ(solver_->solution(y_), 10);
+
+  solver_->Push();
+  EXPECT_EQ(solver_->num_scopes(), 1);
+  solver_->AddRow(y_ - x_, FormulaKind::Leq, 4);
+  ASSERT_EQ(solver_->Solve(precision), delpi::LpResult::OPTIMAL);
+  EXPECT_EQ(solver_->solution(x_), 3);
+  EXPECT_EQ(solver_->solution(y_), 7);
+
+  solver_->Pop();
+  EXPECT_EQ(solver_->num_scopes(), 0);
+  EXPECT_EQ(solver_->num_rows(), 1);
+  ASSERT_EQ(solver_->Solve(precision), delpi::LpResult::OPTIMAL);
+  EXPECT_EQ(solver_->solution(x_), 0);
+  EXPECT_EQ(solver_->solution(y_), 10);
+}
+
+TEST_P(TestLpSolver, PushPopBoundsAndObjective) {
+  solver_->AddColumn(x_, 9, 0, 20);
+  solver_->AddColumn(y_, 1, 0, 20);
+  solver_->AddRow(x_ + y_, FormulaKind::Geq, 10);
+
+  solver_->Push();
+  solver_->SetBound(y_, 0, 6);
+  solver_->Push();
+  solver_->SetObjective(y_, 10);
+  mpq_class precision{0};
+  ASSERT_EQ(solver_->Solve(precision), delpi::LpResult::OPTIMAL);
+  EXPECT_EQ(solver_->solution(x_), 10);
+  EXPECT_EQ(solver_->solution(y_), 0);
+
+  solver_->Pop();
+  EXPECT_EQ(solver_->column(1).obj.value(), 1);
+  ASSERT_EQ(solver_->Solve(precision), delpi::LpResult::OPTIMAL);
+  EXPECT_EQ(solver_->solution(x_), 4);
+  EXPECT_EQ(solver_->solution(y_), 6);
+
+  solver_->Pop();
+  EXPECT_EQ(solver_->column(1).ub.value(), 20);
+  ASSERT_EQ(solver_->Solve(precision), delpi::LpResult::OPTIMAL);
+  EXPECT_EQ(solver_->solution(x_), 0);
+  EXPECT_EQ(solver_->solution(y_), 10);
+}
+
+TEST_P(TestLpSolver, PopMultipleScopes) {
+  solver_->AddColumn(x_, 1);
+  solver_->AddRow(2 * x_, FormulaKind::Geq, 2);
+  solver_->Push();
+  solver_->AddColumn(y_, 1);
+  solver_->AddRow(x_ + y_, FormulaKind::Geq, 5);
+  solver_->Push();
+  solver_->AddColumn(z_, 1);
+  solver_->AddRow(x_ + z_, FormulaKind::Geq, 7);
+  solver_->SetBound(y_, 2, 3);
+  ASSERT_EQ(solver_->num_columns(), 3);
+
+  solver_->Pop(2);
+  EXPECT_EQ(solver_->num_scopes(), 0);
+  EXPECT_EQ(solver_->num_columns(), 1);
+  EXPECT_EQ(solver_->num_rows(), 1);
+  EXPECT_FALSE(solver_->var_to_col().contains(y_));
+  EXPECT_FALSE(solver_->var_to_col().contains(z_));
+  EXPECT_EQ(solver_->variables().size(), 1u);
+  mpq_class precision{0};
+  ASSERT_EQ(solver_->Solve(precision), delpi::LpResult::OPTIMAL);
+  EXPECT_EQ(solver_->solution(x_), 1);
+}
+
+TEST_P(TestLpSolver, PushPopRowBound) {
+  solver_->AddColumn(x_, 1, 0, 20);
+  solver_->AddColumn(y_, 2, 0, 20);
+  solver_->AddRow(x_ + y_, FormulaKind::Geq, 10);
+
+  solver_->Push();
+  solver_->SetRowBound(0, 15, solver_->infinity());
+  mpq_class precision{0};
+  ASSERT_EQ(solver_->Solve(precision), LpResult::OPTIMAL);
+  EXPECT_EQ(solver_->solution(x_), 15);
+
+  solver_->Pop();
+  EXPECT_EQ(solver_->row(0).lb.value(), 10);
+  ASSERT_EQ(solver_->Solve(precision), LpResult::OPTIMAL);
+  EXPECT_EQ(solver_->solution(x_), 10);
+}
+
+TEST_P(TestLpSolver, SolveScenarios) {
+  const std::vector<Scenario> scenarios{
+      {"base", {}, {}},
+      {"rhs", {{0, 15, std::nullopt}}, {}},
+      {"bound", {}, {{0, 0, 4}}},
+      {"both", {{0, 12, std::nullopt}}, {{0, 0, 4}}},
+  };
+  for (const unsigned int jobs : {1u, 3u}) {
+    config_.m_number_of_jobs() = jobs;
+    const std::unique_ptr<LpSolver> solver{LpSolver::GetInstance(config_)};
+    solver->AddColumn(x_, 1, 0, 20);
+    solver->AddColumn(y_, 2, 0, 20);
+    solver->AddRow(x_ + y_, FormulaKind::Geq, 10);
+
+    const std::vector<ScenarioResult> results{solver->SolveScenarios(scenarios, 0, true)};
+    ASSERT_EQ(results.size(), scenarios.size());
+    const std::vector<mpq_class> objectives{10, 15, 16, 20};
+    for (std::size_t i = 0; i < results.size(); ++i) {
+      EXPECT_EQ(results[i].name, scenarios[i].name);
+      ASSERT_EQ(results[i].result, LpResult::OPTIMAL);
+      EXPECT_EQ(results[i].obj_lb, objectives[i]);
+    }
+    EXPECT_EQ(results[2].solution, (std::vector<mpq_class>{4, 6}));
+
+    // The problem is left unchanged
+    EXPECT_EQ(solver->num_scopes(), 0);
+    EXPECT_EQ(solver->row(0).lb.value(), 10);
+    EXPECT_EQ(solver->column(0).ub.value(), 20);
+  }
+}
+
+TEST_P(TestLpSolver, Clone) {
+  solver_->AddColumn(x_, 1, 0, 20);
+  solver_->AddColumn(y_, 2, 0, 20);
+  solver_->AddRow(x_ + y_, FormulaKind::Geq, 10);
+  mpq_class precision{0};
+  ASSERT_EQ(solver_->Solve(precision), LpResult::OPTIMAL);
+
+  const std::unique_ptr<LpSolver> clone{solver_->Clone()};
+  EXPECT_EQ(clone->num_columns(), solver_->num_columns());
+  EXPECT_EQ(clone->num_rows(), solver_->num_rows());
+  ASSERT_EQ(clone->Solve(precision), LpResult::OPTIMAL);
+  EXPECT_EQ(clone->solution(x_), 10);
+  EXPECT_EQ(clone->solution(y_), 0);
+}
+
+TEST_P(TestLpSolver, SelectBackend) {
+  EXPECT_EQ(solver_->SelectBackend(), nullptr);
+
+  config_.m_lp_solver() = Config::LpSolver::AUTO;
+  const std::unique_ptr<LpSolver> solver{LpSolver::GetInstance(config_)};
+  solver->AddColumn(x_, 1, 0, 20);
+  solver->AddColumn(y_, 2, 0, 20);
+  solver->AddRow(x_ + y_, FormulaKind::Geq, 10);
+  int calls = 0;
+  solver->m_solve_cb() = [&calls](const LpSolver&, const LpResult, const std::vector<mpq_class>&,
+                                  const std::vector<mpq_class>&, const mpq_class&, const mpq_class&,
+                                  const mpq_class&) { ++calls; };
+
+  // Every number of the problem is an exact double
+  const std::unique_ptr<LpSolver> selected{solver->SelectBackend()};
+  ASSERT_NE(selected, nullptr);
+  EXPECT_EQ(selected->config().lp_solver(), Config::LpSolver::SOPLEX);
+  EXPECT_EQ(selected->config().lp_mode(), Config::LpMode::FLOAT_FIRST);
+  EXPECT_EQ(selected->num_columns(), 2);
+  EXPECT_EQ(selected->num_rows(), 1);
+  mpq_class precision{0};
+  ASSERT_EQ(selected->Solve(precision), LpResult::OPTIMAL);
+  EXPECT_EQ(selected->solution(x_), 10);
+  EXPECT_EQ(calls, 1);
+}
+
+TEST_P(TestLpSolver, SetBasis) {
+  AddSmallLp(*solver_);
+
+  using delpi::BasisStatus;
+  using delpi::DelpiException;
+  EXPECT_THROW(solver_->SetBasis({{BasisStatus::BASIC}, {BasisStatus::BASIC, BasisStatus::BASIC}}), DelpiException);
+  EXPECT_THROW(solver_->SetBasis({{BasisStatus::BASIC, BasisStatus::BASIC}, {BasisStatus::BASIC, BasisStatus::BASIC}}),
+               DelpiException);
+  EXPECT_THROW(
+      solver_->SetBasis({{BasisStatus::BASIC, BasisStatus::UNDEFINED}, {BasisStatus::BASIC, BasisStatus::AT_UPPER}}),
+      DelpiException);
+
+  // Start from the optimal basis
+  solver_->SetBasis({{BasisStatus::BASIC, BasisStatus::BASIC}, {BasisStatus::AT_UPPER, BasisStatus::AT_UPPER}});
+  mpq_class precision{0};
+  ASSERT_EQ(solver_->Solve(precision), LpResult::OPTIMAL);
+  EXPECT_EQ(solver_->solution(x_), mpq_class(8, 5));
+  EXPECT_EQ(solver_->solution(y_), mpq_class(6, 5));
+}
+
+TEST_P(TestLpSolver, BasisRowStatus) {
+  // min -x + y s.t. x + y <= 4, y >= 1, x - y >= -5, x, y >= 0. The optimal solution is x = 3, y = 1
+  solver_->AddColumn(x_, -1);
+  solver_->AddColumn(y_, 1);
+  solver_->AddRow(x_ + y_, FormulaKind::Leq, 4);
+  solver_->AddRow(Expression{y_}, FormulaKind::Geq, 1);
+  solver_->AddRow(x_ - y_, FormulaKind::Geq, -5);
+  mpq_class precision{0};
+  ASSERT_EQ(solver_->Solve(precision), delpi::LpResult::OPTIMAL);
+
+  // The status of a row tells which of its bounds its activity is equal to, whatever the backend
+  using delpi::BasisStatus;
+  const delpi::Basis basis{solver_->basis()};
+  EXPECT_EQ(basis.columns, (std::vector<BasisStatus>{BasisStatus::BASIC, BasisStatus::BASIC}));
+  EXPECT_EQ(basis.rows, (std::vector<BasisStatus>{BasisStatus::AT_UPPER, BasisStatus::AT_LOWER, BasisStatus::BASIC}));
+
+  // Loading the basis back leaves the solver at the same optimum
+  solver_->SetBasis(basis);
+  ASSERT_EQ(solver_->Solve(precision), delpi::LpResult::OPTIMAL);
+  EXPECT_EQ(solver_->solution(x_), 3);
+  EXPECT_EQ(solver_->solution(y_), 1);
+  EXPECT_EQ(solver_->basis().rows, basis.rows);
+}
+
+TEST_P(TestLpSolver, WarmStartPdhg) {
+  config_.m_warm_start() = Config::WarmStart::PDHG;
+  const std::unique_ptr<LpSolver> solver{LpSolver::GetInstance(config_)};
+  // min -x - y s.t. x + 2y <= 4, 3x + y <= 6, x - y >= -5, x, y >= 0. The optimal solution is x = 8/5, y = 6/5
+  AddSmallLp(*solver);
+  solver->AddRow(x_ - y_, FormulaKind::Geq, -5);
+  mpq_class precision{0};
+  ASSERT_EQ(solver->Solve(precision), LpResult::OPTIMAL);
+  EXPECT_EQ(solver->solution(x_), mpq_class(8, 5));
+  EXPECT_EQ(solver->solution(y_), mpq_class(6, 5));
+}
+
+TEST_P(TestLpSolver, WarmStartCrash) {
+  config_.m_warm_start() = Config::WarmStart::CRASH;
+  const std::unique_ptr<LpSolver> solver{LpSolver::GetInstance(config_)};
+  // min -x - y s.t. x + 2y <= 4, 3x + y <= 6, x - y = 0, x, y >= 0. The optimal solution is x = y = 4/3
+  AddSmallLp(*solver);
+  solver->AddRow(x_ - y_, FormulaKind::Eq, 0);
+  mpq_class precision{0};
+  ASSERT_EQ(solver->Solve(precision), LpResult::OPTIMAL);
+  EXPECT_EQ(solver->solution(x_), mpq_class(4, 3));
+  EXPECT_EQ(solver->solution(y_), mpq_class(4, 3));
+}
+
+TEST_P(TestLpSolver, WarmStartCrashPhase1) {
+  if (GetParam() != Config::LpSolver::QSOPTEX) GTEST_SKIP() << "Only QSopt_ex counts the phase 1 iterations";
+  // min 2x + 3y + 2z s.t. x + y >= 2, y + z >= 3, x, y, z >= 0. The optimal solution is x = 0, y = 2, z = 1.
+  // The slack basis is infeasible, while the crash basis, with x and z basic, is already feasible
+  config_.m_with_timings() = true;
+  std::vector<std::uint64_t> phase_1_iterations;
+  for (const Config::WarmStart warm_start : {Config::WarmStart::NONE, Config::WarmStart::CRASH}) {
+    config_.m_warm_start() = warm_start;
+    const std::unique_ptr<LpSolver> solver{LpSolver::GetInstance(config_)};
+    solver->AddColumn(x_, 2);
+    solver->AddColumn(y_, 3);
+    solver->AddColumn(z_, 2);
+    solver->AddRow(x_ + y_, FormulaKind::Geq, 2);
+    solver->AddRow(y_ + z_, FormulaKind::Geq, 3);
+    mpq_class precision{0};
+    ASSERT_EQ(solver->Solve(precision), LpResult::OPTIMAL);
+    EXPECT_EQ(solver->solution(), (std::vector<mpq_class>{0, 2, 1}));
+    phase_1_iterations.push_back(solver->profiler().counter("solve/simplex", "phase_1_iterations"));
+  }
+  // The crash basis reaches the double precision stage of QSopt_ex, which skips phase 1
+  EXPECT_LT(phase_1_iterations[1], phase_1_iterations[0]);
+}
+
+TEST_P(TestLpSolver, SimplexAlgorithm) {
+  for (const Config::SimplexAlgorithm simplex :
+       {Config::SimplexAlgorithm::PRIMAL, Config::SimplexAlgorithm::DUAL, Config::SimplexAlgorithm::AUTO}) {
+    for (const Config::Pricing pricing :
+         {Config::Pricing::AUTO, Config::Pricing::DANTZIG, Config::Pricing::DEVEX, Config::Pricing::STEEPEST}) {
+      config_.m_simplex() = simplex;
+      config_.m_pricing() = pricing;
+      const std::unique_ptr<LpSolver> solver{LpSolver::GetInstance(config_)};
+      AddSmallLp(*solver);
+      mpq_class precision{0};
+      ASSERT_EQ(solver->Solve(precision), LpResult::OPTIMAL);
+      EXPECT_EQ(solver->solution(x_), mpq_class(8, 5));
+      EXPECT_EQ(solver->solution(y_), mpq_class(6, 5));
+
+      // Only bounds change, then only the objective: min -3x - y, whose optimal solution is still x = 1, y = 3/2
+      solver->SetBound(x_, 0, 1);
+      ASSERT_EQ(solver->Solve(precision), LpResult::OPTIMAL);
+      EXPECT_EQ(solver->solution(x_), 1);
+      EXPECT_EQ(solver->solution(y_), mpq_class(3, 2));
+      solver->SetObjective(x_, -3);
+      ASSERT_EQ(solver->Solve(precision), LpResult::OPTIMAL);
+      EXPECT_EQ(solver->solution(x_), 1);
+      EXPECT_EQ(solver->solution(y_), mpq_class(3, 2));
+    }
+  }
+}
+
+TEST_P(TestLpSolver, Restarts) {
+  config_.m_restarts() = 4;
+  config_.m_random_seed() = 42;
+  const std::unique_ptr<LpSolver> solver{LpSolver::GetInstance(config_)};
+  // min -x - y s.t. x + 2y <= 4, 3x + y <= 6, x, y, z >= 0. The optimal solution is x = 8/5, y = 6/5
+  solver->AddColumn(x_, -1);
+  solver->AddColumn(y_, -1);
+  solver->AddColumn(z_);
+  solver->AddRow(x_ + 2 * y_, FormulaKind::Leq, 4);
+  solver->AddRow(3 * x_ + y_ + z_, FormulaKind::Leq, 6);
+  mpq_class precision{0};
+  ASSERT_EQ(solver->Solve(precision), LpResult::OPTIMAL);
+  EXPECT_EQ(solver->solution(x_), mpq_class(8, 5));
+  EXPECT_EQ(solver->solution(y_), mpq_class(6, 5));
+  EXPECT_EQ(solver->solution(z_), 0);
+  ASSERT_EQ(solver->dual_solution().size(), 2u);
+  EXPECT_NE(solver->dual_solution()[0], 0);
+  EXPECT_NE(solver->dual_solution()[1], 0);
+
+  // The next solve starts from the basis of the winner
+  solver->SetBound(x_, 0, 1);
+  ASSERT_EQ(solver->Solve(precision), LpResult::OPTIMAL);
+  EXPECT_EQ(solver->solution(x_), 1);
+  EXPECT_EQ(solver->solution(y_), mpq_class(3, 2));
+}
+
+TEST_P(TestLpSolver, Propagation) {
+  config_.m_propagation_rounds() = 10;
+  const std::unique_ptr<LpSolver> solver{LpSolver::GetInstance(config_)};
+  AddSmallLp(*solver);
+  mpq_class precision{0};
+  ASSERT_EQ(solver->Solve(precision), LpResult::OPTIMAL);
+  EXPECT_EQ(solver->solution(x_), mpq_class(8, 5));
+  EXPECT_EQ(solver->solution(y_), mpq_class(6, 5));
+  // The implied bounds x, y <= 2 are only used during the solve
+  EXPECT_FALSE(solver->column(0).ub.has_value());
+  EXPECT_FALSE(solver->column(1).ub.has_value());
+
+  // The bounds implied by the rows of a closed scope do not outlive it
+  solver->Push();
+  solver->AddRow(x_ + 4 * y_, FormulaKind::Leq, 2);
+  ASSERT_EQ(solver->Solve(precision), LpResult::OPTIMAL);
+  EXPECT_EQ(solver->solution(x_), 2);
+  EXPECT_EQ(solver->solution(y_), 0);
+  solver->Pop();
+  ASSERT_EQ(solver->Solve(precision), LpResult::OPTIMAL);
+  EXPECT_EQ(solver->solution(x_), mpq_class(8, 5));
+  EXPECT_EQ(solver->solution(y_), mpq_class(6, 5));
+}
+
+TEST_P(TestLpSolver, PropagationDuals) {
+  using delpi::BasisStatus;
+  config_.m_propagation_rounds() = 10;
+  const std::unique_ptr<LpSolver> solver{LpSolver::GetInstance(config_)};
+  // min x s.t. x + y >= 1, y <= 0, x >= 0. Propagation implies x >= 1, which is active at the optimum
+  solver->AddColumn(x_, 1);
+  solver->AddColumn(y_, 0, -1, 0);
+  solver->AddRow(x_ + y_, FormulaKind::Geq, 1);
+  mpq_class precision{0};
+  ASSERT_EQ(solver->Solve(precision), LpResult::OPTIMAL);
+  EXPECT_EQ(solver->solution(x_), 1);
+  EXPECT_EQ(solver->column(0).lb, 0);
+  // The reduced cost of the implied bound belongs to the row that implied it
+  ASSERT_EQ(solver->dual_solution().size(), 1u);
+  EXPECT_EQ(solver->dual_solution()[0], 1);
+  ASSERT_EQ(solver->basis().columns.size(), 2u);
+  EXPECT_EQ(solver->basis().columns[0], BasisStatus::BASIC);
+}
+
+TEST_P(TestLpSolver, Scaling) {
+  // min -x - y s.t. 1000x + 2000y <= 4000, 3x / 1000 + y / 1000 <= 6 / 1000, x, y >= 0.
+  // The optimal solution is x = 8/5, y = 6/5
+  std::vector<mpq_class> solution, dual_solution;
+  for (const bool scaling : {false, true}) {
+    config_.m_scaling() = scaling;
+    const std::unique_ptr<LpSolver> solver{LpSolver::GetInstance(config_)};
+    solver->AddColumn(x_, -1);
+    solver->AddColumn(y_, -1);
+    solver->AddRow(1000 * x_ + 2000 * y_, FormulaKind::Leq, 4000);
+    solver->AddRow(mpq_class(3, 1000) * x_ + mpq_class(1, 1000) * y_, FormulaKind::Leq, mpq_class(6, 1000));
+    mpq_class precision{0};
+    ASSERT_EQ(solver->Solve(precision), LpResult::OPTIMAL);
+    EXPECT_EQ(solver->solution(x_), mpq_class(8, 5));
+    EXPECT_EQ(solver->solution(y_), mpq_class(6, 5));
+    ASSERT_EQ(solver->dual_solution().size(), 2u);
+    if (!scaling) {
+      solution = solver->solution();
+      dual_solution = solver->dual_solution();
+      continue;
+    }
+    // The solution and dual solution of the scaled problem are mapped back exactly
+    EXPECT_EQ(solver->solution(), solution);
+    EXPECT_EQ(solver->dual_solution(), dual_solution);
+  }
+}
+
+TEST_P(TestLpSolver, MemoryLean) {
+  // min -x - y s.t. x + 2y <= 4, 3x + y <= 6, x, y >= 0. The optimal solution is x = 8/5, y = 6/5
+  for (const bool memory_lean : {false, true}) {
+    config_.m_memory_lean() = memory_lean;
+    const std::unique_ptr<LpSolver> solver{LpSolver::GetInstance(config_)};
+    solver->ReserveColumns(2);
+    solver->ReserveRows(2);
+    AddSmallLp(*solver);
+    // The problem can be read back before the first solve, wherever it is stored
+    ASSERT_EQ(solver->num_rows(), 2);
+    EXPECT_EQ(solver->row(1).addends.size(), 2u);
+    EXPECT_EQ(solver->row(1).ub, 6);
+    EXPECT_EQ(solver->column(0).obj, -1);
+    mpq_class precision{0};
+    ASSERT_EQ(solver->Solve(precision), LpResult::OPTIMAL);
+    EXPECT_EQ(solver->solution(x_), mpq_class(8, 5));
+    EXPECT_EQ(solver->solution(y_), mpq_class(6, 5));
+  }
+}
+
+TEST_P(TestLpSolver, Sensitivity) {
+  AddSmallLp(*solver_);
+  mpq_class precision{0};
+  ASSERT_EQ(solver_->Solve(precision), LpResult::OPTIMAL);
+
+  const delpi::SensitivityReport report{solver_->Sensitivity()};
+  ASSERT_EQ(report.objective.size(), 2u);
+  EXPECT_EQ(report.objective[0].lb, mpq_class{-3});
+  EXPECT_EQ(report.objective[0].ub, mpq_class(-1, 2));
+  EXPECT_EQ(report.objective[1].lb, mpq_class{-2});
+  EXPECT_EQ(report.objective[1].ub, mpq_class(-1, 3));
+  ASSERT_EQ(report.rhs.size(), 2u);
+  EXPECT_EQ(report.rhs[0].lb, mpq_class{2});
+  EXPECT_EQ(report.rhs[0].ub, mpq_class{12});
+}
+
+TEST_P(TestLpSolver, SolveParametric) {
+  AddSmallLp(*solver_);
+
+  // The objective coefficient of x is -1 + t. Beyond t = 1/2, x = 0 and y = 2
+  const std::vector<delpi::ParametricSegment> segments{
+      solver_->SolveParametric(std::vector<mpq_class>{1, 0}, 0, 2)};
+  ASSERT_EQ(segments.size(), 2u);
+  EXPECT_EQ(segments[0].t_lb, 0);
+  EXPECT_EQ(segments[0].t_ub, mpq_class(1, 2));
+  EXPECT_EQ(segments[0].result, LpResult::OPTIMAL);
+  EXPECT_EQ(segments[0].objective, mpq_class(-14, 5));
+  EXPECT_EQ(segments[0].slope, mpq_class(8, 5));
+  EXPECT_EQ(segments[1].t_lb, mpq_class(1, 2));
+  EXPECT_EQ(segments[1].t_ub, 2);
+  EXPECT_EQ(segments[1].solution, (std::vector<mpq_class>{0, 2}));
+
+  // The objective is restored
+  EXPECT_EQ(solver_->column(0).obj.value(), -1);
+  EXPECT_EQ(solver_->num_scopes(), 0);
+}
+
+TEST_P(TestLpSolver, SolveLexicographic) {
+  solver_->AddColumn(x_, 0, 0, 5);
+  solver_->AddColumn(y_, 0, 0, 10);
+  solver_->AddRow(x_ + y_, FormulaKind::Leq, 8);
+
+  // Maximising x leaves y free in [0, 3]. Maximising y alone would give y = 8
+  const std::vector<Expression> objectives{-x_, -y_};
+  mpq_class precision{0};
+  ASSERT_EQ(solver_->SolveLexicographic(objectives, precision), LpResult::OPTIMAL);
+  EXPECT_EQ(solver_->solution(x_), 5);
+  EXPECT_EQ(solver_->solution(y_), 3);
+
+  // The objective and the bounds are restored
+  EXPECT_FALSE(solver_->column(0).obj.has_value());
+  EXPECT_EQ(solver_->column(0).lb.value(), 0);
+  EXPECT_EQ(solver_->column(0).ub.value(), 5);
+  EXPECT_EQ(solver_->row(0).ub.value(), 8);
+  EXPECT_EQ(solver_->num_scopes(), 0);
+}
+
+TEST_P(TestLpSolver, SolveLexicographicInfeasible) {
+  solver_->AddColumn(x_, 0, 0, 5);
+  solver_->AddRow(Expression{x_}, FormulaKind::Geq, 6);
+  const std::vector<Expression> objectives{Expression{x_}, -x_};
+  mpq_class precision{0};
+  EXPECT_EQ(solver_->SolveLexicographic(objectives, precision), LpResult::INFEASIBLE);
+}
+
+TEST_P(TestLpSolver, SolveDecomposed) {
+  const Variable w{"w"};
+  for (const unsigned int jobs : {1u, 3u}) {
+    config_.m_number_of_jobs() = jobs;
+    const std::unique_ptr<LpSolver> solver{LpSolver::GetInstance(config_)};
+    // Blocks {x, y} and {z}, while w appears in no row
+    solver->AddColumn(x_, 1, 0, 20);
+    solver->AddColumn(y_, 2, 0, 20);
+    solver->AddColumn(z_, 1, 0, 20);
+    solver->AddColumn(w, -1, 1, 4);
+    solver->AddRow(x_ + y_, FormulaKind::Geq, 2);
+    solver->AddRow(2 * z_, FormulaKind::Geq, 6);
+    int calls = 0;
+    mpq_class objective;
+    solver->m_solve_cb() = [&](const LpSolver&, const LpResult, const std::vector<mpq_class>&,
+                               const std::vector<mpq_class>&, const mpq_class& obj_lb, const mpq_class& obj_ub,
+                               const mpq_class&) {
+      ++calls;
+      EXPECT_EQ(obj_lb, obj_ub);
+      objective = obj_lb;
+    };
+
+    mpq_class precision{0};
+    ASSERT_EQ(solver->SolveDecomposed(precision), LpResult::OPTIMAL);
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(objective, 2 + 3 - 4);
+    EXPECT_EQ(solver->solution(), (std::vector<mpq_class>{2, 0, 3, 4}));
+    EXPECT_EQ(solver->dual_solution().size(), 2u);
+  }
+}
+
+TEST_P(TestLpSolver, SolveDecomposedInfeasible) {
+  solver_->AddColumn(x_, 1, 0, 5);
+  solver_->AddColumn(y_, 1, 0, 5);
+  solver_->AddColumn(z_, -1, 0, mpq_class{solver_->infinity()});
+  solver_->AddRow(Expression{x_}, FormulaKind::Geq, 6);
+  solver_->AddRow(Expression{y_}, FormulaKind::Geq, 1);
+  // The unbounded column does not matter, since another block is infeasible
+  mpq_class precision{0};
+  EXPECT_EQ(solver_->SolveDecomposed(precision), LpResult::INFEASIBLE);
+  EXPECT_EQ(solver_->dual_solution().size(), 2u);
+}
+
+TEST_P(TestLpSolver, SolveDualized) {
+  std::vector<mpq_class> objectives;
+  std::vector<std::unique_ptr<LpSolver>> solvers;
+  for (const Config::Dualize dualize : {Config::Dualize::OFF, Config::Dualize::ON}) {
+    config_.m_dualize() = dualize;
+    std::unique_ptr<LpSolver>& solver{solvers.emplace_back(LpSolver::GetInstance(config_))};
+    // min -x - y s.t. x + 2y <= 4, 3x + y <= 6, plus rows that are not tight at the optimum x = 8/5, y = 6/5
+    solver->AddColumn(x_, -1, 0, solver->infinity());
+    solver->AddColumn(y_, -1, 0, solver->infinity());
+    solver->AddColumn(z_, 0, solver->ninfinity(), solver->infinity());
+    solver->AddRow(x_ + 2 * y_, FormulaKind::Leq, 4);
+    solver->AddRow(3 * x_ + y_, FormulaKind::Leq, 6);
+    solver->AddRow(x_ - y_, FormulaKind::Geq, -5);
+    solver->AddRow(x_ - z_, FormulaKind::Eq, 0);
+    solver->AddRow(Expression{x_}, FormulaKind::Leq, 10);
+    solver->m_solve_cb() = [&](const LpSolver&, const LpResult, const std::vector<mpq_class>&,
+                               const std::vector<mpq_class>&, const mpq_class& obj_lb, const mpq_class&,
+                               const mpq_class&) { objectives.push_back(obj_lb); };
+
+    mpq_class precision{0};
+    ASSERT_EQ(solver->Solve(precision), LpResult::OPTIMAL);
+    EXPECT_EQ(solver->solution(x_), mpq_class(8, 5));
+    EXPECT_EQ(solver->solution(y_), mpq_class(6, 5));
+    EXPECT_EQ(solver->solution(z_), mpq_class(8, 5));
+  }
+  ASSERT_EQ(objectives.size(), 2u);
+  EXPECT_EQ(objectives[0], mpq_class(-14, 5));
+  EXPECT_EQ(objectives[1], objectives[0]);
+  EXPECT_EQ(solvers[1]->dual_solution(), solvers[0]->dual_solution());
+}
+
+TEST_P(TestLpSolver, SolveDualizedAgain) {
+  config_.m_dualize() = Config::Dualize::ON;
+  config_.m_with_timings() = true;
+  const std::unique_ptr<LpSolver> solver{LpSolver::GetInstance(config_)};
+  // min -x - y s.t. x + 2y <= 4, 3x + y <= 6, 0 <= x <= 10, y >= 0. The optimal solution is x = 8/5, y = 6/5
+  solver->AddColumn(x_, -1, 0, 10);
+  solver->AddColumn(y_, -1, 0, solver->infinity());
+  solver->AddRow(x_ + 2 * y_, FormulaKind::Leq, 4);
+  solver->AddRow(3 * x_ + y_, FormulaKind::Leq, 6);
+  mpq_class precision{0};
+  ASSERT_EQ(solver->Solve(precision), LpResult::OPTIMAL);
+  EXPECT_EQ(solver->solution(x_), mpq_class(8, 5));
+
+  // Changing a finite bound only changes the objective of the dual problem, so its LP solver is kept
+  solver->SetBound(x_, 0, 1);
+  ASSERT_EQ(solver->Solve(precision), LpResult::OPTIMAL);
+  EXPECT_EQ(solver->solution(x_), 1);
+  EXPECT_EQ(solver->solution(y_), mpq_class(3, 2));
+  EXPECT_EQ(solver->profiler().counter("solve/dualize", "reuses"), 1u);
+  ASSERT_NE(solver->profiler().Find("solve/dualize/solve"), nullptr);
+  EXPECT_EQ(solver->profiler().Find("solve/dualize/solve")->calls, 2u);
+}
+
+TEST_P(TestLpSolver, SolveDualizedInfeasibleOrUnbounded) {
+  config_.m_dualize() = Config::Dualize::ON;
+  const std::unique_ptr<LpSolver> infeasible{LpSolver::GetInstance(config_)};
+  infeasible->AddColumn(x_, 1, 0, 5);
+  infeasible->AddRow(Expression{x_}, FormulaKind::Geq, 6);
+  mpq_class precision{0};
+  EXPECT_EQ(infeasible->Solve(precision), LpResult::INFEASIBLE);
+  EXPECT_EQ(infeasible->dual_solution().size(), 1u);
+
+  // The dual problem is infeasible, so the problem itself is solved to tell it is unbounded
+  const std::unique_ptr<LpSolver> unbounded{LpSolver::GetInstance(config_)};
+  unbounded->AddColumn(x_, -1, 0, unbounded->infinity());
+  unbounded->AddRow(Expression{x_}, FormulaKind::Geq, 6);
+  EXPECT_EQ(unbounded->Solve(precision), LpResult::UNBOUNDED);
+}
+
 #ifndef NDEBUG
 TEST_P(TestLpSolver, Dump) { EXPECT_NO_THROW(solver_->Dump()); }
 #endif
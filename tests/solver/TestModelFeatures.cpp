@@ -0,0 +1,97 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <sstream>
+#include <vector>
+
+#include "delpi/solver/ModelFeatures.h"
+
+using delpi::Column;
+using delpi::ModelFeatures;
+using delpi::Row;
+using delpi::Variable;
+using Feature = delpi::ModelFeatures::Feature;
+
+class TestModelFeatures : public ::testing::Test {
+ protected:
+  const Variable x_{"x"}, y_{"y"}, z_{"z"}, w_{"w"};
+  // x fixed, y boxed, z bounded from below, w free
+  const std::vector<Column> columns_{Column{x_, 1, 1, std::nullopt}, Column{y_, 0, 2, 1},
+                                     Column{z_, 0, std::nullopt, mpq_class{1, 3}},
+                                     Column{w_, std::nullopt, std::nullopt, std::nullopt}};
+  // An equality, a ranged row, an inequality and a free row
+  const std::vector<Row> rows_{Row{{{x_, 1}, {y_, 2}}, 0, 0}, Row{{{y_, mpq_class{1, 4}}, {z_, 1024}}, 1, 3},
+                               Row{{{z_, 1}, {w_, 0}}, std::nullopt, 0}, Row{{{w_, 1}}, std::nullopt, std::nullopt}};
+};
+
+TEST_F(TestModelFeatures, Size) {
+  const ModelFeatures features{columns_, rows_};
+  EXPECT_EQ(features[Feature::NUM_COLUMNS], 4);
+  EXPECT_EQ(features[Feature::NUM_ROWS], 4);
+  // The zero coefficient does not count
+  EXPECT_EQ(features[Feature::NUM_NONZEROS], 6);
+  EXPECT_DOUBLE_EQ(features[Feature::DENSITY], 6.0 / 16);
+  EXPECT_EQ(features[Feature::ROW_COLUMN_RATIO], 1);
+  EXPECT_DOUBLE_EQ(features[Feature::OBJECTIVE_DENSITY], 0.5);
+}
+
+TEST_F(TestModelFeatures, Types) {
+  const ModelFeatures features{columns_, rows_};
+  EXPECT_EQ(features[Feature::EQUALITY_ROW_RATIO], 0.25);
+  EXPECT_EQ(features[Feature::RANGED_ROW_RATIO], 0.25);
+  EXPECT_EQ(features[Feature::INEQUALITY_ROW_RATIO], 0.25);
+  EXPECT_EQ(features[Feature::FREE_ROW_RATIO], 0.25);
+  EXPECT_EQ(features[Feature::FIXED_COLUMN_RATIO], 0.25);
+  EXPECT_EQ(features[Feature::BOXED_COLUMN_RATIO], 0.25);
+  EXPECT_EQ(features[Feature::BOUNDED_COLUMN_RATIO], 0.25);
+  EXPECT_EQ(features[Feature::FREE_COLUMN_RATIO], 0.25);
+  // Two of the four right-hand sides are zero, since the equality has a single one
+  EXPECT_EQ(features[Feature::ZERO_RHS_RATIO], 0.5);
+}
+
+TEST_F(TestModelFeatures, Numbers) {
+  const ModelFeatures features{columns_, rows_};
+  // The smallest coefficient is 1/4 and the largest is 1024
+  EXPECT_EQ(features[Feature::LOG2_DYNAMIC_RANGE], 12);
+  EXPECT_EQ(features[Feature::MAX_COMPLEXITY], 2);
+  // Only 1/3 is not an exact double
+  EXPECT_LT(features[Feature::DOUBLE_EXACT_RATIO], 1);
+  EXPECT_GT(features[Feature::DOUBLE_EXACT_RATIO], 0.9);
+
+  const mpq_class large{mpz_class{1} << 200, 3};
+  const ModelFeatures large_features{{Column{x_, 0, large, std::nullopt}}, {Row{{{x_, large}}, 0, std::nullopt}}};
+  EXPECT_EQ(large_features[Feature::MAX_COMPLEXITY], 5);
+  EXPECT_EQ(large_features[Feature::MEAN_COMPLEXITY], 5);
+  EXPECT_EQ(large_features[Feature::DOUBLE_EXACT_RATIO], 0);
+}
+
+TEST_F(TestModelFeatures, Empty) {
+  const ModelFeatures features{{}, {}};
+  for (std::size_t i = 0; i < ModelFeatures::num_features; ++i) {
+    if (static_cast<Feature>(i) == Feature::DOUBLE_EXACT_RATIO) continue;
+    EXPECT_EQ(features.values()[i], 0) << ModelFeatures::names[i];
+  }
+  EXPECT_EQ(features[Feature::DOUBLE_EXACT_RATIO], 1);
+}
+
+TEST_F(TestModelFeatures, Names) {
+  for (std::size_t i = 0; i < ModelFeatures::num_features; ++i) {
+    EXPECT_EQ(ModelFeatures::FromName(ModelFeatures::names[i]), static_cast<Feature>(i));
+  }
+  EXPECT_FALSE(ModelFeatures::FromName("not_a_feature").has_value());
+}
+
+TEST_F(TestModelFeatures, WriteCsv) {
+  const ModelFeatures features{columns_, rows_};
+  std::stringstream header, line;
+  ModelFeatures::WriteCsvHeader(header);
+  features.WriteCsv(line);
+  EXPECT_TRUE(header.str().starts_with("num_columns,num_rows,num_nonzeros,density,"));
+  EXPECT_TRUE(line.str().starts_with("4,4,6,0.375,"));
+  EXPECT_EQ(std::ranges::count(header.str(), ','), std::ranges::count(line.str(), ','));
+}
@@ -0,0 +1,96 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+#include "delpi/solver/Pdhg.h"
+#include "tests/solver/SolverUtils.h"
+
+using delpi::Basis;
+using delpi::BasisStatus;
+using delpi::Column;
+using delpi::Pdhg;
+using delpi::Row;
+using delpi::Variable;
+
+using TestPdhg = SmallLpTest<>;
+
+TEST_F(TestPdhg, Constructor) {
+  const Pdhg pdhg{columns_, rows_, var_to_col_};
+  EXPECT_EQ(pdhg.num_columns(), 3);
+  EXPECT_EQ(pdhg.num_rows(), 2);
+}
+
+TEST_F(TestPdhg, Solve) {
+  const Pdhg pdhg{columns_, rows_, var_to_col_};
+  const Pdhg::Result result{pdhg.Solve(100000, 1e-8)};
+  ASSERT_TRUE(result.converged);
+  EXPECT_LE(result.error, 1e-8);
+  EXPECT_GT(result.iterations, 0);
+  EXPECT_NEAR(result.solution[0], 1.6, 1e-6);
+  EXPECT_NEAR(result.solution[1], 1.2, 1e-6);
+  EXPECT_NEAR(result.solution[2], 0, 1e-6);
+  EXPECT_NEAR(result.dual_solution[0], -0.4, 1e-6);
+  EXPECT_NEAR(result.dual_solution[1], -0.2, 1e-6);
+}
+
+TEST_F(TestPdhg, SolveThreads) {
+  const Pdhg::Result sequential{Pdhg{columns_, rows_, var_to_col_, 1}.Solve(100000, 1e-8)};
+  const Pdhg::Result parallel{Pdhg{columns_, rows_, var_to_col_, 4}.Solve(100000, 1e-8)};
+  // Each row is computed by a single thread, so the result is the same
+  EXPECT_EQ(sequential.iterations, parallel.iterations);
+  EXPECT_EQ(sequential.solution, parallel.solution);
+  EXPECT_EQ(sequential.dual_solution, parallel.dual_solution);
+}
+
+TEST_F(TestPdhg, MaxIterations) {
+  const Pdhg pdhg{columns_, rows_, var_to_col_};
+  const Pdhg::Result result{pdhg.Solve(1, 1e-8)};
+  EXPECT_FALSE(result.converged);
+  EXPECT_EQ(result.iterations, 1);
+  EXPECT_EQ(result.solution.size(), 3u);
+  EXPECT_EQ(result.dual_solution.size(), 2u);
+}
+
+TEST_F(TestPdhg, CrashBasis) {
+  const Pdhg pdhg{columns_, rows_, var_to_col_};
+  const Basis basis{pdhg.CrashBasis(pdhg.Solve(100000, 1e-6), 1e-4)};
+  EXPECT_EQ(basis.columns, (std::vector<BasisStatus>{BasisStatus::BASIC, BasisStatus::BASIC, BasisStatus::AT_LOWER}));
+  EXPECT_EQ(basis.rows, (std::vector<BasisStatus>{BasisStatus::AT_UPPER, BasisStatus::AT_UPPER}));
+}
+
+TEST_F(TestPdhg, CrashBasisSize) {
+  // Whatever the solution, the basis has exactly as many basic statuses as the rows
+  const Pdhg pdhg{columns_, rows_, var_to_col_};
+  for (const std::vector<double>& solution :
+       {std::vector<double>{0, 0, 0}, std::vector<double>{1, 1, 1}, std::vector<double>{1.6, 1.2, 0}}) {
+    const Basis basis{pdhg.CrashBasis({false, 0, 0, 0, solution, {0, 0}}, 1e-4)};
+    ASSERT_EQ(basis.columns.size(), 3u);
+    ASSERT_EQ(basis.rows.size(), 2u);
+    const auto num_basic =
+        std::ranges::count(basis.columns, BasisStatus::BASIC) + std::ranges::count(basis.rows, BasisStatus::BASIC);
+    EXPECT_EQ(num_basic, 2);
+  }
+}
+
+TEST_F(TestPdhg, EqualityAndFree) {
+  // min x s.t. x - w = 1, x + w >= 3, w free, x in [0, 10]
+  // The optimal solution is x = 2, w = 1
+  const Variable w{"w"};
+  const std::vector<Column> columns{Column{x_, 0, 10, 1}, Column{w, std::nullopt, std::nullopt, std::nullopt}};
+  const std::vector<Row> rows{Row{{{x_, 1}, {w, -1}}, 1, 1}, Row{{{x_, 1}, {w, 1}}, 3, std::nullopt}};
+  const Pdhg pdhg{columns, rows, {{x_, 0}, {w, 1}}};
+  const Pdhg::Result result{pdhg.Solve(100000, 1e-8)};
+  ASSERT_TRUE(result.converged);
+  EXPECT_NEAR(result.solution[0], 2, 1e-6);
+  EXPECT_NEAR(result.solution[1], 1, 1e-6);
+  const Basis basis{pdhg.CrashBasis(result, 1e-4)};
+  EXPECT_EQ(basis.columns, (std::vector<BasisStatus>{BasisStatus::BASIC, BasisStatus::BASIC}));
+  EXPECT_EQ(basis.rows, (std::vector<BasisStatus>{BasisStatus::FIXED, BasisStatus::AT_LOWER}));
+}
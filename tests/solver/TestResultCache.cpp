@@ -0,0 +1,173 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "delpi/solver/ResultCache.h"
+
+using delpi::BasisStatus;
+using delpi::Column;
+using delpi::Config;
+using delpi::LpResult;
+using delpi::ResultCache;
+using delpi::Row;
+using delpi::Variable;
+
+class TestResultCache : public ::testing::Test {
+ protected:
+  const Variable x_{"x"}, y_{"y"}, z_{"z"};
+  const Config config_{};
+  std::filesystem::path directory_;
+  std::vector<Column> columns_;
+  std::vector<Row> rows_;
+
+  void SetUp() override {
+    const std::string test_name{::testing::UnitTest::GetInstance()->current_test_info()->name()};
+    directory_ = std::filesystem::temp_directory_path() / ("delpi_test_result_cache_" + test_name);
+    std::filesystem::remove_all(directory_);
+    columns_ = {Column{x_, 0, 10, 1}, Column{y_, 0, std::nullopt, std::nullopt}, Column{z_, -1, 1, -2}};
+    rows_ = {Row{{{x_, 1}, {y_, 2}}, std::nullopt, 4}, Row{{{y_, 1}, {z_, -1}}, 0, 0}};
+  }
+  void TearDown() override { std::filesystem::remove_all(directory_); }
+};
+
+TEST_F(TestResultCache, CanonicaliseColumnOrder) {
+  const std::optional<ResultCache::CanonicalModel> model = ResultCache::Canonicalise(columns_, rows_, config_, 0);
+  ASSERT_TRUE(model.has_value());
+  std::ranges::reverse(columns_);
+  const std::optional<ResultCache::CanonicalModel> reversed = ResultCache::Canonicalise(columns_, rows_, config_, 0);
+  ASSERT_TRUE(reversed.has_value());
+  EXPECT_EQ(model->key, reversed->key);
+  EXPECT_EQ(model->columns, (std::vector<int>{0, 1, 2}));
+  EXPECT_EQ(reversed->columns, (std::vector<int>{2, 1, 0}));
+}
+
+TEST_F(TestResultCache, CanonicaliseRowOrder) {
+  const std::optional<ResultCache::CanonicalModel> model = ResultCache::Canonicalise(columns_, rows_, config_, 0);
+  ASSERT_TRUE(model.has_value());
+  std::ranges::reverse(rows_);
+  std::ranges::reverse(rows_[0].addends);
+  const std::optional<ResultCache::CanonicalModel> reversed = ResultCache::Canonicalise(columns_, rows_, config_, 0);
+  ASSERT_TRUE(reversed.has_value());
+  EXPECT_EQ(model->key, reversed->key);
+  EXPECT_EQ(model->rows[0], 1 - reversed->rows[0]);
+  EXPECT_EQ(model->rows[1], 1 - reversed->rows[1]);
+}
+
+TEST_F(TestResultCache, CanonicaliseDifferentModel) {
+  const std::optional<ResultCache::CanonicalModel> model = ResultCache::Canonicalise(columns_, rows_, config_, 0);
+  rows_[1].ub = 1;
+  const std::optional<ResultCache::CanonicalModel> changed = ResultCache::Canonicalise(columns_, rows_, config_, 0);
+  ASSERT_TRUE(model.has_value());
+  ASSERT_TRUE(changed.has_value());
+  EXPECT_NE(model->key, changed->key);
+}
+
+TEST_F(TestResultCache, CanonicaliseDifferentPrecision) {
+  const std::optional<ResultCache::CanonicalModel> model = ResultCache::Canonicalise(columns_, rows_, config_, 0);
+  const std::optional<ResultCache::CanonicalModel> changed =
+      ResultCache::Canonicalise(columns_, rows_, config_, mpq_class{1, 1000});
+  ASSERT_TRUE(model.has_value());
+  ASSERT_TRUE(changed.has_value());
+  EXPECT_NE(model->key, changed->key);
+}
+
+TEST_F(TestResultCache, CanonicaliseStableKey) {
+  // The keys name the entries on disk, so they must not change across builds, platforms or runs
+  const std::optional<ResultCache::CanonicalModel> model = ResultCache::Canonicalise(columns_, rows_, config_, 0);
+  ASSERT_TRUE(model.has_value());
+  EXPECT_EQ(model->key, "d5ac31688516f77db3f569435d9a4eda");
+}
+
+TEST_F(TestResultCache, CanonicaliseDuplicateNames) {
+  columns_.emplace_back(Variable{"x"}, 0, 1, std::nullopt);
+  EXPECT_FALSE(ResultCache::Canonicalise(columns_, rows_, config_, 0).has_value());
+}
+
+TEST_F(TestResultCache, LoadMissing) {
+  const ResultCache cache{directory_, 0};
+  const std::optional<ResultCache::CanonicalModel> model = ResultCache::Canonicalise(columns_, rows_, config_, 0);
+  ASSERT_TRUE(model.has_value());
+  EXPECT_FALSE(cache.Load(*model).has_value());
+}
+
+TEST_F(TestResultCache, StoreLoadPermuted) {
+  const ResultCache cache{directory_, 0};
+  const std::optional<ResultCache::CanonicalModel> model = ResultCache::Canonicalise(columns_, rows_, config_, 0);
+  ASSERT_TRUE(model.has_value());
+  ResultCache::Entry entry;
+  entry.result = LpResult::OPTIMAL;
+  entry.obj_lb = entry.obj_ub = mpq_class{-3, 2};
+  entry.solution = {1, 0, mpq_class{5, 4}};
+  entry.dual_solution = {2, -1};
+  entry.basis.columns = {BasisStatus::BASIC, BasisStatus::AT_LOWER, BasisStatus::AT_UPPER};
+  entry.basis.rows = {BasisStatus::BASIC, BasisStatus::FIXED};
+  ASSERT_TRUE(cache.Store(*model, entry));
+
+  std::ranges::reverse(columns_);
+  std::ranges::reverse(rows_);
+  const std::optional<ResultCache::CanonicalModel> reversed = ResultCache::Canonicalise(columns_, rows_, config_, 0);
+  ASSERT_TRUE(reversed.has_value());
+  const std::optional<ResultCache::Entry> loaded = cache.Load(*reversed);
+  ASSERT_TRUE(loaded.has_value());
+  EXPECT_EQ(loaded->result, LpResult::OPTIMAL);
+  EXPECT_EQ(loaded->precision, 0);
+  EXPECT_EQ(loaded->obj_lb, mpq_class(-3, 2));
+  EXPECT_EQ(loaded->obj_ub, mpq_class(-3, 2));
+  EXPECT_EQ(loaded->solution, (std::vector<mpq_class>{mpq_class{5, 4}, 0, 1}));
+  EXPECT_EQ(loaded->dual_solution, (std::vector<mpq_class>{-1, 2}));
+  EXPECT_EQ(loaded->basis.columns,
+            (std::vector<BasisStatus>{BasisStatus::AT_UPPER, BasisStatus::AT_LOWER, BasisStatus::BASIC}));
+  EXPECT_EQ(loaded->basis.rows, (std::vector<BasisStatus>{BasisStatus::FIXED, BasisStatus::BASIC}));
+}
+
+TEST_F(TestResultCache, LoadCorrupted) {
+  const ResultCache cache{directory_, 0};
+  const std::optional<ResultCache::CanonicalModel> model = ResultCache::Canonicalise(columns_, rows_, config_, 0);
+  ASSERT_TRUE(model.has_value());
+  const std::filesystem::path path{directory_ / (model->key + ".delpi")};
+  const std::string valid_prefix{"delpi-cache 1\nsize 3 2\nresult 1\n"};
+  // Any malformed entry is a miss, never an exception
+  for (const std::string &content :
+       {std::string{"\x01\xff garbage"}, valid_prefix + "precision abc\n",
+        valid_prefix + "precision 0\nobjective 1/0 1\n",
+        valid_prefix + "precision 0\nobjective 1 1\nprimal 3 1 x 2\n",
+        valid_prefix + "precision 0\nobjective 1 1\nprimal 0\ndual 0\nbasis-columns BZB\nbasis-rows -\n",
+        valid_prefix + "precision 0\nobjective 1 1\nprimal 3 1 2"}) {
+    std::ofstream{path} << content;
+    EXPECT_NO_THROW(EXPECT_FALSE(cache.Load(*model).has_value())) << content;
+  }
+  std::ofstream{path} << valid_prefix
+                      << "precision 0\nobjective 1 1\nprimal 0\ndual 0\nbasis-columns BLU\nbasis-rows -\n";
+  EXPECT_TRUE(cache.Load(*model).has_value());
+}
+
+TEST_F(TestResultCache, StoreWrongSize) {
+  const ResultCache cache{directory_, 0};
+  const std::optional<ResultCache::CanonicalModel> model = ResultCache::Canonicalise(columns_, rows_, config_, 0);
+  ASSERT_TRUE(model.has_value());
+  ResultCache::Entry entry;
+  entry.result = LpResult::OPTIMAL;
+  entry.solution = {1, 2};
+  EXPECT_FALSE(cache.Store(*model, entry));
+  EXPECT_FALSE(cache.Load(*model).has_value());
+}
+
+TEST_F(TestResultCache, Evict) {
+  const ResultCache cache{directory_, 1};
+  const std::optional<ResultCache::CanonicalModel> model = ResultCache::Canonicalise(columns_, rows_, config_, 0);
+  ASSERT_TRUE(model.has_value());
+  ResultCache::Entry entry;
+  entry.result = LpResult::INFEASIBLE;
+  ASSERT_TRUE(cache.Store(*model, entry));
+  EXPECT_FALSE(cache.Load(*model).has_value());
+}
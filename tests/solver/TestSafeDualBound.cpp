@@ -0,0 +1,73 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "delpi/solver/SafeDualBound.h"
+#include "tests/solver/SolverUtils.h"
+
+using delpi::Column;
+using delpi::SafeDualBound;
+
+class TestSafeDualBound : public SmallLpTest<> {
+ protected:
+  // Every column is also bounded from above by 10
+  TestSafeDualBound() {
+    for (Column& column : columns_) column.ub = 10;
+  }
+};
+
+TEST_F(TestSafeDualBound, ApproximateOptimalDual) {
+  const SafeDualBound safe_dual_bound{columns_, rows_, var_to_col_};
+  const std::optional<mpq_class> bound = safe_dual_bound.LowerBound(std::vector<double>{-0.4, -0.2});
+  ASSERT_TRUE(bound.has_value());
+  EXPECT_LE(*bound, optimum_);
+  EXPECT_GE(*bound, (optimum_ - mpq_class{1, 1000000}));
+}
+
+TEST_F(TestSafeDualBound, PerturbedDual) {
+  const SafeDualBound safe_dual_bound{columns_, rows_, var_to_col_};
+  const std::optional<mpq_class> bound = safe_dual_bound.LowerBound(std::vector<double>{-0.41, -0.19});
+  ASSERT_TRUE(bound.has_value());
+  EXPECT_LE(*bound, optimum_);
+}
+
+TEST_F(TestSafeDualBound, ZeroDual) {
+  // Only the bounds of the columns are used
+  const SafeDualBound safe_dual_bound{columns_, rows_, var_to_col_};
+  const std::optional<mpq_class> bound = safe_dual_bound.LowerBound(std::vector<double>{0, 0});
+  ASSERT_TRUE(bound.has_value());
+  EXPECT_LE(*bound, -20);
+  EXPECT_GE(*bound, (mpq_class{-20} - mpq_class{1, 1000000}));
+}
+
+TEST_F(TestSafeDualBound, WrongSignIsProjected) {
+  // The rows have no lower bound, so a positive dual is treated as zero
+  const SafeDualBound safe_dual_bound{columns_, rows_, var_to_col_};
+  const std::optional<mpq_class> bound = safe_dual_bound.LowerBound(std::vector<double>{5, 3});
+  ASSERT_TRUE(bound.has_value());
+  EXPECT_LE(*bound, -20);
+  EXPECT_GE(*bound, (mpq_class{-20} - mpq_class{1, 1000000}));
+}
+
+TEST_F(TestSafeDualBound, UnboundedColumn) {
+  // The reduced cost of x may be negative, and x has no upper bound
+  columns_[0].ub.reset();
+  const SafeDualBound safe_dual_bound{columns_, rows_, var_to_col_};
+  EXPECT_FALSE(safe_dual_bound.LowerBound(std::vector<double>{-0.4, -0.2}).has_value());
+  // With a dual that makes the reduced cost of x clearly positive, the bound is finite again
+  const std::optional<mpq_class> bound = safe_dual_bound.LowerBound(std::vector<double>{-0.5, -0.2});
+  ASSERT_TRUE(bound.has_value());
+  EXPECT_LE(*bound, optimum_);
+}
+
+TEST_F(TestSafeDualBound, NonFiniteDual) {
+  const SafeDualBound safe_dual_bound{columns_, rows_, var_to_col_};
+  EXPECT_FALSE(safe_dual_bound.LowerBound(std::vector<double>{-std::numeric_limits<double>::infinity(), 0}));
+}
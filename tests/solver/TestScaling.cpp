@@ -0,0 +1,132 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "delpi/solver/Scaling.h"
+
+using delpi::Column;
+using delpi::Row;
+using delpi::Scaling;
+using delpi::Variable;
+
+class TestScaling : public ::testing::Test {
+ protected:
+  /**
+   * Power of two with the given exponent.
+   * @param exp exponent
+   * @return @f$ 2^{exp} @f$
+   */
+  static mpq_class Pow2(const int exp) {
+    mpq_class result{1};
+    mpz_mul_2exp(exp >= 0 ? result.get_num_mpz_t() : result.get_den_mpz_t(),
+                 exp >= 0 ? result.get_num_mpz_t() : result.get_den_mpz_t(), std::abs(exp));
+    return result;
+  }
+
+  const Variable x_{"x"}, y_{"y"};
+  const std::unordered_map<Variable, int> var_to_col_{{x_, 0}, {y_, 1}};
+};
+
+TEST_F(TestScaling, Identity) {
+  const std::vector<Column> columns{Column{x_, 0, 1, 1}, Column{y_, std::nullopt, std::nullopt, std::nullopt}};
+  const std::vector<Row> rows{Row{{{x_, 1}, {y_, -1}}, 0, 2}, Row{{{x_, 1}, {y_, 1}}, std::nullopt, 1}};
+  const Scaling scaling{columns, rows, var_to_col_};
+  EXPECT_TRUE(scaling.identity());
+  EXPECT_EQ(scaling.precision_exponent(), 0);
+  EXPECT_EQ(scaling.rows()[0].addends[0].second, 1);
+  EXPECT_EQ(scaling.rows()[0].addends[1].second, -1);
+  EXPECT_EQ(scaling.columns()[0].ub, 1);
+}
+
+TEST_F(TestScaling, Equilibrate) {
+  // 1000x + 2000y <= 4000, x / 1000 + y / 250 >= 1 / 1000
+  const std::vector<Column> columns{Column{x_, 3, 5, 7}, Column{y_, 0, std::nullopt, std::nullopt}};
+  const std::vector<Row> rows{
+      Row{{{x_, 1000}, {y_, 2000}}, std::nullopt, 4000},
+      Row{{{x_, mpq_class(1, 1000)}, {y_, mpq_class(1, 250)}}, mpq_class(1, 1000), std::nullopt}};
+  const Scaling scaling{columns, rows, var_to_col_};
+  ASSERT_FALSE(scaling.identity());
+  EXPECT_GE(scaling.passes(), 1);
+  const std::vector<int>& row_exp = scaling.row_exponents();
+  const std::vector<int>& col_exp = scaling.column_exponents();
+
+  // Each entry is the original one times a power of two, and the largest entry of each column lies in [1, 2)
+  std::vector<mpq_class> col_max(2, 0);
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_EQ(scaling.rows()[i].addends.size(), 2u);
+    for (int j = 0; j < 2; ++j) {
+      const mpq_class& coeff = scaling.rows()[i].addends[j].second;
+      EXPECT_EQ(coeff, rows[i].addends[j].second * Pow2(row_exp[i] + col_exp[j]));
+      col_max[j] = std::max(col_max[j], mpq_class{abs(coeff)});
+    }
+  }
+  for (const mpq_class& max : col_max) {
+    EXPECT_GE(max, 1);
+    EXPECT_LT(max, 2);
+  }
+  EXPECT_EQ(scaling.rows()[0].ub, 4000 * Pow2(row_exp[0]));
+  EXPECT_EQ(scaling.rows()[1].lb, mpq_class(1, 1000) * Pow2(row_exp[1]));
+  EXPECT_EQ(scaling.columns()[0].lb, 3 / Pow2(col_exp[0]));
+  EXPECT_EQ(scaling.columns()[0].ub, 5 / Pow2(col_exp[0]));
+  EXPECT_EQ(scaling.columns()[0].obj, 7 * Pow2(col_exp[0]));
+  EXPECT_EQ(scaling.columns()[1].ub, std::nullopt);
+}
+
+TEST_F(TestScaling, Solutions) {
+  const std::vector<Column> columns{Column{x_, 0, std::nullopt, 1}, Column{y_, 0, std::nullopt, 1}};
+  const std::vector<Row> rows{Row{{{x_, 1024}, {y_, 3}}, 1, std::nullopt},
+                              Row{{{x_, mpq_class(1, 64)}, {y_, 5}}, std::nullopt, 9}};
+  const Scaling scaling{columns, rows, var_to_col_};
+  const std::vector<int>& col_exp = scaling.column_exponents();
+  const std::vector<int>& row_exp = scaling.row_exponents();
+
+  const std::vector<mpq_class> solution{mpq_class(1, 3), 7};
+  const std::vector<mpq_class> scaled_solution{solution[0] / Pow2(col_exp[0]), solution[1] / Pow2(col_exp[1])};
+  EXPECT_EQ(scaling.PrimalSolution(scaled_solution), solution);
+  // The activity of each scaled row is the original one times the scale factor of the row
+  for (int i = 0; i < 2; ++i) {
+    mpq_class activity{0}, scaled_activity{0};
+    for (int j = 0; j < 2; ++j) {
+      activity += rows[i].addends[j].second * solution[j];
+      scaled_activity += scaling.rows()[i].addends[j].second * scaled_solution[j];
+    }
+    EXPECT_EQ(scaled_activity, activity * Pow2(row_exp[i]));
+  }
+
+  const std::vector<mpq_class> scaled_dual{mpq_class(-2, 5), 3};
+  const std::vector<mpq_class> dual{scaling.DualSolution(scaled_dual)};
+  EXPECT_EQ(dual[0], scaled_dual[0] * Pow2(row_exp[0]));
+  EXPECT_EQ(dual[1], scaled_dual[1] * Pow2(row_exp[1]));
+}
+
+TEST_F(TestScaling, Precision) {
+  const std::vector<Column> columns{Column{x_, 0, std::nullopt, 1}, Column{y_, 0, std::nullopt, 1}};
+  const std::vector<Row> rows{Row{{{x_, mpq_class(1, 4096)}, {y_, mpq_class(1, 8192)}}, 1, std::nullopt}};
+  const Scaling scaling{columns, rows, var_to_col_};
+  EXPECT_GE(scaling.precision_exponent(), 0);
+  const mpq_class precision{1, 1000};
+  EXPECT_LE(scaling.ScaledPrecision(precision), precision);
+  EXPECT_EQ(scaling.OriginalPrecision(scaling.ScaledPrecision(precision)), precision);
+}
+
+TEST_F(TestScaling, HugeCoefficients) {
+  // Coefficients far beyond the range of a double
+  mpz_class huge;
+  mpz_ui_pow_ui(huge.get_mpz_t(), 10, 400);
+  const std::vector<Column> columns{Column{x_, 0, 1, std::nullopt}, Column{y_, 0, 1, std::nullopt}};
+  const std::vector<Row> rows{Row{{{x_, mpq_class{huge}}, {y_, mpq_class{huge}}}, std::nullopt, mpq_class{huge}}};
+  const Scaling scaling{columns, rows, var_to_col_};
+  ASSERT_FALSE(scaling.identity());
+  for (const auto& [var, coeff] : scaling.rows()[0].addends) {
+    EXPECT_GE(coeff, 1);
+    EXPECT_LT(coeff, 2);
+  }
+}
@@ -0,0 +1,119 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <vector>
+
+#include "delpi/solver/SensitivityAnalysis.h"
+#include "tests/solver/SolverUtils.h"
+
+using delpi::Basis;
+using delpi::BasisStatus;
+using delpi::Column;
+using delpi::Row;
+using delpi::SensitivityAnalysis;
+using delpi::SensitivityRange;
+using delpi::SensitivityReport;
+
+using TestSensitivityAnalysis = SmallLpTest<>;
+
+TEST_F(TestSensitivityAnalysis, Optimal) {
+  const SensitivityAnalysis analysis{columns_, rows_, var_to_col_, optimal_basis_};
+  ASSERT_TRUE(analysis.optimal());
+  EXPECT_EQ(analysis.solution(), (std::vector<mpq_class>{mpq_class{8, 5}, mpq_class{6, 5}, 0}));
+  EXPECT_EQ(analysis.dual_solution(), (std::vector<mpq_class>{mpq_class{-2, 5}, mpq_class{-1, 5}}));
+}
+
+TEST_F(TestSensitivityAnalysis, NotOptimal) {
+  // x = 2, y = 0 is a vertex, but increasing y improves the objective
+  const Basis basis{{BasisStatus::BASIC, BasisStatus::AT_LOWER, BasisStatus::AT_LOWER},
+                    {BasisStatus::BASIC, BasisStatus::AT_UPPER}};
+  EXPECT_FALSE((SensitivityAnalysis{columns_, rows_, var_to_col_, basis}.optimal()));
+}
+
+TEST_F(TestSensitivityAnalysis, ObjectiveRange) {
+  const SensitivityAnalysis analysis{columns_, rows_, var_to_col_, optimal_basis_};
+  const SensitivityRange x_range{analysis.ObjectiveRange(0)};
+  EXPECT_EQ(x_range.lb, mpq_class{-3});
+  EXPECT_EQ(x_range.ub, mpq_class(-1, 2));
+  const SensitivityRange y_range{analysis.ObjectiveRange(1)};
+  EXPECT_EQ(y_range.lb, mpq_class{-2});
+  EXPECT_EQ(y_range.ub, mpq_class(-1, 3));
+  const SensitivityRange z_range{analysis.ObjectiveRange(2)};
+  EXPECT_EQ(z_range.lb, mpq_class{0});
+  EXPECT_FALSE(z_range.ub.has_value());
+}
+
+TEST_F(TestSensitivityAnalysis, RhsRange) {
+  const SensitivityAnalysis analysis{columns_, rows_, var_to_col_, optimal_basis_};
+  for (const int row : {0, 1}) {
+    const SensitivityRange range{analysis.RhsRange(row)};
+    EXPECT_EQ(range.lb, mpq_class{2});
+    EXPECT_EQ(range.ub, mpq_class{12});
+  }
+}
+
+TEST_F(TestSensitivityAnalysis, RhsRangeBasicRow) {
+  // With x + 2y <= 5, only the second row is tight at x = 2, y = 0
+  const std::vector<Row> rows{Row{{{x_, 1}, {y_, 2}}, std::nullopt, 5}, Row{{{x_, 3}, {y_, 1}}, std::nullopt, 6}};
+  const std::vector<Column> columns{Column{x_, 0, std::nullopt, -1}, Column{y_, 0, std::nullopt, 0},
+                                    Column{z_, 0, std::nullopt, std::nullopt}};
+  const Basis basis{{BasisStatus::BASIC, BasisStatus::AT_LOWER, BasisStatus::AT_LOWER},
+                    {BasisStatus::BASIC, BasisStatus::AT_UPPER}};
+  const SensitivityAnalysis analysis{columns, rows, var_to_col_, basis};
+  ASSERT_TRUE(analysis.optimal());
+  const SensitivityRange range{analysis.RhsRange(0)};
+  EXPECT_EQ(range.lb, mpq_class{2});
+  EXPECT_FALSE(range.ub.has_value());
+}
+
+TEST_F(TestSensitivityAnalysis, Report) {
+  const SensitivityReport report{SensitivityAnalysis{columns_, rows_, var_to_col_, optimal_basis_}.Report()};
+  ASSERT_EQ(report.objective.size(), columns_.size());
+  ASSERT_EQ(report.rhs.size(), rows_.size());
+  EXPECT_EQ(report.objective[0].ub, mpq_class(-1, 2));
+  EXPECT_EQ(report.rhs[1].lb, mpq_class{2});
+}
+
+TEST_F(TestSensitivityAnalysis, ParametricRange) {
+  // The objective coefficient of x is -1 + t
+  const SensitivityAnalysis analysis{columns_, rows_, var_to_col_, optimal_basis_};
+  const SensitivityRange range{analysis.ParametricRange(std::vector<mpq_class>{1, 0, 0})};
+  EXPECT_EQ(range.lb, mpq_class{-2});
+  EXPECT_EQ(range.ub, mpq_class(1, 2));
+}
+
+TEST_F(TestSensitivityAnalysis, NextBasis) {
+  const std::vector<mpq_class> direction{1, 0, 0};
+  const SensitivityAnalysis analysis{columns_, rows_, var_to_col_, optimal_basis_};
+  // Beyond t = 1/2, the second row is no longer tight and x leaves the basis
+  const std::optional<Basis> next{analysis.NextBasis(direction, mpq_class(1, 2))};
+  ASSERT_TRUE(next.has_value());
+  EXPECT_EQ(next->columns,
+            (std::vector<BasisStatus>{BasisStatus::AT_LOWER, BasisStatus::BASIC, BasisStatus::AT_LOWER}));
+  EXPECT_EQ(next->rows, (std::vector<BasisStatus>{BasisStatus::AT_UPPER, BasisStatus::BASIC}));
+
+  // The new basis is optimal from t = 1/2 onwards
+  std::vector<Column> columns{columns_};
+  columns[0].obj = mpq_class(-1, 2);
+  const SensitivityAnalysis next_analysis{columns, rows_, var_to_col_, *next};
+  ASSERT_TRUE(next_analysis.optimal());
+  EXPECT_EQ(next_analysis.solution(), (std::vector<mpq_class>{0, 2, 0}));
+  const SensitivityRange range{next_analysis.ParametricRange(direction)};
+  EXPECT_EQ(range.lb, mpq_class{0});
+  EXPECT_FALSE(range.ub.has_value());
+}
+
+TEST_F(TestSensitivityAnalysis, NextBasisUnbounded) {
+  // The objective coefficient of z is -t, and z has no upper bound
+  const std::vector<mpq_class> direction{0, 0, -1};
+  const SensitivityAnalysis analysis{columns_, rows_, var_to_col_, optimal_basis_};
+  const SensitivityRange range{analysis.ParametricRange(direction)};
+  EXPECT_FALSE(range.lb.has_value());
+  EXPECT_EQ(range.ub, mpq_class{0});
+  EXPECT_FALSE(analysis.NextBasis(direction, 0).has_value());
+}
@@ -0,0 +1,138 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "delpi/solver/SparseLu.h"
+
+using delpi::SparseLu;
+using SparseVector = SparseLu::SparseVector;
+
+namespace {
+
+/**
+ * Compute @f$ A x @f$, with the matrix stored by column.
+ * @param columns columns of the matrix
+ * @param x vector to multiply
+ * @return product, indexed by row
+ */
+std::vector<mpq_class> Multiply(const std::vector<SparseVector>& columns, const std::vector<mpq_class>& x) {
+  std::vector<mpq_class> b(columns.size());
+  for (std::size_t j = 0; j < columns.size(); ++j) {
+    for (const auto& [i, value] : columns[j]) b[i] += value * x[j];
+  }
+  return b;
+}
+
+/**
+ * Compute @f$ A^T y @f$, with the matrix stored by column.
+ * @param columns columns of the matrix
+ * @param y vector to multiply
+ * @return product, indexed by column
+ */
+std::vector<mpq_class> MultiplyTranspose(const std::vector<SparseVector>& columns, const std::vector<mpq_class>& y) {
+  std::vector<mpq_class> c(columns.size());
+  for (std::size_t j = 0; j < columns.size(); ++j) {
+    for (const auto& [i, value] : columns[j]) c[j] += value * y[i];
+  }
+  return c;
+}
+
+}  // namespace
+
+TEST(TestSparseLu, Solve) {
+  // [[2, 0, 1], [1, 3, 0], [0, 1, 4]]
+  const std::vector<SparseVector> columns{{{0, 2}, {1, 1}}, {{1, 3}, {2, 1}}, {{0, 1}, {2, 4}}};
+  const SparseLu lu{columns};
+  ASSERT_FALSE(lu.singular());
+  EXPECT_EQ(lu.size(), 3);
+  EXPECT_EQ(lu.num_blocks(), 1u);
+  const std::vector<mpq_class> b{1, 2, 3};
+  const std::vector<mpq_class> x{lu.Solve(b)};
+  EXPECT_EQ(Multiply(columns, x), b);
+  EXPECT_EQ(x, (std::vector<mpq_class>{mpq_class{1, 5}, mpq_class{3, 5}, mpq_class{3, 5}}));
+}
+
+TEST(TestSparseLu, SolveTranspose) {
+  const std::vector<SparseVector> columns{{{0, 2}, {1, 1}}, {{1, 3}, {2, 1}}, {{0, 1}, {2, 4}}};
+  const SparseLu lu{columns};
+  ASSERT_FALSE(lu.singular());
+  const std::vector<mpq_class> c{1, -2, mpq_class{1, 3}};
+  EXPECT_EQ(MultiplyTranspose(columns, lu.SolveTranspose(c)), c);
+}
+
+TEST(TestSparseLu, RepeatedAndZeroEntries) {
+  // [[1, 0], [0, 2]], with the first coefficient split in two and an explicit zero
+  const std::vector<SparseVector> columns{{{0, mpq_class{1, 2}}, {0, mpq_class{1, 2}}, {1, 0}}, {{1, 2}}};
+  const SparseLu lu{columns};
+  ASSERT_FALSE(lu.singular());
+  EXPECT_EQ(lu.num_blocks(), 2u);
+  EXPECT_EQ(lu.Solve({3, 4}), (std::vector<mpq_class>{3, 2}));
+}
+
+TEST(TestSparseLu, EmptyColumn) {
+  const SparseLu lu{{{{0, 1}, {1, 1}}, {}}};
+  EXPECT_TRUE(lu.singular());
+}
+
+TEST(TestSparseLu, LinearlyDependentColumns) {
+  const SparseLu lu{{{{0, 1}, {1, 2}}, {{0, 2}, {1, 4}}}};
+  EXPECT_TRUE(lu.singular());
+}
+
+TEST(TestSparseLu, CancellationMakesSingular) {
+  // [[1, 1, 0], [1, 1, 1], [0, 0, 1]]. The third row is the difference of the first two
+  const SparseLu lu{{{{0, 1}, {1, 1}}, {{0, 1}, {1, 1}}, {{1, 1}, {2, 1}}}};
+  EXPECT_TRUE(lu.singular());
+}
+
+TEST(TestSparseLu, IndependentBlocks) {
+  // Two 2x2 blocks interleaved: rows and columns {0, 2} and {1, 3}
+  const std::vector<SparseVector> columns{{{0, 1}, {2, 3}}, {{1, 2}, {3, 1}}, {{0, 1}, {2, 1}}, {{1, 1}, {3, 1}}};
+  const SparseLu lu{columns, 2};
+  ASSERT_FALSE(lu.singular());
+  EXPECT_EQ(lu.num_blocks(), 2u);
+  const std::vector<mpq_class> b{1, 2, 3, 4};
+  EXPECT_EQ(Multiply(columns, lu.Solve(b)), b);
+  EXPECT_EQ(MultiplyTranspose(columns, lu.SolveTranspose(b)), b);
+}
+
+TEST(TestSparseLu, RandomSparseMatrix) {
+  constexpr int size = 60, num_blocks = 3, block_size = size / num_blocks;
+  std::mt19937 rng{42};
+  std::uniform_int_distribution<int> value_dist{-5, 5}, index_dist{0, block_size - 1};
+  std::vector<SparseVector> columns(size);
+  // Column diagonally dominant blocks, hence non-singular
+  for (int j = 0; j < size; ++j) {
+    const int offset = j / block_size * block_size;
+    mpq_class sum{0};
+    for (int k = 0; k < 3; ++k) {
+      const int i = offset + index_dist(rng);
+      mpq_class value{value_dist(rng), 1 + k};
+      value.canonicalize();
+      if (i == j || value == 0) continue;
+      columns[j].emplace_back(i, value);
+      sum += abs(value);
+    }
+    columns[j].emplace_back(j, sum + 1);
+  }
+  std::vector<mpq_class> b(size);
+  for (int i = 0; i < size; ++i) b[i] = value_dist(rng);
+
+  const SparseLu sequential{columns, 1};
+  const SparseLu parallel{columns, 4};
+  ASSERT_FALSE(sequential.singular());
+  ASSERT_FALSE(parallel.singular());
+  EXPECT_GE(sequential.num_blocks(), static_cast<std::size_t>(num_blocks));
+  const std::vector<mpq_class> x{sequential.Solve(b)};
+  EXPECT_EQ(Multiply(columns, x), b);
+  EXPECT_EQ(parallel.Solve(b), x);
+  const std::vector<mpq_class> y{sequential.SolveTranspose(b)};
+  EXPECT_EQ(MultiplyTranspose(columns, y), b);
+  EXPECT_EQ(parallel.SolveTranspose(b), y);
+}
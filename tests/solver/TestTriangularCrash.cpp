@@ -0,0 +1,97 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "delpi/solver/TriangularCrash.h"
+
+using delpi::Basis;
+using delpi::BasisStatus;
+using delpi::Column;
+using delpi::Row;
+using delpi::TriangularCrash;
+using delpi::Variable;
+
+class TestTriangularCrash : public ::testing::Test {
+ protected:
+  const Variable x_{"x"}, y_{"y"}, z_{"z"}, w_{"w"};
+  const std::unordered_map<Variable, int> var_to_col_{{x_, 0}, {y_, 1}, {z_, 2}, {w_, 3}};
+};
+
+TEST_F(TestTriangularCrash, SlackBasis) {
+  // All the columns are fixed, so none of them can be basic
+  const std::vector<Column> columns{Column{x_, 1, 1, 1}, Column{y_, 2, 2, std::nullopt}};
+  const std::vector<Row> rows{Row{{{x_, 1}, {y_, 1}}, 1, 5}, Row{{{x_, 1}, {y_, -1}}, std::nullopt, 0}};
+  const TriangularCrash crash{columns, rows, var_to_col_};
+  EXPECT_EQ(crash.num_structural(), 0);
+  EXPECT_EQ(crash.basis().columns, (std::vector<BasisStatus>{BasisStatus::FIXED, BasisStatus::FIXED}));
+  EXPECT_EQ(crash.basis().rows, (std::vector<BasisStatus>{BasisStatus::BASIC, BasisStatus::BASIC}));
+}
+
+TEST_F(TestTriangularCrash, Basis) {
+  // x + y = 2, y + z <= 3, x + z free, with x free, y >= 0, z in [0, 5] and w fixed
+  const std::vector<Column> columns{Column{x_, std::nullopt, std::nullopt, std::nullopt},
+                                    Column{y_, 0, std::nullopt, std::nullopt}, Column{z_, 0, 5, std::nullopt},
+                                    Column{w_, 1, 1, std::nullopt}};
+  const std::vector<Row> rows{Row{{{x_, 1}, {y_, 1}, {w_, 1}}, 2, 2}, Row{{{y_, 1}, {z_, 1}}, std::nullopt, 3},
+                              Row{{{x_, 1}, {z_, 1}}, std::nullopt, std::nullopt}};
+  const TriangularCrash crash{columns, rows, var_to_col_};
+  // x, being free, covers the equality row first. Then y takes the second row, while z only has free rows left
+  EXPECT_EQ(crash.num_structural(), 2);
+  EXPECT_EQ(crash.basis().columns, (std::vector<BasisStatus>{BasisStatus::BASIC, BasisStatus::BASIC,
+                                                             BasisStatus::AT_LOWER, BasisStatus::FIXED}));
+  EXPECT_EQ(crash.basis().rows,
+            (std::vector<BasisStatus>{BasisStatus::FIXED, BasisStatus::AT_UPPER, BasisStatus::BASIC}));
+}
+
+TEST_F(TestTriangularCrash, EqualityRowsFirst) {
+  // x appears in an inequality row and in an equality row, with the same coefficient
+  const std::vector<Column> columns{Column{x_, 0, std::nullopt, std::nullopt}};
+  const std::vector<Row> rows{Row{{{x_, 1}}, 1, std::nullopt}, Row{{{x_, 1}}, 4, 4}};
+  const TriangularCrash crash{columns, rows, var_to_col_};
+  EXPECT_EQ(crash.basis().columns, (std::vector<BasisStatus>{BasisStatus::BASIC}));
+  EXPECT_EQ(crash.basis().rows, (std::vector<BasisStatus>{BasisStatus::BASIC, BasisStatus::FIXED}));
+}
+
+TEST_F(TestTriangularCrash, SmallPivot) {
+  // y covers the second row, so x could only pivot on its entry in the first row, which is too small
+  const std::vector<Column> columns{Column{x_, 0, std::nullopt, std::nullopt},
+                                    Column{y_, std::nullopt, std::nullopt, std::nullopt}};
+  const std::vector<Row> rows{Row{{{x_, 1}}, 1, std::nullopt}, Row{{{x_, 100}, {y_, 1}}, std::nullopt, 5}};
+  const TriangularCrash crash{columns, rows, var_to_col_};
+  EXPECT_EQ(crash.num_structural(), 1);
+  EXPECT_EQ(crash.basis().columns, (std::vector<BasisStatus>{BasisStatus::AT_LOWER, BasisStatus::BASIC}));
+  EXPECT_EQ(crash.basis().rows, (std::vector<BasisStatus>{BasisStatus::BASIC, BasisStatus::AT_UPPER}));
+}
+
+TEST_F(TestTriangularCrash, Objective) {
+  // Between two columns of the same type, the one with the smallest objective coefficient is preferred
+  const std::vector<Column> columns{Column{x_, 0, std::nullopt, 3}, Column{y_, 0, std::nullopt, -1}};
+  const std::vector<Row> rows{Row{{{x_, 1}, {y_, 1}}, 1, std::nullopt}};
+  const TriangularCrash crash{columns, rows, var_to_col_};
+  EXPECT_EQ(crash.basis().columns, (std::vector<BasisStatus>{BasisStatus::AT_LOWER, BasisStatus::BASIC}));
+  EXPECT_EQ(crash.basis().rows, (std::vector<BasisStatus>{BasisStatus::AT_LOWER}));
+}
+
+TEST_F(TestTriangularCrash, NumBasic) {
+  // Dense rows: each column can take at most one row, and the basis always has a status per row
+  const std::vector<Column> columns{Column{x_, 0, 1, 1}, Column{y_, 0, 1, 1}, Column{z_, 0, 1, 1},
+                                    Column{w_, 0, 1, 1}};
+  std::vector<Row> rows;
+  for (int i = 0; i < 3; ++i) rows.push_back(Row{{{x_, i + 1}, {y_, 1}, {z_, 2}, {w_, -1}}, std::nullopt, i});
+  const TriangularCrash crash{columns, rows, var_to_col_};
+  const Basis& basis{crash.basis()};
+  ASSERT_EQ(basis.columns.size(), 4u);
+  ASSERT_EQ(basis.rows.size(), 3u);
+  const auto num_basic =
+      std::ranges::count(basis.columns, BasisStatus::BASIC) + std::ranges::count(basis.rows, BasisStatus::BASIC);
+  EXPECT_EQ(num_basic, 3);
+  EXPECT_EQ(std::ranges::count(basis.columns, BasisStatus::BASIC), crash.num_structural());
+}
@@ -37,7 +37,7 @@ TEST_F(TestArgParser, DefaultValues) {
   EXPECT_DOUBLE_EQ(parser_.get<double>("precision"), 9.999999999999996e-4);
   EXPECT_FALSE(parser_.get<bool>("produce-models"));
   EXPECT_EQ(parser_.get<uint>("random-seed"), 0u);
-  //  EXPECT_EQ(parser_.get<uint>("jobs"), 1u);
+  EXPECT_EQ(parser_.get<uint>("jobs"), 1u);
   EXPECT_FALSE(parser_.get<bool>("continuous-output"));
   EXPECT_FALSE(parser_.get<bool>("debug-parsing"));
   EXPECT_FALSE(parser_.get<bool>("debug-scanning"));
@@ -47,6 +47,8 @@ TEST_F(TestArgParser, DefaultValues) {
   EXPECT_FALSE(parser_.get<bool>("timings"));
   EXPECT_EQ(parser_.get<int>("verbose-simplex"), 0);
   EXPECT_FALSE(parser_.get<bool>("silent"));
+  EXPECT_FALSE(parser_.get<bool>("server"));
+  EXPECT_EQ(parser_.get<std::string>("socket"), "");
 }
 
 TEST_F(TestArgParser, ParseVerbosityIncreaseOne) {
@@ -96,16 +98,17 @@ TEST_F(TestArgParser, ParseInvalidPrecision) {
   EXPECT_DEATH(parser_.Parse(sizeof(argv) / sizeof(argv[0]), argv), "Invalid argument for --precision");
 }
 
-// TEST_F(TestArgParser, ParseJobs) {
-//   const char *argv[] = {"delpi", filename_mps_.c_str(), "--jobs", "2"};
-//   parser_.Parse(sizeof(argv) / sizeof(argv[0]), argv);
-//   EXPECT_EQ(parser_.get<uint>("jobs"), 2u);
-// }
-//
-// TEST_F(TestArgParser, ParseInvalidJobs) {
-//   const char *argv[] = {"delpi", filename_mps_.c_str(), "--jobs", "-1"};
-//   EXPECT_DEATH(parser_.Parse(sizeof(argv) / sizeof(argv[0]), argv), "Failed to parse '-1' as decimal integer");
-// }
+TEST_F(TestArgParser, ParseJobs) {
+  const char *argv[] = {"delpi", filename_mps_.c_str(), "--jobs", "2"};
+  parser_.Parse(sizeof(argv) / sizeof(argv[0]), argv);
+  EXPECT_EQ(parser_.get<uint>("jobs"), 2u);
+  EXPECT_EQ(parser_.ToConfig().number_of_jobs(), 2u);
+}
+
+TEST_F(TestArgParser, ParseInvalidJobs) {
+  const char *argv[] = {"delpi", filename_mps_.c_str(), "--jobs", "0"};
+  EXPECT_DEATH(parser_.Parse(sizeof(argv) / sizeof(argv[0]), argv), "Invalid argument for --jobs");
+}
 
 TEST_F(TestArgParser, ParseContinuousOutput) {
   const char *argv[] = {"delpi", filename_mps_.c_str(), "--continuous-output"};
@@ -210,3 +213,29 @@ TEST_F(TestArgParser, WrongInAutoFormat) {
   const char *argv[] = {"delpi", "--in", "--format", "auto"};
   EXPECT_DEATH(parser_.Parse(sizeof(argv) / sizeof(argv[0]), argv), "Invalid argument for --in");
 }
+
+TEST_F(TestArgParser, Server) {
+  const char *argv[] = {"delpi", "--server"};
+  parser_.Parse(sizeof(argv) / sizeof(argv[0]), argv);
+  const Config config = parser_.ToConfig();
+  EXPECT_TRUE(config.server());
+  EXPECT_EQ(config.server_socket(), "");
+}
+
+TEST_F(TestArgParser, ServerSocket) {
+  const char *argv[] = {"delpi", "--server", "--socket", "/tmp/delpi.sock"};
+  parser_.Parse(sizeof(argv) / sizeof(argv[0]), argv);
+  const Config config = parser_.ToConfig();
+  EXPECT_TRUE(config.server());
+  EXPECT_EQ(config.server_socket(), "/tmp/delpi.sock");
+}
+
+TEST_F(TestArgParser, WrongServerWithFile) {
+  const char *argv[] = {"delpi", filename_mps_.c_str(), "--server"};
+  EXPECT_DEATH(parser_.Parse(sizeof(argv) / sizeof(argv[0]), argv), "Invalid argument for --server");
+}
+
+TEST_F(TestArgParser, WrongSocketWithoutServer) {
+  const char *argv[] = {"delpi", filename_mps_.c_str(), "--socket", "/tmp/delpi.sock"};
+  EXPECT_DEATH(parser_.Parse(sizeof(argv) / sizeof(argv[0]), argv), "Invalid argument for --socket");
+}
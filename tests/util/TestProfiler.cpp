@@ -0,0 +1,131 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include "delpi/util/Profiler.h"
+
+using delpi::Profiler;
+using delpi::ProfilerGuard;
+
+TEST(TestProfiler, Disabled) {
+  Profiler profiler{false};
+  {
+    const ProfilerGuard guard{profiler, "parse"};
+    profiler.Count("rationals", 3);
+  }
+  EXPECT_FALSE(profiler.enabled());
+  EXPECT_TRUE(profiler.root().children.empty());
+  EXPECT_EQ(profiler.Find("parse"), nullptr);
+  EXPECT_EQ(profiler.counter("parse", "rationals"), 0u);
+}
+
+TEST(TestProfiler, NestedPhases) {
+  Profiler profiler{true};
+  {
+    const ProfilerGuard guard{profiler, "parse"};
+    const ProfilerGuard inner_guard{profiler, "build"};
+  }
+  {
+    const ProfilerGuard guard{profiler, "solve"};
+  }
+  ASSERT_EQ(profiler.root().children.size(), 2u);
+  EXPECT_EQ(profiler.root().children[0]->name, "parse");
+  EXPECT_EQ(profiler.root().children[1]->name, "solve");
+  ASSERT_NE(profiler.Find("parse/build"), nullptr);
+  EXPECT_EQ(profiler.Find("parse/build")->parent, profiler.Find("parse"));
+  EXPECT_EQ(profiler.Find("build"), nullptr);
+  EXPECT_EQ(profiler.Find("solve/build"), nullptr);
+}
+
+TEST(TestProfiler, RepeatedPhase) {
+  Profiler profiler{true};
+  for (int i = 0; i < 3; ++i) {
+    const ProfilerGuard guard{profiler, "solve"};
+  }
+  ASSERT_EQ(profiler.root().children.size(), 1u);
+  EXPECT_EQ(profiler.Find("solve")->calls, 3u);
+  EXPECT_FALSE(profiler.Find("solve")->timer.is_running());
+}
+
+TEST(TestProfiler, Counters) {
+  Profiler profiler{true};
+  {
+    const ProfilerGuard guard{profiler, "solve"};
+    profiler.Count("iterations", 10);
+    profiler.Count("iterations", 5);
+    const ProfilerGuard inner_guard{profiler, "extract"};
+    profiler.Count("iterations");
+  }
+  EXPECT_EQ(profiler.counter("solve", "iterations"), 15u);
+  EXPECT_EQ(profiler.counter("solve/extract", "iterations"), 1u);
+  EXPECT_EQ(profiler.counter("solve", "missing"), 0u);
+}
+
+TEST(TestProfiler, Reset) {
+  Profiler profiler{true};
+  {
+    const ProfilerGuard guard{profiler, "solve"};
+  }
+  profiler.Reset();
+  EXPECT_TRUE(profiler.root().children.empty());
+}
+
+TEST(TestProfiler, Merge) {
+  Profiler auxiliary{true};
+  {
+    const ProfilerGuard guard{auxiliary, "solve"};
+    auxiliary.Count("iterations", 4);
+    const ProfilerGuard inner_guard{auxiliary, "simplex"};
+  }
+  Profiler profiler{true};
+  {
+    const ProfilerGuard guard{profiler, "dualize"};
+    profiler.Merge(auxiliary);
+    profiler.Merge(auxiliary);
+  }
+  ASSERT_NE(profiler.Find("dualize/solve/simplex"), nullptr);
+  EXPECT_EQ(profiler.Find("dualize/solve")->calls, 2u);
+  EXPECT_EQ(profiler.Find("dualize/solve")->parent, profiler.Find("dualize"));
+  EXPECT_EQ(profiler.counter("dualize/solve", "iterations"), 8u);
+  EXPECT_EQ(profiler.Find("dualize")->calls, 1u);
+
+  Profiler disabled{false};
+  disabled.Merge(auxiliary);
+  EXPECT_TRUE(disabled.root().children.empty());
+}
+
+TEST(TestProfiler, WriteJson) {
+  Profiler profiler{true};
+  {
+    const ProfilerGuard guard{profiler, "parse"};
+    profiler.Count("rationals", 2);
+    const ProfilerGuard inner_guard{profiler, "build"};
+  }
+  std::stringstream ss;
+  profiler.WriteJson(ss);
+  const std::string json = ss.str();
+  EXPECT_EQ(json.rfind(R"({"phases":[{"name":"parse","calls":1,"seconds":)", 0), 0u);
+  EXPECT_NE(json.find(R"("counters":{"rationals":2},"phases":[{"name":"build","calls":1,"seconds":)"),
+            std::string::npos);
+  EXPECT_EQ(json.substr(json.size() - 4), "]}]}");
+}
+
+TEST(TestProfiler, WriteCsv) {
+  Profiler profiler{true};
+  {
+    const ProfilerGuard guard{profiler, "parse"};
+    profiler.Count("rationals", 2);
+    const ProfilerGuard inner_guard{profiler, "build"};
+  }
+  std::stringstream ss;
+  profiler.WriteCsv(ss);
+  const std::string csv = ss.str();
+  EXPECT_EQ(csv.rfind("phase,metric,value\nparse,calls,1\nparse,seconds,", 0), 0u);
+  EXPECT_NE(csv.find("\nparse,rationals,2\nparse/build,calls,1\nparse/build,seconds,"), std::string::npos);
+}
@@ -0,0 +1,62 @@
+/**
+ * @author Ernesto Casablanca (casablancaernesto@gmail.com)
+ * @copyright 2024 delpi
+ * @licence BSD 3-Clause License
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "delpi/util/ThreadPool.h"
+
+using delpi::ThreadPool;
+
+TEST(TestThreadPool, Size) {
+  ThreadPool pool{3};
+  EXPECT_EQ(pool.size(), 3u);
+}
+
+TEST(TestThreadPool, SizeHardware) {
+  ThreadPool pool{0};
+  EXPECT_GE(pool.size(), 1u);
+}
+
+TEST(TestThreadPool, SubmitReturnsValue) {
+  ThreadPool pool{2};
+  std::future<int> result = pool.Submit([]() { return 42; });
+  EXPECT_EQ(result.get(), 42);
+}
+
+TEST(TestThreadPool, SubmitForwardsException) {
+  ThreadPool pool{2};
+  std::future<void> result = pool.Submit([]() { throw std::runtime_error("error"); });
+  EXPECT_THROW(result.get(), std::runtime_error);
+}
+
+TEST(TestThreadPool, ManyJobs) {
+  ThreadPool pool{4};
+  std::atomic<int> counter{0};
+  std::vector<std::future<void>> results;
+  for (int i = 0; i < 100; ++i) results.emplace_back(pool.Submit([&counter]() { ++counter; }));
+  for (std::future<void>& result : results) result.get();
+  EXPECT_EQ(counter, 100);
+}
+
+TEST(TestThreadPool, Wait) {
+  ThreadPool pool{4};
+  std::atomic<int> counter{0};
+  for (int i = 0; i < 100; ++i) static_cast<void>(pool.Submit([&counter]() { ++counter; }));
+  pool.Wait();
+  EXPECT_EQ(counter, 100);
+}
+
+TEST(TestThreadPool, DestructorDrainsQueue) {
+  std::atomic<int> counter{0};
+  {
+    ThreadPool pool{1};
+    for (int i = 0; i < 10; ++i) static_cast<void>(pool.Submit([&counter]() { ++counter; }));
+  }
+  EXPECT_EQ(counter, 10);
+}
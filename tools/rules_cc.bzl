@@ -146,6 +146,16 @@ def _get_defines(rule_defines):
     }) + select({
         "//tools:thread_safe_build": ["DELPI_THREAD_SAFE"],
         "//conditions:default": [],
+    }) + select({
+        "//tools:log_active_level_auto_release": ["DELPI_LOG_ACTIVE_LEVEL=2"],
+        "//tools:log_active_level_trace": ["DELPI_LOG_ACTIVE_LEVEL=0"],
+        "//tools:log_active_level_debug": ["DELPI_LOG_ACTIVE_LEVEL=1"],
+        "//tools:log_active_level_info": ["DELPI_LOG_ACTIVE_LEVEL=2"],
+        "//tools:log_active_level_warn": ["DELPI_LOG_ACTIVE_LEVEL=3"],
+        "//tools:log_active_level_error": ["DELPI_LOG_ACTIVE_LEVEL=4"],
+        "//tools:log_active_level_critical": ["DELPI_LOG_ACTIVE_LEVEL=5"],
+        "//tools:log_active_level_off": ["DELPI_LOG_ACTIVE_LEVEL=6"],
+        "//conditions:default": [],
     })
 
 def _get_static(rule_linkstatic):
@@ -337,6 +347,49 @@ def delpi_cc_googletest(
         **kwargs
     )
 
+def delpi_cc_benchmark(
+        name,
+        srcs = None,
+        deps = None,
+        tags = [],
+        use_default_main = True,
+        **kwargs):
+    """Creates a rule to declare a C++ benchmark using Google Benchmark.
+
+    Always adds a deps= entry for Google Benchmark main
+    (@google_benchmark//:benchmark_main).
+
+    By default, it uses use_default_main=True to use Google Benchmark's main, via @google_benchmark//:benchmark_main.
+    If use_default_main is False, it will depend on @google_benchmark//:benchmark instead.
+    If a list of srcs is not provided, it will be inferred from the name, by capitalizing each _-separated word and appending .cpp.
+    For example, delpi_cc_benchmark(name = "bench_foo_bar") will look for BenchFooBar.cpp.
+    Furthermore, a tag will be added for the benchmark, based on the name, by converting the name to lowercase and removing the "bench_" prefix.
+
+    Args:
+        name: The name of the benchmark.
+        srcs: A list of source files to compile.
+        deps: A list of dependencies.
+        tags: A list of tags to add to the benchmark. Allows for filtering.
+        use_default_main: Whether to use Google Benchmark's main.
+        **kwargs: Additional arguments to pass to delpi_cc_binary.
+    """
+    if srcs == None:
+        srcs = ["".join([word.capitalize() for word in name.split("_")]) + ".cpp"]
+    if deps == None:
+        deps = []
+    if use_default_main:
+        deps = deps + ["@google_benchmark//:benchmark_main"]
+    else:
+        deps = deps + ["@google_benchmark//:benchmark"]
+    delpi_cc_binary(
+        name = name,
+        srcs = srcs,
+        deps = deps,
+        testonly = True,
+        tags = tags + ["delpi", "benchmark", "".join([word.lower() for word in name.split("_")][1:])],
+        **kwargs
+    )
+
 def delpi_srcs(name, srcs = None, hdrs = None, deps = [], subfolder = "", visibility = ["//visibility:public"]):
     """Returns three different lists of source files based on the name.
 